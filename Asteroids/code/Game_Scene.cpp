@@ -12,8 +12,11 @@
 #include "Menu_Scene.hpp"
 
 #include <cstdlib>
+#include <basics/Asset>
 #include <basics/Canvas>
 #include <basics/Director>
+#include <basics/Fast_Math>
+#include <basics/png_decode>
 #include <cmath>
 
 using namespace basics;
@@ -23,36 +26,37 @@ namespace example
 {
     // ---------------------------------------------------------------------------------------------
     // ID y ruta de las texturas que se deben cargar para esta escena. La textura con el mensaje de
-    // carga está la primera para poder dibujarla cuanto antes:
+    // carga está la primera para poder dibujarla cuanto antes. Las que participan en las colisiones
+    // indican además la reducción con la que se calcula su silueta (0 si no la necesitan):
 
     Game_Scene::Texture_Data Game_Scene::textures_data[] =
     {
-        { ID(loading),      "game-scene/loading_bar.png"                },
-        { ID(background),   "game-scene/background.png"                 },
-        { ID(h_bar),        "game-scene/borders/h_bar.png"              },
-        { ID(v_bar),        "game-scene/borders/v_bar.png"              },
-        { ID(r_arrow),      "game-scene/arrows/left_arrow.png"          },
-        { ID(l_arrow),      "game-scene/arrows/right_arrow.png"         },
-        { ID(up_arrow),     "game-scene/arrows/up_arrow.png"            },
-        { ID(Red_Button),   "game-scene/joysticks/red_button.png"       },
-
-        { ID(asteroid_one),     "game-scene/asteroid.png"               },
-        { ID(asteroid_two),     "game-scene/asteroid.png"               },
-
-        { ID(mini_asteroid),"game-scene/mini_asteroid.png"              },
-        { ID(ship),         "game-scene/ship.png"                       },
-        { ID(bullet),       "game-scene/bullet.png"                     },
-
-        { ID(heart_1),        "game-scene/heart.png"                    },
-        { ID(heart_2),        "game-scene/heart.png"                    },
-        { ID(heart_3),        "game-scene/heart.png"                    },
-
-        { ID(pause_icon),   "game-scene/pause_icon.png"                 },
-        { ID(pause_menu),   "game-scene/pause-menu/pause_menu.png"      },
-        { ID(resume_button),   "game-scene/pause-menu/resume_button.png"},
-        { ID(exit_button),   "game-scene/pause-menu/exit_button.png"    },
-        { ID(blue),   "game-scene/sprites_pruebas/blue.png"             },
-        { ID(yellow),   "game-scene/sprites_pruebas/yellow.png"         },
+        { ID(loading),        "game-scene/loading_bar.png",               0               },
+        { ID(background),     "game-scene/background.png",                0               },
+        { ID(h_bar),          "game-scene/borders/h_bar.png",             0               },
+        { ID(v_bar),          "game-scene/borders/v_bar.png",             0               },
+        { ID(r_arrow),        "game-scene/arrows/left_arrow.png",         0               },
+        { ID(l_arrow),        "game-scene/arrows/right_arrow.png",        0               },
+        { ID(up_arrow),       "game-scene/arrows/up_arrow.png",           0               },
+        { ID(Red_Button),     "game-scene/joysticks/red_button.png",      0               },
+
+        { ID(asteroid_one),   "game-scene/asteroid.png",                  shape_reduction },
+        { ID(asteroid_two),   "game-scene/asteroid.png",                  0               },
+
+        { ID(mini_asteroid),  "game-scene/mini_asteroid.png",             shape_reduction },
+        { ID(ship),           "game-scene/ship.png",                      shape_reduction },
+        { ID(bullet),         "game-scene/bullet.png",                    shape_reduction },
+
+        { ID(heart_1),        "game-scene/heart.png",                     0               },
+        { ID(heart_2),        "game-scene/heart.png",                     0               },
+        { ID(heart_3),        "game-scene/heart.png",                     0               },
+
+        { ID(pause_icon),     "game-scene/pause_icon.png",                0               },
+        { ID(pause_menu),     "game-scene/pause-menu/pause_menu.png",     0               },
+        { ID(resume_button),  "game-scene/pause-menu/resume_button.png",  0               },
+        { ID(exit_button),    "game-scene/pause-menu/exit_button.png",    0               },
+        { ID(blue),           "game-scene/sprites_pruebas/blue.png",      0               },
+        { ID(yellow),         "game-scene/sprites_pruebas/yellow.png",    0               },
     };
 
     // Para determinar el número de items en el array textures_data, se divide el tamaño en bytes
@@ -60,15 +64,15 @@ namespace example
 
     unsigned Game_Scene::textures_count = sizeof(textures_data) / sizeof(Texture_Data);
 
-    // ---------------------------------------------------------------------------------------------
-    // Definiciones de los atributos estáticos de la clase:
+    constexpr unsigned Game_Scene::shape_reduction;
 
-    constexpr float Game_Scene:: asteroid_speed_1;
-    constexpr float Game_Scene:: asteroid_speed_2;
-    constexpr float Game_Scene::     ship_speed;
-    constexpr float Game_Scene::   bullet_speed;
+    // ---------------------------------------------------------------------------------------------
 
     Game_Scene::Game_Scene()
+    :
+        simulation         (sprites, 1280.f, 720.f),
+        thrust_particles   (256),
+        explosion_particles(512)
     {
         // Se establece la resolución virtual (independiente de la resolución virtual del dispositivo).
         // En este caso no se hace ajuste de aspect ratio, por lo que puede haber distorsión cuando
@@ -77,15 +81,50 @@ namespace example
         canvas_width  = 1280;
         canvas_height =  720;
 
-        // Se inicia la semilla del generador de números aleatorios:
-
-        srand (unsigned(time(nullptr)));
+        textures_reused = false;
 
         // Se inicializan otros atributos:
 
         initialize ();
     }
 
+    // ---------------------------------------------------------------------------------------------
+    // Este método se ejecuta en un hilo secundario, por lo que no puede usar el contexto gráfico. Se
+    // limita a leer y decodificar las imágenes para que subirlas después sea rápido.
+
+    bool Game_Scene::preload ()
+    {
+        decoded_textures.resize (textures_count);
+
+        for (unsigned index = 0; index < textures_count; ++index)
+        {
+            std::shared_ptr< Asset > asset = Asset::open (textures_data[index].path);
+            std::vector< byte >      data;
+
+            if (!asset || !asset->read_all (data))
+            {
+                return false;
+            }
+
+            Decoded_Texture & decoded = decoded_textures[index];
+
+            if (!png_decode (data, decoded.color_buffer, decoded.options.width, decoded.options.height))
+            {
+                return false;
+            }
+
+            // La silueta se calcula aquí, mientras se tiene la imagen decodificada a mano y fuera
+            // del hilo principal:
+
+            if (textures_data[index].mask_reduction > 0)
+            {
+                decoded.alpha_mask = Alpha_Mask(decoded.color_buffer, textures_data[index].mask_reduction);
+            }
+        }
+
+        return true;
+    }
+
     // ---------------------------------------------------------------------------------------------
     // Algunos atributos se inicializan en este método en lugar de hacerlo en el constructor porque
     // este método puede ser llamado más veces para restablecer el estado de la escena y el constructor
@@ -97,6 +136,22 @@ namespace example
         suspended = true;
         gameplay  = UNINITIALIZED;
 
+        // Si la escena se reutiliza (por ejemplo, desde la caché de Director), se conservan las
+        // texturas pero se descartan los sprites de la partida anterior:
+
+        textures_reused = textures.size () == textures_count;
+
+        sprites    .clear ();
+        thrust_particles   .clear ();
+        explosion_particles.clear ();
+
+        loading_time    = 0.f;
+
+        // Toda la aleatoriedad de la partida sale de la semilla que asigna Director, de modo que en
+        // modo determinista se puede reproducir una partida grabada:
+
+        simulation.seed (get_random_seed ());
+
         return true;
     }
 
@@ -116,31 +171,17 @@ namespace example
 
     // ---------------------------------------------------------------------------------------------
 
-    void Game_Scene::handle (Event & event)
+    void Game_Scene::handle_touch (Touch_Event & touch)
     {
         if (state == RUNNING) // Se descartan los eventos cuando la escena está LOADING
         {
+            // La posición de los dedos se consulta en run_simulation() mediante el estado
+            // multitáctil de Director, por lo que aquí solo se detecta el primer toque:
+
             if (gameplay == WAITING_TO_START)
             {
                 start_playing (); // Se empieza a jugar cuando el usuario toca la pantalla por primera vez
             }
-            else switch (event.id)
-            {
-                case ID(touch-started): // El usuario toca la pantalla
-                case ID(touch-moved): // El usuario mueve se dedo
-                {
-                    finger_position_x = *event[ID(x)].as< var::Float > (); // Posición X donde pulsa
-                    finger_position_y = *event[ID(y)].as< var::Float > (); // Posición Y donde pulsa
-                    screen_touched = true; // La pantalla ha sido tocada
-                    break;
-                }
-
-                case ID(touch-ended): // El usuario deja de tocar la pantalla
-                {
-                    screen_touched = false; // La pantalla deja de ser tocada
-                    break;
-                }
-            }
         }
     }
 
@@ -150,7 +191,7 @@ namespace example
     {
         if (!suspended) switch (state)
         {
-            case LOADING:        load_textures  (); break;
+            case LOADING:        loading_time += time; load_textures (); break;
             case RUNNING:    run_simulation (time); break;
             case ERROR:   break;
         }
@@ -213,10 +254,20 @@ namespace example
 
             if (context)
             {
-                // Se carga la siguiente textura (textures.size() indica cuántas llevamos cargadas):
+                // Se sube la siguiente textura (textures.size() indica cuántas llevamos cargadas):
+
+                Texture_Data    & texture_data = textures_data   [textures.size ()];
+                Decoded_Texture & decoded      = decoded_textures[textures.size ()];
+                Texture_Handle  & texture      = textures[texture_data.id] = Texture_2D::create
+                (
+                    texture_data.id, context, decoded.color_buffer, decoded.options
+                );
 
-                Texture_Data   & texture_data = textures_data[textures.size ()];
-                Texture_Handle & texture      = textures[texture_data.id] = Texture_2D::create (texture_data.id, context, texture_data.path);
+                // La textura guarda su propia copia de la imagen, por lo que se libera la decodificada:
+
+                decoded.color_buffer = basics::Color_Buffer< Rgba8888 >();
+
+                alpha_masks[texture_data.id] = std::move (decoded.alpha_mask);
 
                 // Se comprueba si la textura se ha podido cargar correctamente:
 
@@ -233,7 +284,7 @@ namespace example
                 // las usarán e iniciar el juego:
             }
         }
-        else if (timer.get_elapsed_seconds () > 1.f)    // Si las texturas se han cargado muy rápido
+        else if (textures_reused || loading_time > 1.f) // Si las texturas se han cargado muy rápido
         {                                               // se espera un segundo desde el inicio de
             create_sprites ();                          // la carga antes de pasar al juego para que
             restart_game   ();                          // el mensaje de carga no aparezca y desaparezca
@@ -246,34 +297,38 @@ namespace example
 
     void Game_Scene::create_sprites ()
     {
-        // Se crean y configuran los sprites del fondo:
-
-        Sprite_Handle         background(new Sprite( textures[ID(background)].get () ));
-        Sprite_Handle            top_bar(new Sprite( textures[ID     (h_bar)].get () ));
-        Sprite_Handle         bottom_bar(new Sprite( textures[ID     (h_bar)].get () ));
-        Sprite_Handle          right_bar(new Sprite( textures[ID     (v_bar)].get () ));
-        Sprite_Handle           left_bar(new Sprite( textures[ID     (v_bar)].get () ));
-        Sprite_Handle            r_arrow(new Sprite( textures[ID   (r_arrow)].get () ));
-        Sprite_Handle            l_arrow(new Sprite( textures[ID   (l_arrow)].get () ));
-        Sprite_Handle           up_arrow(new Sprite( textures[ID  (up_arrow)].get () ));
-        Sprite_Handle         red_button(new Sprite( textures[ID(Red_Button)].get () ));
-        Sprite_Handle         pause_icon(new Sprite( textures[ID(pause_icon)].get () ));
-        Sprite_Handle              heart_1(new Sprite( textures[ID (heart_1)].get () ));
-        Sprite_Handle              heart_2(new Sprite( textures[ID (heart_2)].get () ));
-        Sprite_Handle              heart_3(new Sprite( textures[ID (heart_3)].get () ));
-        Sprite_Handle         blue(new Sprite( textures[ID(blue)].get () ));
-        Sprite_Handle         yellow(new Sprite( textures[ID(yellow)].get () ));
-
-        background->set_anchor                                                             (CENTER);
-        background->set_position                         ({ canvas_width / 2, canvas_height / 2 });
-        top_bar->set_anchor                                                          (CENTER | TOP);
-        top_bar->set_position                                ({ canvas_width / 2, canvas_height });
-        bottom_bar->set_anchor                                                    (CENTER | BOTTOM);
-        bottom_bar->set_position                                         ({ canvas_width / 2, 0 });
-        right_bar->set_anchor                                                      (CENTER | RIGHT);
-        right_bar->set_position                              ({ canvas_width, canvas_height / 2 });
-        left_bar->set_anchor                                                        (CENTER | LEFT);
-        left_bar->set_position                                          ({ 0, canvas_height / 2 });
+        // Se crea el fondo y, encima, los sprites de la simulación (bordes, asteroides, nave, balas
+        // y fragmentos):
+
+        background = sprites.create (textures[ID(background)].get ());
+
+        background->set_anchor   (CENTER);
+        background->set_position ({ canvas_width / 2, canvas_height / 2 });
+
+        Game_Simulation::Assets assets;
+
+        assets.h_bar         = look (ID        (h_bar));
+        assets.v_bar         = look (ID        (v_bar));
+        assets.asteroid      = look (ID (asteroid_one));
+        assets.mini_asteroid = look (ID(mini_asteroid));
+        assets.ship          = look (ID         (ship));
+        assets.bullet        = look (ID       (bullet));
+
+        simulation.create (assets);
+
+        // Los controles y las vidas se dibujan por encima del juego:
+
+        Sprite_Handle            r_arrow = sprites.create (textures[ID   (r_arrow)].get ());
+        Sprite_Handle            l_arrow = sprites.create (textures[ID   (l_arrow)].get ());
+        Sprite_Handle           up_arrow = sprites.create (textures[ID  (up_arrow)].get ());
+        Sprite_Handle         red_button = sprites.create (textures[ID(Red_Button)].get ());
+        Sprite_Handle         pause_icon = sprites.create (textures[ID(pause_icon)].get ());
+        Sprite_Handle              heart_1 = sprites.create (textures[ID (heart_1)].get ());
+        Sprite_Handle              heart_2 = sprites.create (textures[ID (heart_2)].get ());
+        Sprite_Handle              heart_3 = sprites.create (textures[ID (heart_3)].get ());
+        Sprite_Handle         blue = sprites.create (textures[ID(blue)].get ());
+        Sprite_Handle         yellow = sprites.create (textures[ID(yellow)].get ());
+
         r_arrow->set_anchor                                                         (BOTTOM | LEFT);
         r_arrow->set_position                                                         ({ 30, 30 });
         l_arrow->set_anchor                                                         (BOTTOM | LEFT);
@@ -283,55 +338,34 @@ namespace example
         red_button->set_anchor                                                     (BOTTOM | RIGHT);
         red_button->set_position                                                    ({ 1250, 30 });
 
-        sprites.push_back      (background);
-        sprites.push_back         (top_bar);
-        sprites.push_back      (bottom_bar);
-        sprites.push_back       (right_bar);
-        sprites.push_back        (left_bar);
-        sprites.push_back         (r_arrow);
-        sprites.push_back         (l_arrow);
-        sprites.push_back        (up_arrow);
-        sprites.push_back      (red_button);
-        sprites.push_back      (pause_icon);
-        sprites.push_back         (heart_1);
-        sprites.push_back         (heart_2);
-        sprites.push_back         (heart_3);
-        sprites.push_back            (blue);
-        sprites.push_back          (yellow);
-
-        // Se crea la nave, el asteroide y la bala:
-
-        Sprite_Handle    asteroid_handle(new Sprite( textures[ID  (asteroid_one)].get () ));
-        Sprite_Handle    asteroid_handle_2(new Sprite( textures[ID  (asteroid_two)].get () ));
-        Sprite_Handle              ship_handle(new Sprite( textures[ID(ship)].get () ));
-        Sprite_Handle          bullet_handle(new Sprite( textures[ID(bullet)].get () ));
-
-        sprites.push_back (asteroid_handle);
-        sprites.push_back (asteroid_handle_2);
-        sprites.push_back     (ship_handle);
-        sprites.push_back   (bullet_handle);
-
-        // Se guardan punteros a los sprites que se van a usar frecuentemente:
-
-        top_border    =      background.get ();
-        top_border    =         top_bar.get ();
-        bottom_border =      bottom_bar.get ();
-        right_border  =       right_bar.get ();
-        left_border   =        left_bar.get ();
-        right_arrow   =         r_arrow.get ();
-        left_arrow    =         l_arrow.get ();
-        Uparrow       =        up_arrow.get ();
-        r_button      =      red_button.get ();
-        asteroid_1      = asteroid_handle.get ();
-        asteroid_2      = asteroid_handle_2.get ();
-        ship          =     ship_handle.get ();
-        bullet        =   bullet_handle.get ();
-        p_icon        =      pause_icon.get ();
-        h_life_1        =       heart_1.get ();
-        h_life_2        =       heart_2.get ();
-        h_life_3        =       heart_3.get ();
-        blue_ball        =         blue.get ();
-        yellow_ball        =         yellow.get ();
+        blue  ->hide ();   // Puntos utilizados para realizar pruebas
+        yellow->hide ();
+
+        // Los sprites del menú de pausa se crean al final para que se dibujen por encima del resto y
+        // permanecen ocultos hasta que se pausa el juego:
+
+        p_menu     = sprites.create (textures[ID   (pause_menu)].get ());
+        res_button = sprites.create (textures[ID(resume_button)].get ());
+        ext_button = sprites.create (textures[ID  (exit_button)].get ());
+
+        p_menu    ->hide ();
+        res_button->hide ();
+        ext_button->hide ();
+
+        // Se guardan los handles de los sprites que se van a usar frecuentemente:
+
+        right_arrow   =         r_arrow;
+        left_arrow    =         l_arrow;
+        Uparrow       =        up_arrow;
+        r_button      =      red_button;
+        p_icon        =      pause_icon;
+        h_life_1        =       heart_1;
+        h_life_2        =       heart_2;
+        h_life_3        =       heart_3;
+        blue_ball        =         blue;
+        yellow_ball        =         yellow;
+
+        create_particles ();
     }
 
     // ---------------------------------------------------------------------------------------------
@@ -340,9 +374,14 @@ namespace example
 
     void Game_Scene::restart_game()
     {
-        vidas = 3;
-        ast_ColisionaUnaVez = false; ast_ColisionaDosVeces = false; ast_ColisionaTresVeces  = false;
-        ast_Seguridad_1 = false; ast_Seguridad_2 = false; ast_Seguridad_3  = false;
+        simulation.restart ();
+
+        thrust_particles   .clear ();
+        explosion_particles.clear ();
+
+        const Sprite_Handle &   top_border = simulation.get_top_border   ();
+        const Sprite_Handle &  left_border = simulation.get_left_border  ();
+        const Sprite_Handle & right_border = simulation.get_right_border ();
 
         p_icon->set_position ({ (left_border->get_width())  + 50, canvas_height  - (top_border->get_height())  - 50 });
 
@@ -350,13 +389,9 @@ namespace example
         h_life_2->set_position ({ right_border->get_position_x() - 100, canvas_height  - (top_border->get_height())  - 50 });
         h_life_3->set_position ({ right_border->get_position_x() - 150, canvas_height  - (top_border->get_height())  - 50 });
 
-        ship->set_position ({ canvas_width - (canvas_width / 4.f), canvas_height / 2 });
-
-        bullet->set_position ({ -100 , 0  });
-
-        asteroid_1->set_position ({ canvas_width / 4.f, canvas_height / 2.f }); // posicion de inicio
-        asteroid_2->set_position ({ canvas_width / 3.f, canvas_height / 8.f }); // posicion de inicio
-        //asteroid->set_speed    ({ 0.f, 0.f });
+        h_life_1->show ();
+        h_life_2->show ();
+        h_life_3->show ();
 
         screen_touched = false;
 
@@ -367,26 +402,7 @@ namespace example
 
     void Game_Scene::start_playing ()
     {
-        // Se genera un vector de dirección al azar:
-
-        Vector2f random_direction_1
-        (
-            float(rand () % int(canvas_width ) - int(canvas_width  / 2)),
-            float(rand () % int(canvas_height) - int(canvas_height / 2))
-        );
-        Vector2f random_direction_2
-                (
-                        float(rand () % int(canvas_width ) - int(canvas_width  / 2)),
-                        float(rand () % int(canvas_height) - int(canvas_height / 2))
-                );
-
-        // Se hace unitario el vector y se multiplica un el valor de velocidad para que el vector
-        // resultante tenga exactamente esa longitud:
-
-        asteroid_1->set_speed (random_direction_1.normalized () * asteroid_speed_1);
-        asteroid_2->set_speed (random_direction_2.normalized () * asteroid_speed_2);
-
-        //asteroid->set_speed    ({ 200.f, 0.f });
+        simulation.start ();
 
         gameplay = PLAYING;
     }
@@ -395,23 +411,56 @@ namespace example
 
     void Game_Scene::run_simulation (float time)
     {
-        // Se actualiza el estado de todos los sprites:
+        // Se atienden todos los dedos que tocan la pantalla, de modo que se puede, por ejemplo,
+        // mover la nave y disparar a la vez:
 
-        for (auto & sprite : sprites)
+        const Touch_Surface::State & touch_state = director.get_touch_state ();
+
+        Controls controls;
+
+        for (int index = 0; index < touch_state.touch_count (); ++index)
         {
-            sprite->update (time);
+            const Touch_Surface::Touch & touch = touch_state.get_touch (index);
+
+            if (touch.down || touch.held)
+            {
+                controls.touching = true;
+                screen_touched    = true;
+                finger_position_x = touch.x;
+                finger_position_y = touch.y;
+
+                update_buttons (controls);
+            }
         }
 
-        update_pause_icon ();
-        update_movement_button ();
-        update_red_button ();
+        if (!controls.touching)
+        {
+            screen_touched = false;
+        }
+
+        // Las reglas del juego (movimiento, disparos y colisiones) las aplica la simulación. A la
+        // escena solo le queda representar lo que ha pasado:
+
+        simulation.step (time, controls);
+
+        update_effects ();
+
+        thrust_particles   .update (time);
+        explosion_particles.update (time);
+
+        if (simulation.is_game_over ())
+        {
+            restart_game ();
+        }
+    }
 
-        // Se comprueban las posibles colisiones de la nave y la bala con los bordes y asteroides:
+    // ---------------------------------------------------------------------------------------------
 
-        check_ship_collisions ();
-        check_bullet_collisions ();
-        check_asteroid_collisions ();
-        check_ship_life ();
+    void Game_Scene::update_buttons (Controls & controls)
+    {
+        update_pause_icon ();
+        update_movement_button (controls);
+        update_red_button (controls);
     }
 
     // ---------------------------------------------------------------------------------------------
@@ -421,8 +470,8 @@ namespace example
         // Se calcula la posisión entre la posición del dedo el icono de pausa, spawneando así una
         // el menu de pausa.
 
-        delta_x_pause_icon = finger_position_x - ((left_border->get_width()) + 50);
-        delta_y_pause_icon = finger_position_y - ((canvas_height  - (top_border->get_height()) - 50));
+        delta_x_pause_icon = finger_position_x - ((simulation.get_left_border ()->get_width()) + 50);
+        delta_y_pause_icon = finger_position_y - ((canvas_height  - (simulation.get_top_border ()->get_height()) - 50));
 
         if(screen_touched == true)
         {
@@ -435,12 +484,10 @@ namespace example
     }
 
     // ---------------------------------------------------------------------------------------------
-    // Se hace que el jugador se mueva hacia arriba, derecha o izquierda según el usuario esté
-    // tocando los botones correspondientes respecto de su centro. Cuando el usuario no toca la
-    // pantalla se deja al player quieto.
-
+    // Se comprueba si el usuario está tocando los botones de movimiento respecto de su centro. Lo
+    // que hace la nave con esas órdenes (y cuando no se toca la pantalla) lo decide la simulación.
 
-    void Game_Scene::update_movement_button ()
+    void Game_Scene::update_movement_button (Controls & controls)
     {
         // Se calcula la posisión entre la posición del dedo y los distintos botones de movimiento,
         // dejando un area de interacción sobre ellos para que se puedan detectar correctamente
@@ -454,152 +501,31 @@ namespace example
         delta_x_l_button = finger_position_x - (canvas_width - (left_arrow->get_height() / 2) - 1050);
         delta_y_l_button = finger_position_y - ((left_arrow->get_width() / 2) + 35);
 
-        // -----------------------------------------------------------------------------------------
-
-        vector_x_point_ref = (100 - ship->get_position_x() - ship->get_width() / 2);
-        vector_y_point_ref = (0 - ship->get_position_y());
-
-        Vector2f vector_ref (vector_x_point_ref, vector_y_point_ref);
-
-        float ProductoVectorial_x = (vector_x_point_ref) * (delta_x_ship_vector);
-        float ProductoVectorial_y = (vector_y_point_ref) * (delta_y_ship_vector);
-        float ProductoVectorial_total = (ProductoVectorial_x) + (ProductoVectorial_y);
-
-        float raiz_vector_1 = (abs(sqrt(pow((vector_x_point_ref),2.0) + pow((vector_y_point_ref),2.0))));
-        float raiz_vector_2 = (abs(sqrt(pow((delta_x_ship_vector),2.0) + pow((delta_y_ship_vector),2.0))));
-        float multipicacion_raices_vectores = raiz_vector_1 * raiz_vector_2;
-
-        float cos_alfa = ProductoVectorial_total / multipicacion_raices_vectores;
-        float angulo_nave = acos(cos_alfa);
-
-        // -----------------------------------------------------------------------------------------
-
         if(screen_touched == true)
         {
             if ((abs(delta_x_mov_button) < 50) && (abs(delta_y_mov_button) < 50))
             {
-                update_ship_vector ();
+                controls.thrust = true;
             }
 
             if ((abs(delta_x_r_button) < 50) && (abs(delta_y_r_button) < 50))
             {
-                ship->set_speed_y({ -ship_speed / 3});
-
-                //Rotate Ship right
-                /*
-                if(angulo_nave >= 0 && angulo_nave < 45 )
-                {
-                    blue_ball->set_position ({ 4000, 2000 });
-                }
-                else if(angulo_nave >= 45 && angulo_nave < 90 )
-                {
-                    blue_ball->set_position ({ 2000, 4000 });
-                }
-
-                if(angulo_nave < 0 && angulo_nave >= 315 )
-                {
-                    blue_ball->set_position ({ 4000, -2000 });
-                }
-                else if(angulo_nave >= 270 && angulo_nave < 315 )
-                {
-                    blue_ball->set_position ({ 2000, -4000 });
-                }
-                 */
+                controls.turn_right = true;
             }
 
             if ((abs(delta_x_l_button) < 50) && (abs(delta_y_l_button) < 50))
             {
-                ship->set_speed_y({ ship_speed / 3});
-
-                //Rotate Ship left
-                /*
-                if(angulo_nave >= 90 && angulo_nave < 135 )
-                {
-                    blue_ball->set_position ({ -2000, 4000 });
-                }
-                else if(angulo_nave >= 135 && angulo_nave < 180 )
-                {
-                    blue_ball->set_position ({ -4000, 2000 });
-                }
-
-                if(angulo_nave >= 180 && angulo_nave < 225 )
-                {
-                    blue_ball->set_position ({ -4000, -2000 });
-                }
-                else if(angulo_nave >= 225 && angulo_nave < 270 )
-                {
-                    blue_ball->set_position ({ -2000, -4000 });
-                }
-                 */
-            }
-        }
-        else
-        {
-            if (delta_x_ship_vector > 0)
-            {
-                ship->set_speed_x({ ship_speed / 3});
-            }
-            else if (delta_x_ship_vector < 0)
-            {
-                ship->set_speed_x({ -ship_speed / 3});
+                controls.turn_left = true;
             }
-
-            if (delta_y_ship_vector > 0)
-            {
-                ship->set_speed_y({ ship_speed / 3});
-            }
-            else if (delta_x_ship_vector < 0)
-            {
-                ship->set_speed_y({ -ship_speed / 3});
-            }
-        }
-    }
-
-    // ---------------------------------------------------------------------------------------------
-
-    void Game_Scene::update_ship_vector ()
-    {
-        blue_ball->hide();   // Punto utilizados para realizar pruebas
-        yellow_ball->hide(); // Punto utilizados para realizar pruebas
-
-        blue_ball->set_scale(0.5);
-        yellow_ball->set_scale(0.5);
-
-        blue_ball->set_position ({ ship->get_position_x() + ship->get_width() / 2, ship->get_position_y() });
-        yellow_ball->set_position ({ ship->get_position_x() - ship->get_width() / 2, ship->get_position_y() });
-
-        delta_x_ship_vector = (ship->get_position_x() + ship->get_width() / 2) - (ship->get_position_x() - ship->get_width() / 2);
-        delta_y_ship_vector = (ship->get_position_y()) - (ship->get_position_y());
-
-        Vector2f ship_vector (delta_x_ship_vector, delta_y_ship_vector);
-
-        ship->set_speed (ship_vector.normalized () * ship_speed); // El vector se hace unitario
-
-        if (delta_x_ship_vector > 0)
-        {
-            ship->set_speed_x({ ship_speed });
-        }
-        else if (delta_x_ship_vector < 0)
-        {
-            ship->set_speed_x({ -ship_speed });
-        }
-
-        if (delta_y_ship_vector > 0)
-        {
-            ship->set_speed_y({ ship_speed });
-        }
-        else if (delta_x_ship_vector < 0)
-        {
-            ship->set_speed_y({ -ship_speed });
         }
     }
 
     // ---------------------------------------------------------------------------------------------
 
-    void Game_Scene::update_red_button ()
+    void Game_Scene::update_red_button (Controls & controls)
     {
-        // Se calcula la posisión entre la posición del dedo el botón de disparo, creando así una
-        // bala en la posición de la nave cada vez que se pulse este.
+        // Se calcula la posisión entre la posición del dedo el botón de disparo, de modo que la
+        // simulación cree una bala en la posición de la nave mientras se pulse este.
 
         delta_x_red_button = finger_position_x - (canvas_width - (r_button->get_height() / 2) - 27);
         delta_y_red_button = finger_position_y - ((r_button->get_width() / 2) + 27);
@@ -608,204 +534,107 @@ namespace example
         {
             if ((abs(delta_x_red_button) < 50) && (abs(delta_y_red_button) < 50))
             {
-                //ship->set_speed_y (-ship_speed);
-
-                bullet->set_position ({ ship->get_position_x (), ship->get_position_y () }); //donde spawnea
-                bullet->set_speed    ({ bullet_speed, 0.f });
+                controls.fire = true;
             }
         }
     }
 
     // ---------------------------------------------------------------------------------------------
 
-    void Game_Scene::check_ship_collisions ()
+    void Game_Scene::update_effects ()
     {
-        // Se comprueba si la nave coliciona con el borde superior, inferior, derecho e izquierdo,
-        // en cuyo caso se ajusta su posición para que lo atraviese y aparezca en su borde opuesto.
-
-        if (ship->intersects (*top_border))
-        {
-            ship->set_position_y (bottom_border->get_top_y() + 40);
-        }
-        else if (ship->intersects (*bottom_border))
-        {
-            ship->set_position_y (top_border->get_bottom_y () - 40);
-        }
+        // Las vidas que se muestran son las que le quedan al jugador:
 
-        if (ship->intersects (*right_border))
-        {
-            ship->set_position_x (left_border->get_right_x() + 40);
-        }
-        else if (ship->intersects (*left_border))
-        {
-            ship->set_position_x (right_border->get_left_x() - 40);
-        }
-    }
-
-    // ---------------------------------------------------------------------------------------------
-
-    void Game_Scene::check_bullet_collisions ()
-    {
-        // Se comprueba si la bala coliciona con algún asteroide, entonces se reinicia la partida.
-
-        if (bullet->intersects (*asteroid_1))
-        {
-            //spawn_mini_asteroids();
-            asteroid_1->hide();
-            bullet->set_position ({ -100 , 0  }); //Destroy(bullet);
-        }
-        else if (bullet->intersects (*asteroid_2))
-        {
-            //spawn_mini_asteroids();
-            asteroid_2->hide();
-            bullet->set_position ({ -100 , 0  }); //Destroy(bullet);
-        }
-
-        // Se comprueba si la bala coliciona con el borde superior, inferior, derecho e izquierdo,
-        // en cuyo caso se ajusta su posición para que lo atraviese y aparezca en su borde opuesto.
-
-        if (bullet->intersects (*top_border))
-        {
-            //bullet->set_position_y (bottom_border->get_top_y() + 40);
-            bullet->set_position ({ -100 , 0  }); //Destroy(bullet);
-        }
-        else if (bullet->intersects (*bottom_border))
-        {
-            //bullet->set_position_y (top_border->get_bottom_y () - 40);
-            bullet->set_position ({ -100 , 0  }); //Destroy(bullet);
-        }
-
-        if (bullet->intersects (*right_border))
-        {
-            //bullet->set_position_x (left_border->get_right_x() + 40);
-            bullet->set_position ({ -100 , 0  }); //Destroy(bullet);
-        }
-        else if (bullet->intersects (*left_border))
-        {
-            //bullet->set_position_x (right_border->get_left_x() - 40);
-            bullet->set_position ({ -100 , 0  }); //Destroy(bullet);
-        }
-    }
+        int lives = simulation.get_lives ();
 
-    // ---------------------------------------------------------------------------------------------
+        if (lives < 3) h_life_3->hide ();
+        if (lives < 2) h_life_2->hide ();
+        if (lives < 1) h_life_1->hide ();
 
-    void Game_Scene::check_asteroid_collisions ()
-    {
-        // Se comprueba si algún asteroide coliciona con la nave.
+        // La estela sale de la parte trasera de la nave en sentido contrario a su movimiento:
 
-        if ((asteroid_1->intersects (*ship) || asteroid_2->intersects (*ship)) && ast_Seguridad_3 == false && vidas == 3)
-        {
-            ast_ColisionaUnaVez = true;
-        }
-        else if (asteroid_1->intersects (*ship) && ast_Seguridad_2 == true && vidas == 2)
-        {
-            ast_ColisionaDosVeces = true;
-        }
-        else if ((asteroid_1->intersects (*ship) || asteroid_2->intersects (*ship)) && ast_Seguridad_1 == true && vidas == 1)
-        {
-            ast_ColisionaTresVeces = true;
-        }
+        const Sprite_Handle & ship = simulation.get_ship ();
 
-        // Se comprueba si algún asteroide coliciona con algún borde, en cuyo caso se ajusta su
-        //  posición para que lo atraviese y aparezca en su borde opuesto.
+        Vector2f ship_speed_vector = ship->get_speed ();
+        float    ship_speed_length = ship_speed_vector.length ();
 
-        if (asteroid_1->intersects (*top_border))
-        {
-            asteroid_1->set_position_y (bottom_border->get_top_y() + 40);
-        }
-        else if (asteroid_1->intersects (*bottom_border))
-        {
-            asteroid_1->set_position_y (top_border->get_bottom_y () - 40);
-        }
+        thrust_particles.set_emitting (gameplay == PLAYING && ship_speed_length > 0.f);
 
-        if (asteroid_1->intersects (*right_border))
+        if (ship_speed_length > 0.f)
         {
-            asteroid_1->set_position_x (left_border->get_right_x() + 40);
-        }
-        else if (asteroid_1->intersects (*left_border))
-        {
-            asteroid_1->set_position_x (right_border->get_left_x() - 40);
-        }
-
+            Vector2f backwards = ship_speed_vector * (-1.f / ship_speed_length);
 
+            thrust_particles.set_position
+            ({
+                ship->get_position_x () + backwards[0] * ship->get_width () * .5f,
+                ship->get_position_y () + backwards[1] * ship->get_width () * .5f
+            });
 
-        if (asteroid_2->intersects (*top_border))
-        {
-            asteroid_2->set_position_y (bottom_border->get_top_y() + 40);
-        }
-        else if (asteroid_2->intersects (*bottom_border))
-        {
-            asteroid_2->set_position_y (top_border->get_bottom_y () - 40);
+            thrust_particles.get_settings ().direction = fast::atan2 (backwards[1], backwards[0]);
         }
 
-        if (asteroid_2->intersects (*right_border))
-        {
-            asteroid_2->set_position_x (left_border->get_right_x() + 40);
-        }
-        else if (asteroid_2->intersects (*left_border))
-        {
-            asteroid_2->set_position_x (right_border->get_left_x() - 40);
-        }
+        explode (simulation.get_explosions ());
     }
 
     // ---------------------------------------------------------------------------------------------
 
-    void Game_Scene::check_ship_life () {
-        // Se comprueba si la nave debe perder sus vidas hasta reinicia la partida.
-
-        if (ast_ColisionaUnaVez)
-        {
-            vidas = 2;
-            h_life_3->hide();
-
-            ast_Seguridad_3 = true; // impide volver a entrar en el mismo
-            ast_ColisionaUnaVez = false;
-
-            ast_Seguridad_2 = true;
-        }
-        else if (ast_ColisionaDosVeces)
-        {
-            vidas = 1;
-            h_life_2->hide();
-
-            ast_Seguridad_2 = false; // impide volver a entrar en el mismo
-            ast_ColisionaDosVeces = false;
-
-            ast_Seguridad_1 = true; // permite avanzar una posición
-        }
-        else if (ast_ColisionaTresVeces)
-        {
-            vidas = 0;
-            h_life_1->hide();
-
-            ast_Seguridad_1 = false; // impide volver a entrar en el mismo
-            ast_ColisionaTresVeces = false; // permite avanzar una posición
-
-            restart_game();
-        }
+    void Game_Scene::create_particles ()
+    {
+        // Ambos emisores usan la textura de la bala con mezcla aditiva, de modo que las partículas
+        // que se superponen brillan más:
+
+        Particle_Emitter::Settings thrust;
+
+        thrust.texture      = textures[ID(bullet)].get ();
+        thrust.rate         = 120.f;
+        thrust.min_lifetime = .2f;
+        thrust.max_lifetime = .4f;
+        thrust.min_speed    = 60.f;
+        thrust.max_speed    = 120.f;
+        thrust.spread       = .6f;
+        thrust.drag         = 2.f;
+        thrust.start_size   = 12.f;
+        thrust.end_size     = 2.f;
+        thrust.start_color[0] = 1.f;  thrust.start_color[1] = .8f; thrust.start_color[2] = .3f; thrust.start_color[3] = 1.f;
+        thrust.end_color  [0] = 1.f;  thrust.end_color  [1] = .2f; thrust.end_color  [2] = 0.f; thrust.end_color  [3] = 0.f;
+
+        Particle_Emitter::Settings explosion;
+
+        explosion.texture      = textures[ID(bullet)].get ();
+        explosion.min_lifetime = .4f;
+        explosion.max_lifetime = .9f;
+        explosion.min_speed    = 80.f;
+        explosion.max_speed    = 320.f;
+        explosion.drag         = 1.5f;
+        explosion.start_size   = 18.f;
+        explosion.end_size     = 4.f;
+        explosion.start_color[0] = 1.f;  explosion.start_color[1] = .9f; explosion.start_color[2] = .6f; explosion.start_color[3] = 1.f;
+        explosion.end_color  [0] = .8f;  explosion.end_color  [1] = .3f; explosion.end_color  [2] = .1f; explosion.end_color  [3] = 0.f;
+
+        thrust_particles   .set_settings (thrust   );
+        explosion_particles.set_settings (explosion);
+
+        thrust_particles   .set_seed (simulation.random_seed ());
+        explosion_particles.set_seed (simulation.random_seed ());
     }
 
     // ---------------------------------------------------------------------------------------------
 
-    void Game_Scene::spawn_mini_asteroids ()
+    void Game_Scene::explode (const std::vector< Game_Simulation::Explosion > & explosions)
     {
-        /*
-        int ast_width = rand () % int(asteroid->get_width() / 2);
-        int ast_height = rand () % int(asteroid->get_width() / 2);
-
-        Sprite_Handle          mini_asteroid(new Sprite( textures[ID(mini_asteroid)].get () ));
-
-        mini_asteroid->set_position ({  asteroid->get_position_x (), asteroid->get_position_y () });
-
-        Vector2f ast_direction (float(rand () % int(ast_width)), float(rand () % int(ast_height)));
-
-        mini_asteroid->set_speed (ast_direction.normalized () * asteroid_speed);
+        for (auto & explosion : explosions)
+        {
+            unsigned amount = 0;
 
-        mini_asteroid->set_speed    ({ 0.f, 0.f });
+            switch (explosion.kind)
+            {
+                case Game_Simulation::ASTEROID_SPLIT:     amount = 48; break;
+                case Game_Simulation::FRAGMENT_DESTROYED: amount = 16; break;
+                case Game_Simulation::SHIP_HIT:           amount = 64; break;
+            }
 
-        bullet->set_position ({ ship->get_position_x (), ship->get_position_y () }); //donde spawnea
-        bullet->set_speed    ({ 100.f, 0.f });
-         */
+            explosion_particles.emit (explosion.position, amount, explosion.speed * .25f);
+        }
     }
 
     // ---------------------------------------------------------------------------------------------
@@ -826,33 +655,26 @@ namespace example
     }
 
     // ---------------------------------------------------------------------------------------------
-    // Simplemente se dibujan todos los sprites que conforman la escena.
+    // Se dibujan todos los sprites que conforman la escena y, encima, las partículas (cada emisor
+    // con una sola llamada de dibujo).
 
     void Game_Scene::render_playfield (Canvas & canvas)
     {
-        for (auto & sprite : sprites)
-        {
-            sprite->render (canvas);
-        }
+        sprites.render (canvas);
+
+        thrust_particles   .render (canvas);
+        explosion_particles.render (canvas);
     }
 
     // ---------------------------------------------------------------------------------------------
 
     void Game_Scene::render_pause_menu ()
     {
-        // Se crean los Sprites necesarios para el menu de pausa:
+        // Se muestran los sprites del menú de pausa (creados en create_sprites()):
 
-        Sprite_Handle         pause_menu(new Sprite( textures[ID(pause_menu)].get () ));
-        Sprite_Handle         resume_button(new Sprite( textures[ID(resume_button)].get () ));
-        Sprite_Handle         exit_button(new Sprite( textures[ID(exit_button)].get () ));
-
-        sprites.push_back      (pause_menu);
-        sprites.push_back      (resume_button);
-        sprites.push_back      (exit_button);
-
-        p_menu = pause_menu.get ();
-        res_button = resume_button.get ();
-        ext_button = exit_button.get ();
+        p_menu    ->show ();
+        res_button->show ();
+        ext_button->show ();
 
         p_menu->set_position ({ canvas_width / 2, canvas_height  / 2 });
         res_button->set_position ({ canvas_width / 2, canvas_height  / 2 });
@@ -871,7 +693,9 @@ namespace example
             {
                 //resume();
                 //state = RUNNING;
-                director.run_scene (shared_ptr< Scene >(new Game_Scene));
+                shared_ptr< Scene > game_scene = director.get_cached_scene (ID(game-scene));
+
+                director.run_scene (game_scene ? game_scene : make_shared< Game_Scene > ());
             }
 
             delta_x_ext_button = finger_position_x - (canvas_width / 2);
@@ -880,7 +704,14 @@ namespace example
             if ((abs(delta_x_ext_button) < 150) && (abs(delta_y_ext_button) < 50))
             {
                 //suspend ();
-                director.run_scene (shared_ptr< Scene >(new Menu_Scene));
+                shared_ptr< Scene > menu_scene = director.get_cached_scene (ID(menu-scene));
+
+                if (!menu_scene)
+                {
+                    director.cache_scene (ID(menu-scene), menu_scene = make_shared< Menu_Scene > ());
+                }
+
+                director.run_scene (menu_scene);
             }
         }
     }
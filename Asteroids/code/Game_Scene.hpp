@@ -14,19 +14,24 @@
     #include <map>
     #include <list>
     #include <memory>
+    #include <vector>
 
+    #include <basics/Alpha_Mask>
     #include <basics/Canvas>
+    #include <basics/Color_Buffer>
     #include <basics/Id>
+    #include <basics/Particle_Emitter>
     #include <basics/Scene>
+    #include <basics/Sprite_Pool>
     #include <basics/Texture_2D>
-    #include <basics/Timer>
+    #include <basics/Touch_Surface>
+
+    #include "Game_Simulation.hpp"
 
-    #include "Sprite.hpp"
 
     namespace example
     {
         using basics::Id;
-        using basics::Timer;
         using basics::Canvas;
         using basics::Texture_2D;
 
@@ -34,11 +39,22 @@
         {
             // Estos typedefs pueden ayudar a hacer el código más compacto y claro:
 
-            typedef std::shared_ptr < Sprite     >     Sprite_Handle;
-            typedef std::list< Sprite_Handle     >     Sprite_List;
+            typedef basics::Sprite_Pool::Handle        Sprite_Handle;
             typedef std::shared_ptr< Texture_2D  >     Texture_Handle;
             typedef std::map< Id, Texture_Handle >     Texture_Map;
+            typedef std::map< Id, basics::Alpha_Mask > Alpha_Mask_Map;
             typedef basics::Graphics_Context::Accessor Context;
+            typedef Game_Simulation::Controls          Controls;
+
+            /**
+             * Imagen decodificada en segundo plano por preload() a la espera de subirse como textura.
+             */
+            struct Decoded_Texture
+            {
+                basics::Color_Buffer< basics::Rgba8888 > color_buffer;
+                Texture_2D::Options                      options;
+                basics::Alpha_Mask                       alpha_mask;
+            };
 
             /**
              * Representa el estado de la escena en su conjunto.
@@ -67,7 +83,14 @@
             /**
              * Array de estructuras con la información de las texturas (Id y ruta) que hay que cargar.
              */
-            static struct   Texture_Data { Id id; const char * path; } textures_data[];
+            static struct   Texture_Data { Id id; const char * path; unsigned mask_reduction; } textures_data[];
+
+            /**
+             * Reducción con la que se calculan las siluetas de los sprites que colisionan (cada bit
+             * cubre 2x2 píxeles). Debe ser la misma para todos para que las comparaciones se hagan
+             * palabra a palabra (ver Alpha_Mask::overlap_count()).
+             */
+            static constexpr unsigned shape_reduction = 2;
 
             /**
              * Número de items que hay en el array textures_data.
@@ -76,11 +99,6 @@
 
         private:
 
-            static constexpr float asteroid_speed_1 =  200.f;      ///< Velocidad a la que se mueve el asteroide_1 (en unideades virtuales por segundo).
-            static constexpr float asteroid_speed_2 =  100.f;      ///< Velocidad a la que se mueve el asteroide_2 (en unideades virtuales por segundo).
-            static constexpr float     ship_speed   =  500.f;      ///< Velocidad a la que se mueve la nave (en unideades virtuales por segundo).
-            static constexpr float   bullet_speed   = 2000.f;      ///< Velocidad a la que se mueve la bala (en unideades virtuales por segundo).
-
             static constexpr float     gravity = 20.f;
             static constexpr float     rotation_speed = 10.f;
             static constexpr float     thrust_power = 100.f;
@@ -94,40 +112,32 @@
             unsigned       canvas_width;                        ///< Ancho de la resolución virtual usada para dibujar.
             unsigned       canvas_height;                       ///< Alto  de la resolución virtual usada para dibujar.
 
+            std::vector< Decoded_Texture > decoded_textures;    ///< Imágenes decodificadas por preload() en el orden de textures_data.
             Texture_Map    textures;                            ///< Mapa  en el que se guardan shared_ptr a las texturas cargadas.
-            Sprite_List    sprites;                             ///< Lista en la que se guardan shared_ptr a los sprites creados.
-
-            Sprite       *    background;                       ///< Puntero al sprite de la lista de sprites que representa fondo de la ezcena.
-            Sprite       *    top_border;                       ///< Puntero al sprite de la lista de sprites que representa el borde superior.
-            Sprite       * bottom_border;                       ///< Puntero al sprite de la lista de sprites que representa el borde inferior.
-            Sprite       *   left_border;                       ///< Puntero al sprite de la lista de sprites que representa el borde izquierdo.
-            Sprite       *  right_border;                       ///< Puntero al sprite de la lista de sprites que representa el borde derecho.
-            Sprite       *    asteroid_1;                       ///< Puntero al sprite de la lista de sprites que representa el asteroide_1.
-            Sprite       *    asteroid_2;                       ///< Puntero al sprite de la lista de sprites que representa el asteroide_1.
-            Sprite       *   right_arrow;                       ///< Puntero al sprite de la lista de sprites que representa el botón de girar derecha.
-            Sprite       *    left_arrow;                       ///< Puntero al sprite de la lista de sprites que representa el botón de girar izquierda.
-            Sprite       *       Uparrow;                       ///< Puntero al sprite de la lista de sprites que representa el botón de moverse.
-            Sprite       *      r_button;                       ///< Puntero al sprite de la lista de sprites que representa el botón de disparar.
-            Sprite       *          ship;                       ///< Puntero al sprite de la lista de sprites que representa la nave.
-            Sprite       *        bullet;                       ///< Puntero al sprite de la lista de sprites que representa la bala.
-            Sprite       *      h_life_1;                       ///< Puntero al sprite de la lista de sprites que representa la vida nº 1.
-            Sprite       *      h_life_2;                       ///< Puntero al sprite de la lista de sprites que representa la vida nº 2.
-            Sprite       *      h_life_3;                       ///< Puntero al sprite de la lista de sprites que representa la vida nº 3.
-            Sprite       *     blue_ball;                       ///< Puntero al sprite de la lista de sprites que representa la bala.
-            Sprite       *     yellow_ball;                       ///< Puntero al sprite de la lista de sprites que representa la bala.
-
-            Sprite       *        p_icon;                       ///< Puntero al sprite de la lista de sprites que representa el icono de pausa.
-            Sprite       *        p_menu;                       ///< Puntero al sprite de la lista de sprites que representa fondo del menú de pausa.
-            Sprite       *    res_button;                       ///< Puntero al sprite de la lista de sprites que representa el botón de resume.
-            Sprite       *    ext_button;                       ///< Puntero al sprite de la lista de sprites que representa el botón de exit.
-
-            int               vidas = 3;                        ///< Número de vidas de jugador inicialmente.
-            bool    ast_ColisionaUnaVez = false;                ///< false hasta que el asteroide no colisione 1 vez con la nave.
-            bool  ast_ColisionaDosVeces = false;                ///< false hasta que el asteroide no colisione 2 vez con la nave.
-            bool ast_ColisionaTresVeces = false;                ///< false hasta que el asteroide no colisione 3 vez con la nave.
-            bool        ast_Seguridad_1 = false;                ///< nivel de seguridad 1 es false hasta que no se reinicie el juego.
-            bool        ast_Seguridad_2 = false;                ///< nivel de seguridad 2 es false hasta que no se reinicie el juego.
-            bool        ast_Seguridad_3 = false;                ///< nivel de seguridad 3 es false hasta que no se reinicie el juego.
+            Alpha_Mask_Map alpha_masks;                         ///< Siluetas de las texturas cargadas (para las colisiones).
+            bool           textures_reused;                     ///< true si al iniciar la escena ya tenía todas sus texturas cargadas.
+            basics::Sprite_Pool sprites;                        ///< Pool en el que se guardan los sprites creados (en el orden de dibujado).
+
+            Game_Simulation simulation;                         ///< Reglas del juego (usa el pool sprites para sus sprites).
+
+            basics::Particle_Emitter thrust_particles;          ///< Estela que deja la nave al moverse.
+            basics::Particle_Emitter explosion_particles;       ///< Chispas de los asteroides rotos y de los choques con la nave.
+
+            Sprite_Handle     background;                       ///< Handle del sprite del pool que representa fondo de la ezcena.
+            Sprite_Handle    right_arrow;                       ///< Handle del sprite del pool que representa el botón de girar derecha.
+            Sprite_Handle     left_arrow;                       ///< Handle del sprite del pool que representa el botón de girar izquierda.
+            Sprite_Handle        Uparrow;                       ///< Handle del sprite del pool que representa el botón de moverse.
+            Sprite_Handle       r_button;                       ///< Handle del sprite del pool que representa el botón de disparar.
+            Sprite_Handle       h_life_1;                       ///< Handle del sprite del pool que representa la vida nº 1.
+            Sprite_Handle       h_life_2;                       ///< Handle del sprite del pool que representa la vida nº 2.
+            Sprite_Handle       h_life_3;                       ///< Handle del sprite del pool que representa la vida nº 3.
+            Sprite_Handle      blue_ball;                       ///< Handle del sprite del pool que representa la bala.
+            Sprite_Handle      yellow_ball;                       ///< Handle del sprite del pool que representa la bala.
+
+            Sprite_Handle         p_icon;                       ///< Handle del sprite del pool que representa el icono de pausa.
+            Sprite_Handle         p_menu;                       ///< Handle del sprite del pool que representa fondo del menú de pausa.
+            Sprite_Handle     res_button;                       ///< Handle del sprite del pool que representa el botón de resume.
+            Sprite_Handle     ext_button;                       ///< Handle del sprite del pool que representa el botón de exit.
 
             bool   screen_touched_mov;                          ///< true si el usuario está tocando mientras se mueve por la pantalla.
             bool       screen_touched;                          ///< true si el usuario está tocando la pantalla.
@@ -137,10 +147,6 @@
             float ship_angle_right;                             ///< Ángulo de giro hacia la derecha de la nave.
             float  ship_angle_left;                             ///< Ángulo de giro hacia la izquierda de la nave.
 
-            float  vector_x_point_ref;                           ///< Vector x desde el punto de referencia (100, 0).
-            float  vector_y_point_ref;                           ///< Vector x desde el punto de referencia (100, 0).
-            float delta_x_ship_vector;                           ///< Distancia entre la punta de la nave y la base en el eje X.
-            float delta_y_ship_vector;                           ///< Distancia entre la punta de la nave y la base en el eje Y.
             float  delta_x_pause_icon;                           ///< Distancia entre el dedo del usuario y la posición X del icono de pausa.
             float  delta_y_pause_icon;                           ///< Distancia entre el dedo del usuario y la posición Y del icono de pausa.
             float  delta_x_res_button;                           ///< Distancia entre el dedo del usuario y la posición X del botón de resume.
@@ -156,7 +162,7 @@
             float    delta_x_l_button;                           ///< Distancia entre el dedo del usuario y la posición X del botón de girar izquierda.
             float    delta_y_l_button;                           ///< Distancia entre el dedo del usuario y la posición Y del botón de girar izquierda.
 
-            Timer          timer;                               ///< Cronómetro usado para medir intervalos de tiempo
+            float          loading_time;                        ///< Segundos de simulación transcurridos desde que empezó la carga.
 
         public:
 
@@ -176,6 +182,13 @@
                 return { canvas_width, canvas_height };
             }
 
+            /**
+             * Lee y decodifica las imágenes de las texturas en un hilo secundario (lo llama Director)
+             * para que load_textures() solo tenga que subirlas al contexto gráfico.
+             * @return false si alguna imagen no se ha podido cargar.
+             */
+            bool preload () override;
+
             /**
              * Aquí se inicializan los atributos que deben restablecerse cada vez que se inicia la escena.
              * @return
@@ -194,9 +207,9 @@
 
             /**
              * Este método se invoca automáticamente una vez por fotograma cuando se acumulan
-             * eventos dirigidos a la escena.
+             * eventos táctiles dirigidos a la escena.
              */
-            void handle (basics::Event & event) override;
+            void handle_touch (basics::Touch_Event & touch) override;
 
             /**
              * Este método se invoca automáticamente una vez por fotograma para que la escena
@@ -213,8 +226,9 @@
         private:
 
             /**
-             * En este método se cargan las texturas (una cada fotograma para facilitar que la
-             * propia carga se pueda pausar cuando la aplicación pasa a segundo plano).
+             * En este método se suben las texturas decodificadas por preload() (una cada fotograma
+             * para facilitar que la propia carga se pueda pausar cuando la aplicación pasa a segundo
+             * plano).
              */
             void load_textures ();
 
@@ -223,6 +237,17 @@
              */
             void create_sprites ();
 
+            /**
+             * Retorna la textura cargada con el id indicado junto con su tamaño y su silueta, tal
+             * como las espera Game_Simulation::create().
+             */
+            Game_Simulation::Look look (Id id)
+            {
+                Texture_2D * texture = textures[id].get ();
+
+                return { texture, { float(texture->get_width ()), float(texture->get_height ()) }, &alpha_masks[id] };
+            }
+
             /**
              * Se llama cada vez que se debe reiniciar el juego. En concreto la primera vez y cada
              * vez que un jugador pierde.
@@ -231,7 +256,7 @@
 
             /**
              * Cuando se ha reiniciado el juego y el usuario toca la pantalla por primera vez se
-             * pone la bola en movimiento en una dirección al azar.
+             * ponen los asteroides en movimiento en una dirección al azar.
              */
             void start_playing ();
 
@@ -241,49 +266,42 @@
             void run_simulation (float time);
 
             /**
-             * Spawnea el menú de pausa si se pulsa sobre su icono.
+             * Comprueba qué botones se pulsan con el dedo situado en finger_position_x/y y añade
+             * las órdenes correspondientes a controls.
              */
-            void update_pause_icon ();
+            void update_buttons (Controls & controls);
 
             /**
-             * Se checkea mediante el input de botones si el usuario quiere moverse.
+             * Spawnea el menú de pausa si se pulsa sobre su icono.
              */
-            void update_movement_button ();
+            void update_pause_icon ();
 
             /**
-             * Se calcula el vector forward de la nave.
+             * Se checkea mediante el input de botones si el usuario quiere moverse.
              */
-            void update_ship_vector ();
+            void update_movement_button (Controls & controls);
 
             /**
              * Ejecuta la función de disparar de la nave.
              */
-            void update_red_button ();
-
-            /**
-             * Comprueba las colisiones del asteroide con el escenario.
-             */
-            void check_ship_collisions ();
-
-            /**
-             * Comprueba las colisiones del asteroide con el escenario y con los asteroides.
-             */
-            void check_bullet_collisions ();
+            void update_red_button (Controls & controls);
 
             /**
-             * Comprueba las colisiones del asteroide con el escenario y con la nave.
+             * Actualiza las vidas que se muestran, las partículas de la nave y las explosiones a
+             * partir del último paso de la simulación.
              */
-            void check_asteroid_collisions ();
+            void update_effects ();
 
             /**
-             * Comprueba la nave tiene que perder vidas cuando choca con asteroides.
+             * Configura los emisores de partículas (se llama al crear los sprites porque necesitan
+             * las texturas ya cargadas).
              */
-            void check_ship_life ();
+            void create_particles ();
 
             /**
-             * Se spawnean los pequeños sprites de los asteroids si una bala colisiona previamente.
+             * Lanza una ráfaga de chispas por cada explosión del último paso de la simulación.
              */
-            void spawn_mini_asteroids ();
+            void explode (const std::vector< Game_Simulation::Explosion > & explosions);
 
             /**
              * Dibuja la textura con el mensaje de carga mientras el estado de la escena es LOADING.
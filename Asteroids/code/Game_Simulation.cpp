@@ -0,0 +1,687 @@
+/*
+ * GAME SIMULATION
+ * Copyright © 2021+ Marcelo López de lErma
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * marcelolopezdelerma@gmail.com
+ */
+
+#include "Game_Simulation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <basics/Fast_Math>
+#include <basics/Timer>
+
+using namespace basics;
+using namespace std;
+
+namespace example
+{
+
+    // ---------------------------------------------------------------------------------------------
+    // Definiciones de los atributos estáticos de la clase:
+
+    constexpr unsigned Game_Simulation::     max_bullets;
+    constexpr unsigned Game_Simulation::   max_fragments;
+    constexpr float    Game_Simulation::asteroid_speed_1;
+    constexpr float    Game_Simulation::asteroid_speed_2;
+    constexpr float    Game_Simulation::      ship_speed;
+    constexpr float    Game_Simulation::    bullet_speed;
+    constexpr float    Game_Simulation::   bullet_period;
+    constexpr float    Game_Simulation:: fragment_spread;
+
+    // ---------------------------------------------------------------------------------------------
+    // Tamaños de las imágenes de assets/game-scene:
+
+    Game_Simulation::Assets Game_Simulation::Assets::headless ()
+    {
+        Assets assets;
+
+        assets.h_bar         = { nullptr, { 1280.f, 15.f }, nullptr };
+        assets.v_bar         = { nullptr, {   15.f, 720.f }, nullptr };
+        assets.asteroid      = { nullptr, {   80.f,  61.f }, nullptr };
+        assets.mini_asteroid = { nullptr, {   40.f,  40.f }, nullptr };
+        assets.ship          = { nullptr, {   85.f,  63.f }, nullptr };
+        assets.bullet        = { nullptr, {   10.f,  10.f }, nullptr };
+
+        return assets;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    Game_Simulation::Game_Simulation(Sprite_Pool & sprites, float width, float height)
+    :
+        sprites(sprites),
+        width  (width  ),
+        height (height )
+    {
+        bullet_cooldown     = 0.f;
+        delta_x_ship_vector = 0.f;
+        delta_y_ship_vector = 0.f;
+        ship_angle          = 0.f;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::create (const Assets & assets)
+    {
+        // Si la escena se reinicia (ver Game_Scene::initialize()) se crean de nuevo los sprites, por
+        // lo que se descartan los cuerpos y entidades que apuntaban a los anteriores:
+
+        collisions.clear ();
+        colliders .clear ();
+        bullets   .clear ();
+        fragments .clear ();
+
+        bullet_cooldown = 0.f;
+
+        top_border    = sprites.create (assets.h_bar.texture, assets.h_bar.size);
+        bottom_border = sprites.create (assets.h_bar.texture, assets.h_bar.size);
+        right_border  = sprites.create (assets.v_bar.texture, assets.v_bar.size);
+        left_border   = sprites.create (assets.v_bar.texture, assets.v_bar.size);
+
+        top_border   ->set_anchor   (CENTER | TOP);
+        top_border   ->set_position ({ width / 2, height });
+        bottom_border->set_anchor   (CENTER | BOTTOM);
+        bottom_border->set_position ({ width / 2, 0 });
+        right_border ->set_anchor   (CENTER | RIGHT);
+        right_border ->set_position ({ width, height / 2 });
+        left_border  ->set_anchor   (CENTER | LEFT);
+        left_border  ->set_position ({ 0, height / 2 });
+
+        asteroid_1 = sprites.create (assets.asteroid.texture, assets.asteroid.size);
+        asteroid_2 = sprites.create (assets.asteroid.texture, assets.asteroid.size);
+        ship       = sprites.create (assets.ship    .texture, assets.ship    .size);
+
+        for (auto & bullet_sprite : bullet_sprites)
+        {
+            bullet_sprite = sprites.create (assets.bullet.texture, assets.bullet.size);
+            bullet_sprite->hide ();
+        }
+
+        for (auto & fragment_sprite : fragment_sprites)
+        {
+            fragment_sprite = sprites.create (assets.mini_asteroid.texture, assets.mini_asteroid.size);
+            fragment_sprite->hide ();
+        }
+
+        create_colliders (assets);
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::restart ()
+    {
+        vidas = 3;
+        ast_ColisionaUnaVez = false; ast_ColisionaDosVeces = false; ast_ColisionaTresVeces  = false;
+        ast_Seguridad_1 = false; ast_Seguridad_2 = false; ast_Seguridad_3  = false;
+        game_over = false;
+
+        ship->set_position ({ width - (width / 4.f), height / 2 });
+
+        clear_entities ();
+
+        asteroid_1->set_position ({ width / 4.f, height / 2.f }); // posicion de inicio
+        asteroid_2->set_position ({ width / 3.f, height / 8.f }); // posicion de inicio
+
+        explosions.clear ();
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::start ()
+    {
+        // Se genera un vector de dirección al azar:
+
+        Vector2f random_direction_1
+        (
+            random_float (-.5f * width,  .5f * width ),
+            random_float (-.5f * height, .5f * height)
+        );
+        Vector2f random_direction_2
+        (
+            random_float (-.5f * width,  .5f * width ),
+            random_float (-.5f * height, .5f * height)
+        );
+
+        // Se hace unitario el vector y se multiplica un el valor de velocidad para que el vector
+        // resultante tenga exactamente esa longitud:
+
+        asteroid_1->set_speed (random_direction_1.normalized () * asteroid_speed_1);
+        asteroid_2->set_speed (random_direction_2.normalized () * asteroid_speed_2);
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::step (float time, const Controls & controls)
+    {
+        explosions.clear ();
+
+        // Se actualiza el estado de todos los sprites:
+
+        sprites.update (time);
+
+        bullet_cooldown -= time;
+
+        // Se aplican las órdenes del jugador:
+
+        steer (controls);
+
+        if (controls.fire)
+        {
+            fire_bullet ();
+        }
+
+        // Se comprueban las posibles colisiones de la nave y la bala con los bordes y asteroides:
+
+        check_collisions ();
+        check_ship_life ();
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // Se hace que el jugador se mueva hacia arriba, derecha o izquierda según los botones que esté
+    // pulsando. Cuando el usuario no toca la pantalla se deja al player quieto.
+
+    void Game_Simulation::steer (const Controls & controls)
+    {
+        float vector_x_point_ref = (100 - ship->get_position_x() - ship->get_width() / 2);
+        float vector_y_point_ref = (0 - ship->get_position_y());
+
+        float ProductoVectorial_x = (vector_x_point_ref) * (delta_x_ship_vector);
+        float ProductoVectorial_y = (vector_y_point_ref) * (delta_y_ship_vector);
+        float ProductoVectorial_total = (ProductoVectorial_x) + (ProductoVectorial_y);
+
+        // |a| * |b| = sqrt(|a|² * |b|²), de modo que basta una raíz cuadrada inversa (y nada en
+        // double) para obtener el coseno. Si la nave aún no tiene dirección el ángulo es 0:
+
+        float cuadrado_vector_1 = vector_x_point_ref  * vector_x_point_ref  + vector_y_point_ref  * vector_y_point_ref;
+        float cuadrado_vector_2 = delta_x_ship_vector * delta_x_ship_vector + delta_y_ship_vector * delta_y_ship_vector;
+        float multipicacion_cuadrados = cuadrado_vector_1 * cuadrado_vector_2;
+
+        float cos_alfa = multipicacion_cuadrados > 0.f ? ProductoVectorial_total * fast::rsqrt (multipicacion_cuadrados) : 1.f;
+
+        ship_angle = fast::acos (cos_alfa);
+
+        // -----------------------------------------------------------------------------------------
+
+        if (controls.touching)
+        {
+            if (controls.thrust)
+            {
+                update_ship_vector ();
+            }
+
+            if (controls.turn_right)
+            {
+                ship->set_speed_y({ -ship_speed / 3});
+            }
+
+            if (controls.turn_left)
+            {
+                ship->set_speed_y({ ship_speed / 3});
+            }
+        }
+        else
+        {
+            if (delta_x_ship_vector > 0)
+            {
+                ship->set_speed_x({ ship_speed / 3});
+            }
+            else if (delta_x_ship_vector < 0)
+            {
+                ship->set_speed_x({ -ship_speed / 3});
+            }
+
+            if (delta_y_ship_vector > 0)
+            {
+                ship->set_speed_y({ ship_speed / 3});
+            }
+            else if (delta_x_ship_vector < 0)
+            {
+                ship->set_speed_y({ -ship_speed / 3});
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::update_ship_vector ()
+    {
+        delta_x_ship_vector = (ship->get_position_x() + ship->get_width() / 2) - (ship->get_position_x() - ship->get_width() / 2);
+        delta_y_ship_vector = (ship->get_position_y()) - (ship->get_position_y());
+
+        Vector2f ship_vector (delta_x_ship_vector, delta_y_ship_vector);
+
+        ship->set_speed (ship_vector.normalized () * ship_speed); // El vector se hace unitario
+
+        if (delta_x_ship_vector > 0)
+        {
+            ship->set_speed_x({ ship_speed });
+        }
+        else if (delta_x_ship_vector < 0)
+        {
+            ship->set_speed_x({ -ship_speed });
+        }
+
+        if (delta_y_ship_vector > 0)
+        {
+            ship->set_speed_y({ ship_speed });
+        }
+        else if (delta_x_ship_vector < 0)
+        {
+            ship->set_speed_y({ -ship_speed });
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::fire_bullet ()
+    {
+        if (bullet_cooldown > 0.f)
+        {
+            return;
+        }
+
+        Bullet_Pool::Handle handle = bullets.allocate ();
+
+        if (bullets.is_valid (handle))
+        {
+            Bullet * bullet = bullets.get (handle);
+
+            bullet->sprite = bullet_sprites[handle.index];
+            bullet->sprite->set_position ({ ship->get_position_x (), ship->get_position_y () }); //donde spawnea
+            bullet->sprite->set_speed    ({ bullet_speed, 0.f });
+            bullet->sprite->show ();
+
+            bullet_cooldown = bullet_period;
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // Las balas y los fragmentos que han chocado o han salido de la pantalla se ocultan; al final de
+    // cada paso se devuelven sus huecos a los pools.
+
+    void Game_Simulation::release_spent_entities ()
+    {
+        bullets.for_each
+        (
+            [this] (const Bullet_Pool::Handle & handle, Bullet & bullet)
+            {
+                if (bullet.sprite->is_not_visible ())
+                {
+                    bullets.release (handle);
+                }
+            }
+        );
+
+        fragments.for_each
+        (
+            [this] (const Fragment_Pool::Handle & handle, Fragment & fragment)
+            {
+                if (fragment.sprite->is_not_visible ())
+                {
+                    fragments.release (handle);
+                }
+            }
+        );
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::clear_entities ()
+    {
+        bullets  .clear ();
+        fragments.clear ();
+
+        for (auto & bullet_sprite : bullet_sprites)
+        {
+            bullet_sprite->hide ();
+        }
+
+        for (auto & fragment_sprite : fragment_sprites)
+        {
+            fragment_sprite->hide ();
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::create_colliders (const Assets & assets)
+    {
+        const uint32_t any_rock = ASTEROID_LAYER | FRAGMENT_LAYER;
+
+        // Los bordes no necesitan silueta porque su rectángulo es toda su forma:
+
+        add_collider (   top_border,   BORDER_LAYER, SHIP_LAYER | BULLET_LAYER | any_rock);
+        add_collider (bottom_border,   BORDER_LAYER, SHIP_LAYER | BULLET_LAYER | any_rock);
+        add_collider ( right_border,   BORDER_LAYER, SHIP_LAYER | BULLET_LAYER | any_rock);
+        add_collider (  left_border,   BORDER_LAYER, SHIP_LAYER | BULLET_LAYER | any_rock);
+        add_collider (         ship,     SHIP_LAYER, any_rock   | BORDER_LAYER, assets.ship.shape);
+
+        for (auto & bullet_sprite : bullet_sprites)
+        {
+            add_collider (bullet_sprite, BULLET_LAYER, any_rock | BORDER_LAYER, assets.bullet.shape);
+        }
+
+        add_collider (   asteroid_1, ASTEROID_LAYER, SHIP_LAYER | BULLET_LAYER | BORDER_LAYER, assets.asteroid.shape);
+        add_collider (   asteroid_2, ASTEROID_LAYER, SHIP_LAYER | BULLET_LAYER | BORDER_LAYER, assets.asteroid.shape);
+
+        // Todos los fragmentos se registran de una vez y solo participan mientras son visibles:
+
+        colliders.reserve (colliders.size () + max_fragments);
+
+        for (auto & fragment_sprite : fragment_sprites)
+        {
+            add_collider (fragment_sprite, FRAGMENT_LAYER, SHIP_LAYER | BULLET_LAYER | BORDER_LAYER, assets.mini_asteroid.shape);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::add_collider (const Sprite_Handle & sprite, uint32_t layer, uint32_t mask, const Alpha_Mask * shape)
+    {
+        Collider collider;
+
+        collider.body   = collisions.add_body (layer, mask, colliders.size ());
+        collider.sprite = sprite;
+        collider.shape  = shape && !shape->empty () ? shape : nullptr;
+
+        colliders.push_back (collider);
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::check_collisions ()
+    {
+        // Se actualizan los cuerpos con la posición actual de los sprites (los que no son visibles
+        // no chocan con nada):
+
+        for (auto & collider : colliders)
+        {
+            collisions.set_enabled (collider.body, collider.sprite->is_visible ());
+            collisions.set_bounds  (collider.body, collider.sprite);
+        }
+
+        bool ship_hit = false;
+
+        for (auto & pair : collisions.find_pairs ())
+        {
+            const Collider * a = &colliders[collisions.get_user_data (pair.a)];
+            const Collider * b = &colliders[collisions.get_user_data (pair.b)];
+
+            // Una bala o un asteroide ocultos por un choque anterior de este mismo paso ya no cuentan:
+
+            if (a->sprite->is_not_visible () || b->sprite->is_not_visible ())
+            {
+                continue;
+            }
+
+            // Se ordena el par para que primero vaya el cuerpo de la capa menor:
+
+            if (collisions.get_layer (a->body) > collisions.get_layer (b->body))
+            {
+                std::swap (a, b);
+            }
+
+            // Fase estrecha: los rectángulos se pueden tocar sin que lo hagan las partes opacas
+            // (por ejemplo, en las esquinas transparentes de los asteroides):
+
+            if (a->shape && b->shape && !Alpha_Mask::overlap (*a->shape, a->sprite, *b->shape, b->sprite))
+            {
+                continue;
+            }
+
+            uint32_t layers = collisions.get_layer (a->body) | collisions.get_layer (b->body);
+
+            if (layers == (SHIP_LAYER | ASTEROID_LAYER) || layers == (SHIP_LAYER | FRAGMENT_LAYER))
+            {
+                ship_hit = true;
+            }
+            else if (layers == (BULLET_LAYER | ASTEROID_LAYER))
+            {
+                spawn_mini_asteroids (b->sprite);
+                add_explosion (ASTEROID_SPLIT, b->sprite);
+                b->sprite->hide ();
+                a->sprite->hide ();
+            }
+            else if (layers == (BULLET_LAYER | FRAGMENT_LAYER))
+            {
+                add_explosion (FRAGMENT_DESTROYED, b->sprite);
+                b->sprite->hide ();
+                a->sprite->hide ();
+            }
+            else if (layers == (BULLET_LAYER | BORDER_LAYER))
+            {
+                a->sprite->hide ();
+            }
+            else
+            {
+                // La nave, un asteroide o un fragmento atraviesan un borde y aparecen por el opuesto
+                // (el borde es siempre b porque es la capa mayor):
+
+                wrap_around (a->sprite, b->sprite);
+            }
+        }
+
+        release_spent_entities ();
+
+        // Se comprueba si algún asteroide coliciona con la nave.
+
+        if (ship_hit && ast_Seguridad_3 == false && vidas == 3)
+        {
+            ast_ColisionaUnaVez = true;
+        }
+        else if (ship_hit && ast_Seguridad_2 == true && vidas == 2)
+        {
+            ast_ColisionaDosVeces = true;
+        }
+        else if (ship_hit && ast_Seguridad_1 == true && vidas == 1)
+        {
+            ast_ColisionaTresVeces = true;
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::wrap_around (const Sprite_Handle & sprite, const Sprite_Handle & border)
+    {
+        if (border == top_border)
+        {
+            sprite->set_position_y (bottom_border->get_top_y () + 40);
+        }
+        else if (border == bottom_border)
+        {
+            sprite->set_position_y (top_border->get_bottom_y () - 40);
+        }
+        else if (border == right_border)
+        {
+            sprite->set_position_x (left_border->get_right_x () + 40);
+        }
+        else if (border == left_border)
+        {
+            sprite->set_position_x (right_border->get_left_x () - 40);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::check_ship_life ()
+    {
+        // Se comprueba si la nave debe perder sus vidas hasta reinicia la partida.
+
+        if (ast_ColisionaUnaVez)
+        {
+            vidas = 2;
+            add_explosion (SHIP_HIT, ship);
+
+            ast_Seguridad_3 = true; // impide volver a entrar en el mismo
+            ast_ColisionaUnaVez = false;
+
+            ast_Seguridad_2 = true;
+        }
+        else if (ast_ColisionaDosVeces)
+        {
+            vidas = 1;
+            add_explosion (SHIP_HIT, ship);
+
+            ast_Seguridad_2 = false; // impide volver a entrar en el mismo
+            ast_ColisionaDosVeces = false;
+
+            ast_Seguridad_1 = true; // permite avanzar una posición
+        }
+        else if (ast_ColisionaTresVeces)
+        {
+            vidas = 0;
+
+            ast_Seguridad_1 = false; // impide volver a entrar en el mismo
+            ast_ColisionaTresVeces = false; // permite avanzar una posición
+
+            game_over = true;
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Game_Simulation::spawn_mini_asteroids (const Sprite_Handle & asteroid)
+    {
+        // Los fragmentos se reparten en abanico alrededor del asteroide con un pequeño desvío
+        // aleatorio en la dirección y en la velocidad:
+
+        const float two_pi     = 6.2831853f;
+        const float base_angle = random_float (0.f, two_pi);
+
+        for (unsigned index = 0; index < fragments_per_split; ++index)
+        {
+            Fragment_Pool::Handle handle = fragments.allocate ();
+
+            if (!fragments.is_valid (handle)) break;
+
+            float jitter = random_float (-.5f, .5f) * (two_pi / fragments_per_split);
+            float angle  = base_angle + two_pi * index / fragments_per_split + jitter;
+            float speed  = fragment_spread * random_float (.5f, 1.5f);
+
+            Fragment * fragment = fragments.get (handle);
+
+            fragment->sprite = fragment_sprites[handle.index];
+            fragment->sprite->set_position (asteroid->get_position ());
+            float sine, cosine;
+
+            fast::sincos (angle, sine, cosine);
+
+            fragment->sprite->set_speed
+            ({
+                asteroid->get_speed_x () + cosine * speed,
+                asteroid->get_speed_y () + sine   * speed
+            });
+            fragment->sprite->show ();
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    Game_Simulation::Batch_Results Game_Simulation::run_batch
+    (
+        unsigned      instances,
+        unsigned      steps,
+        Thread_Pool & pool,
+        uint32_t      seed,
+        float         time_step
+    )
+    {
+        Timer timer;
+
+        pool.parallel_for
+        (
+            instances,
+            [steps, seed, time_step] (size_t instance)
+            {
+                // Cada partida tiene su propio pool de sprites (sin texturas) y su propio bot:
+
+                Sprite_Pool     sprites(4 + 3 + max_bullets + max_fragments);
+                Game_Simulation simulation(sprites, 1280.f, 720.f);
+
+                simulation.create  (Assets::headless ());
+                simulation.seed    (seed + uint32_t(instance) * 0x9E3779B9u);
+                simulation.restart ();
+                simulation.start   ();
+
+                basics::Random bot(simulation.random_seed ());
+                Controls       controls;
+
+                for (unsigned step = 0; step < steps; ++step)
+                {
+                    // El bot cambia de idea cada medio segundo aproximadamente:
+
+                    if (step % 30 == 0)
+                    {
+                        uint32_t buttons = bot.next ();
+
+                        controls.touching   = (buttons & 0x01) != 0;
+                        controls.thrust     = (buttons & 0x02) != 0;
+                        controls.turn_right = (buttons & 0x04) != 0;
+                        controls.turn_left  = (buttons & 0x08) != 0 && !controls.turn_right;
+                        controls.fire       = (buttons & 0x10) != 0;
+                    }
+
+                    simulation.step (time_step, controls);
+
+                    if (simulation.is_game_over ())
+                    {
+                        simulation.restart ();
+                        simulation.start   ();
+                    }
+                }
+            }
+        );
+
+        Batch_Results results;
+
+        results.instances = instances;
+        results.threads   = std::min (instances, pool.get_thread_count ());
+        results.frames    = uint64_t(instances) * steps;
+        results.seconds   = timer.get_elapsed_seconds< double > ();
+        results.scaling   = 1.0;
+
+        results.frames_per_second            = results.seconds > 0.0 ? double(results.frames) / results.seconds : 0.0;
+        results.frames_per_second_per_thread = results.threads > 0 ? results.frames_per_second / results.threads : 0.0;
+
+        return results;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    std::vector< Game_Simulation::Batch_Results > Game_Simulation::measure_scaling
+    (
+        unsigned instances,
+        unsigned steps,
+        uint32_t seed,
+        unsigned max_threads
+    )
+    {
+        if (max_threads == 0) max_threads = Thread_Pool::get_hardware_thread_count ();
+
+        std::vector< Batch_Results > all_results;
+
+        for (unsigned threads = 1; ; threads = std::min (threads * 2, max_threads))
+        {
+            Thread_Pool   pool(threads);
+            Batch_Results results = run_batch (instances, steps, pool, seed);
+
+            if (!all_results.empty () && all_results.front ().frames_per_second > 0.0)
+            {
+                results.scaling = results.frames_per_second / all_results.front ().frames_per_second;
+            }
+
+            all_results.push_back (results);
+
+            if (threads == max_threads) break;
+        }
+
+        return all_results;
+    }
+
+}
@@ -0,0 +1,349 @@
+/*
+ * GAME SIMULATION
+ * Copyright © 2021+ Marcelo López de lErma
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * marcelolopezdelerma@gmail.com
+ */
+
+#ifndef GAME_SIMULATION_HEADER
+#define GAME_SIMULATION_HEADER
+
+    #include <vector>
+
+    #include <basics/Alpha_Mask>
+    #include <basics/Collision_World>
+    #include <basics/Handle_Pool>
+    #include <basics/Point>
+    #include <basics/Random>
+    #include <basics/Size>
+    #include <basics/Sprite_Pool>
+    #include <basics/Texture_2D>
+    #include <basics/Thread_Pool>
+    #include <basics/Vector>
+
+    namespace example
+    {
+
+        /**
+         * Reglas del juego (movimiento de la nave, disparos, asteroides, colisiones y vidas) separadas
+         * del dibujado, de la entrada táctil y de Director. Cada instancia es independiente (no usa
+         * estado global ni el contexto gráfico), por lo que se pueden ejecutar muchas a la vez en
+         * distintos hilos (ver run_batch()).
+         * Los sprites de la simulación se crean en un Sprite_Pool externo: Game_Scene le pasa el suyo
+         * para dibujarlos junto con el resto de la escena, mientras que las simulaciones headless
+         * usan uno propio con sprites sin textura.
+         */
+        class Game_Simulation
+        {
+        public:
+
+            typedef basics::Sprite_Pool::Handle Sprite_Handle;
+
+            /**
+             * Textura (puede ser nullptr) y tamaño con los que se crea cada tipo de sprite, y su
+             * silueta para afinar las colisiones (si es nullptr se usa su rectángulo).
+             */
+            struct Look
+            {
+                const basics::Texture_2D * texture;
+                basics::Size2f             size;
+                const basics::Alpha_Mask * shape;
+            };
+
+            struct Assets
+            {
+                Look h_bar;
+                Look v_bar;
+                Look asteroid;
+                Look mini_asteroid;
+                Look ship;
+                Look bullet;
+
+                /**
+                 * Tamaños de las imágenes del juego sin texturas, para las simulaciones headless.
+                 */
+                static Assets headless ();
+            };
+
+            /**
+             * Órdenes del jugador durante un paso de simulación.
+             */
+            struct Controls
+            {
+                bool touching   = false;                ///< true si el jugador toca la pantalla (aunque no sea sobre un botón).
+                bool thrust     = false;
+                bool turn_right = false;
+                bool turn_left  = false;
+                bool fire       = false;
+            };
+
+            enum Explosion_Kind
+            {
+                ASTEROID_SPLIT,
+                FRAGMENT_DESTROYED,
+                SHIP_HIT,
+            };
+
+            /**
+             * Suceso de un paso que la escena puede representar (por ejemplo, con partículas).
+             */
+            struct Explosion
+            {
+                Explosion_Kind   kind;
+                basics::Point2f  position;
+                basics::Vector2f speed;
+            };
+
+            /**
+             * Resultados de run_batch().
+             */
+            struct Batch_Results
+            {
+                unsigned instances;
+                unsigned threads;
+                uint64_t frames;                        ///< Pasos simulados sumando todas las instancias.
+                double   seconds;                       ///< Tiempo real que ha tardado el lote.
+                double   frames_per_second;
+                double   frames_per_second_per_thread;
+                double   scaling;                       ///< frames_per_second respecto a la ejecución con un solo hilo (1 si no se midió).
+            };
+
+        private:
+
+            /**
+             * Capas de colisión a las que pertenecen los sprites que participan en las colisiones.
+             */
+            enum Collision_Layer : uint32_t
+            {
+                SHIP_LAYER     = 1 << 0,
+                BULLET_LAYER   = 1 << 1,
+                ASTEROID_LAYER = 1 << 2,
+                FRAGMENT_LAYER = 1 << 3,
+                BORDER_LAYER   = 1 << 4,                ///< Debe ser la capa mayor (ver check_collisions()).
+            };
+
+            /**
+             * Asocia un cuerpo del mundo de colisiones con el sprite del que toma su rectángulo.
+             */
+            struct Collider
+            {
+                basics::Collision_World::Body_Id body;
+                Sprite_Handle                    sprite;
+                const basics::Alpha_Mask       * shape;         ///< Silueta del sprite o nullptr para usar solo su rectángulo.
+            };
+
+            /**
+             * Bala disparada por la nave. Cada hueco del pool de balas usa siempre el mismo sprite
+             * (bullet_sprites[índice]), que se muestra al disparar y se oculta al destruirla.
+             */
+            struct Bullet
+            {
+                Sprite_Handle sprite;
+            };
+
+            /**
+             * Asteroide pequeño que sale despedido cuando una bala rompe un asteroide. Igual que con
+             * las balas, cada hueco del pool usa siempre el sprite fragment_sprites[índice].
+             */
+            struct Fragment
+            {
+                Sprite_Handle sprite;
+            };
+
+        public:
+
+            static constexpr unsigned max_bullets   =  16;
+            static constexpr unsigned max_fragments = 256;
+
+        private:
+
+            typedef basics::Handle_Pool< Bullet,   max_bullets   > Bullet_Pool;
+            typedef basics::Handle_Pool< Fragment, max_fragments > Fragment_Pool;
+
+            static constexpr float asteroid_speed_1 =  200.f;      ///< Velocidad a la que se mueve el asteroide_1 (en unideades virtuales por segundo).
+            static constexpr float asteroid_speed_2 =  100.f;      ///< Velocidad a la que se mueve el asteroide_2 (en unideades virtuales por segundo).
+            static constexpr float     ship_speed   =  500.f;      ///< Velocidad a la que se mueve la nave (en unideades virtuales por segundo).
+            static constexpr float   bullet_speed   = 2000.f;      ///< Velocidad a la que se mueve la bala (en unideades virtuales por segundo).
+            static constexpr float   bullet_period  =    .2f;      ///< Tiempo mínimo entre dos disparos (en segundos).
+
+            static constexpr unsigned fragments_per_split = 4;     ///< Número de fragmentos en los que se rompe un asteroide.
+            static constexpr float    fragment_spread     = 150.f; ///< Velocidad media con la que se separan los fragmentos (además de la que heredan).
+
+        private:
+
+            basics::Sprite_Pool   & sprites;                    ///< Pool en el que se crean los sprites de la simulación.
+            float                   width;                      ///< Ancho del área de juego.
+            float                   height;                     ///< Alto  del área de juego.
+
+            basics::Collision_World collisions;                 ///< Fase amplia de las colisiones entre la nave, la bala, los asteroides y los bordes.
+            std::vector< Collider > colliders;                  ///< Sprites que participan en las colisiones (indexados por el user_data de cada cuerpo).
+
+            Bullet_Pool    bullets;                             ///< Balas en vuelo.
+            Sprite_Handle  bullet_sprites[max_bullets];         ///< Sprites (ocultos mientras no se usan) de cada hueco del pool de balas.
+            float          bullet_cooldown;                     ///< Segundos de simulación que faltan para poder volver a disparar.
+
+            Fragment_Pool  fragments;                           ///< Fragmentos de asteroides en vuelo.
+            Sprite_Handle  fragment_sprites[max_fragments];     ///< Sprites (ocultos mientras no se usan) de cada hueco del pool de fragmentos.
+
+            Sprite_Handle     top_border;
+            Sprite_Handle  bottom_border;
+            Sprite_Handle    left_border;
+            Sprite_Handle   right_border;
+            Sprite_Handle     asteroid_1;
+            Sprite_Handle     asteroid_2;
+            Sprite_Handle           ship;
+
+            int               vidas = 3;                        ///< Número de vidas de jugador inicialmente.
+            bool    ast_ColisionaUnaVez = false;                ///< false hasta que el asteroide no colisione 1 vez con la nave.
+            bool  ast_ColisionaDosVeces = false;                ///< false hasta que el asteroide no colisione 2 vez con la nave.
+            bool ast_ColisionaTresVeces = false;                ///< false hasta que el asteroide no colisione 3 vez con la nave.
+            bool        ast_Seguridad_1 = false;                ///< nivel de seguridad 1 es false hasta que no se reinicie el juego.
+            bool        ast_Seguridad_2 = false;                ///< nivel de seguridad 2 es false hasta que no se reinicie el juego.
+            bool        ast_Seguridad_3 = false;                ///< nivel de seguridad 3 es false hasta que no se reinicie el juego.
+            bool              game_over = false;                ///< true cuando se pierde la última vida (hasta que se llama a restart()).
+
+            float delta_x_ship_vector;                          ///< Distancia entre la punta de la nave y la base en el eje X.
+            float delta_y_ship_vector;                          ///< Distancia entre la punta de la nave y la base en el eje Y.
+            float ship_angle;                                   ///< Ángulo entre la nave y el punto de referencia (100, 0).
+
+            basics::Random           random_engine;             ///< Generador de números aleatorios de la partida.
+            std::vector< Explosion > explosions;                ///< Sucesos del último paso.
+
+        public:
+
+            /**
+             * @param sprites Pool en el que se crearán los sprites (ver create()).
+             * @param width Ancho del área de juego en unidades virtuales.
+             * @param height Alto del área de juego en unidades virtuales.
+             */
+            Game_Simulation(basics::Sprite_Pool & sprites, float width, float height);
+
+            Game_Simulation(const Game_Simulation & ) = delete;
+            Game_Simulation & operator = (const Game_Simulation & ) = delete;
+
+        public:
+
+            /**
+             * Crea los sprites y los cuerpos de colisión de la simulación (bordes, asteroides, nave,
+             * balas y fragmentos, en ese orden de dibujado). Solo se debe llamar una vez.
+             */
+            void create (const Assets & assets);
+
+            void seed (uint32_t seed)
+            {
+                random_engine.seed (seed);
+            }
+
+            /**
+             * Restablece las vidas y coloca la nave y los asteroides en su posición inicial.
+             */
+            void restart ();
+
+            /**
+             * Lanza los asteroides en direcciones al azar.
+             */
+            void start ();
+
+            /**
+             * Avanza la simulación.
+             * @param time Fracción de tiempo que se debe avanzar.
+             * @param controls Órdenes del jugador durante este paso.
+             */
+            void step (float time, const Controls & controls);
+
+        public:
+
+            int  get_lives    () const { return vidas;      }
+            bool is_game_over () const { return game_over;  }
+            float get_ship_angle () const { return ship_angle; }
+
+            const std::vector< Explosion > & get_explosions () const
+            {
+                return explosions;
+            }
+
+            const Sprite_Handle & get_ship         () const { return ship;         }
+            const Sprite_Handle & get_top_border   () const { return top_border;   }
+            const Sprite_Handle & get_left_border  () const { return left_border;  }
+            const Sprite_Handle & get_right_border () const { return right_border; }
+
+            /**
+             * Saca de random_engine una semilla para otros generadores (por ejemplo, los de los
+             * emisores de partículas), de modo que también dependan de la semilla de la partida.
+             */
+            uint32_t random_seed ()
+            {
+                return random_engine.next ();
+            }
+
+        public:
+
+            /**
+             * Ejecuta varias partidas headless repartidas entre los hilos de un pool, cada una con un
+             * bot que pulsa los controles al azar, y mide cuántos pasos por segundo se simulan.
+             * Las partidas que terminan se reinician hasta completar los pasos indicados.
+             * @param instances Número de partidas.
+             * @param steps Pasos que se simulan en cada partida.
+             * @param pool Hilos en los que se reparten las partidas.
+             * @param seed Semilla de la que se derivan las de cada partida y su bot.
+             * @param time_step Paso de tiempo fijo en segundos.
+             */
+            static Batch_Results run_batch
+            (
+                unsigned              instances,
+                unsigned              steps,
+                basics::Thread_Pool & pool,
+                uint32_t              seed,
+                float                 time_step = 1.f / 60.f
+            );
+
+            /**
+             * Repite run_batch() con 1, 2, 4... hilos hasta max_threads (incluido) y calcula la
+             * escalabilidad de cada ejecución respecto a la de un solo hilo.
+             * @param max_threads Número máximo de hilos (0 para usar todos los núcleos).
+             */
+            static std::vector< Batch_Results > measure_scaling
+            (
+                unsigned instances,
+                unsigned steps,
+                uint32_t seed,
+                unsigned max_threads = 0
+            );
+
+        private:
+
+            /**
+             * Retorna un número aleatorio en [min, max) sacado de random_engine. basics::Random da
+             * la misma secuencia en todas las plataformas, así que las partidas grabadas se pueden
+             * reproducir en cualquiera.
+             */
+            float random_float (float min, float max)
+            {
+                return random_engine.between (min, max);
+            }
+
+            void steer                  (const Controls & controls);
+            void update_ship_vector     ();
+            void fire_bullet            ();
+            void release_spent_entities ();
+            void clear_entities         ();
+            void create_colliders       (const Assets & assets);
+            void add_collider           (const Sprite_Handle & sprite, uint32_t layer, uint32_t mask, const basics::Alpha_Mask * shape = nullptr);
+            void check_collisions       ();
+            void wrap_around            (const Sprite_Handle & sprite, const Sprite_Handle & border);
+            void check_ship_life        ();
+            void spawn_mini_asteroids   (const Sprite_Handle & asteroid);
+
+            void add_explosion (Explosion_Kind kind, const Sprite_Handle & sprite)
+            {
+                explosions.push_back (Explosion{ kind, sprite->get_position (), sprite->get_speed () });
+            }
+
+        };
+
+    }
+
+#endif
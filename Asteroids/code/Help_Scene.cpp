@@ -10,7 +10,6 @@
 
 #include "Help_Scene.hpp"
 
-#include <cstdlib>
 #include <basics/Canvas>
 #include <basics/Director>
 
@@ -45,10 +44,6 @@ namespace example
         canvas_width  = 1280;
         canvas_height =  720;
 
-        // Se inicia la semilla del generador de números aleatorios:
-
-        srand (unsigned(time(nullptr)));
-
         // Se inicializan otros atributos:
 
         initialize ();
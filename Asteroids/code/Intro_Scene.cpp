@@ -164,7 +164,13 @@ namespace example
 
             state = FINISHED;
 
-            director.run_scene (shared_ptr< Scene >(new Menu_Scene));
+            // La escena del menú se guarda en la caché de Director para poder volver a ella sin
+            // tener que cargarla de nuevo:
+
+            shared_ptr< Scene > menu_scene = make_shared< Menu_Scene > ();
+
+            director.cache_scene (ID(menu-scene), menu_scene);
+            director.run_scene   (menu_scene);
         }
     }
 }
\ No newline at end of file
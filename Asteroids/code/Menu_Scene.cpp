@@ -13,7 +13,7 @@
 #include "Help_Scene.hpp"
 #include <basics/Canvas>
 #include <basics/Director>
-#include <basics/Transformation>
+#include <basics/Affine>
 
 using namespace basics;
 using namespace std;
@@ -43,18 +43,18 @@ namespace example
 
     // ---------------------------------------------------------------------------------------------
 
-    void Menu_Scene::handle (basics::Event & event)
+    void Menu_Scene::handle_touch (basics::Touch_Event & touch)
     {
         if (state == READY) // Se descartan los eventos cuando la escena está LOADING
         {
-            switch (event.id)
+            switch (touch.id)
             {
                 case ID(touch-started): // El usuario toca la pantalla
                 case ID(touch-moved):
                 {
                     // Se determina qué opción se ha tocado:
 
-                    Point2f touch_location = { *event[ID(x)].as< var::Float > (), *event[ID(y)].as< var::Float > () };
+                    Point2f touch_location = { touch.x, touch.y };
                     int     option_touched = option_at (touch_location);
 
                     // Solo se puede tocar una opción a la vez (para evitar selecciones múltiples),
@@ -76,11 +76,11 @@ namespace example
 
                     // Se determina qué opción se ha dejado de tocar la última y se actúa como corresponda:
 
-                    Point2f touch_location = { *event[ID(x)].as< var::Float > (), *event[ID(y)].as< var::Float > () };
+                    Point2f touch_location = { touch.x, touch.y };
 
                     if (option_at (touch_location) == PLAY)
                     {
-                        director.run_scene (shared_ptr< Scene >(new Game_Scene));
+                        director.run_scene (game_scene ());
                     }
                     else if (option_at (touch_location) == HELP)
                     {
@@ -116,6 +116,10 @@ namespace example
                     if (state == READY)
                     {
                         configure_options ();
+
+                        // Mientras el usuario elige una opción, se precarga la escena de juego:
+
+                        director.preload_scene (game_scene ());
                     }
                 }
             }
@@ -152,7 +156,7 @@ namespace example
                     {
                         canvas->set_transform
                                 (
-                                        scale_then_translate_2d
+                                        Affine2f::scale_then_translate
                                                 (
                                                         option.is_pressed ? 0.75f : 1.f, // Escala de la opción
                                                         { option.position[0], option.position[1] } // Traslación
@@ -165,7 +169,7 @@ namespace example
                     // Se restablece la transformación aplicada a las opciones para que no afecte a
                     // dibujos posteriores realizados con el mismo canvas:
 
-                    canvas->set_transform (Transformation2f());
+                    canvas->set_transform (Affine2f());
                 }
             }
         }
@@ -207,6 +211,22 @@ namespace example
         initialize ();
     }
 
+    // ---------------------------------------------------------------------------------------------
+    // La escena de juego se guarda en la caché de Director para que, al volver a jugar desde el
+    // menú, se reutilicen las texturas que ya cargó en lugar de cargarlas de nuevo.
+
+    shared_ptr< Scene > Menu_Scene::game_scene ()
+    {
+        shared_ptr< Scene > scene = director.get_cached_scene (ID(game-scene));
+
+        if (!scene)
+        {
+            director.cache_scene (ID(game-scene), scene = make_shared< Game_Scene > ());
+        }
+
+        return scene;
+    }
+
     // ---------------------------------------------------------------------------------------------
 
     int Menu_Scene::option_at (const Point2f & point)
@@ -111,9 +111,9 @@ namespace example
 
         /**
          * Este método se invoca automáticamente una vez por fotograma cuando se acumulan
-         * eventos dirigidos a la escena.
+         * eventos táctiles dirigidos a la escena.
          */
-        void handle (basics::Event & event) override;
+        void handle_touch (basics::Touch_Event & touch) override;
 
         /**
          * Este método se invoca automáticamente una vez por fotograma para que la escena
@@ -134,6 +134,11 @@ namespace example
          */
         void configure_options ();
 
+        /**
+         * Retorna la escena de juego guardada en la caché de Director, creándola si no existe.
+         */
+        std::shared_ptr< basics::Scene > game_scene ();
+
         /**
          * Devuelve el índice de la opción que se encuentra bajo el punto indicado.
          * @param point Punto que se usará para determinar qué opción tiene debajo.
@@ -130,6 +130,13 @@
             return false;
         }
 
+        const byte * Android_Asset::map ()
+        {
+            // Si el asset no está comprimido dentro del APK se mapea en memoria sin copiarlo:
+
+            return good () ? static_cast< const byte * >(AAsset_getBuffer (handle)) : nullptr;
+        }
+
         bool Android_Asset::read (uint8_t * buffer, size_t size)
         {
             if (size > 0)
@@ -46,6 +46,8 @@
             bool   read_all (std::vector< byte > & buffer) override;
             bool   read_all (std::string & buffer) override;
 
+            const byte * map () override;
+
         private:
 
             bool read (uint8_t * buffer, size_t size);
@@ -16,11 +16,28 @@
 
     #include <basics/Director>
     #include <basics/Id>
+    #include <basics/Touch_Event>
+    #include <basics/Touch_Surface>
     #include <android/input.h>
 
     namespace basics { namespace internal
     {
 
+        // Cada toque se encola para la escena y además se registra en el estado de touch_surface:
+
+        static void send (const Touch_Event & touch)
+        {
+            director.handle (touch);
+
+            touch_surface->record (touch);
+        }
+
+        // Número máximo de muestras históricas que se envían por dedo en cada evento de movimiento
+        // de Android. Si hay más se toman espaciadas uniformemente, de modo que un evento con mucho
+        // historial (por ejemplo, tras una pausa del hilo de entrada) no llena la cola del Director:
+
+        static constexpr size_t max_history_samples = 4;
+
         int handle_motion_event (AInputEvent * android_event)
         {
             switch (AInputEvent_getSource (android_event))
@@ -36,13 +53,17 @@
                         {
                             int32_t index = (action & AMOTION_EVENT_ACTION_POINTER_INDEX_MASK) >> AMOTION_EVENT_ACTION_POINTER_INDEX_SHIFT;
 
-                            Event event(ID(touch-started));
-
-                            event[ID(id)] = AMotionEvent_getPointerId (android_event, index);
-                            event[ID(x) ] = AMotionEvent_getX         (android_event, index);
-                            event[ID(y) ] = AMotionEvent_getY         (android_event, index);
-
-                            director.handle (event);
+                            send
+                            (
+                                Touch_Event
+                                {
+                                    ID(touch-started),
+                                    AMotionEvent_getPointerId (android_event, index),
+                                    AMotionEvent_getX         (android_event, index),
+                                    AMotionEvent_getY         (android_event, index),
+                                    AMotionEvent_getEventTime (android_event)
+                                }
+                            );
 
                             break;
                         }
@@ -53,17 +74,47 @@
                             // por lo que no veo clara la manera de identificar el puntero que se ha movido. Por ello
                             // se envían eventos de movimiento para todos los punteros...
 
+                            // Android agrupa en un mismo evento las muestras intermedias (históricas) que se han
+                            // tomado desde el anterior. Se envían en orden y con su marca de tiempo (como mucho
+                            // max_history_samples por dedo) para que Director conserve la trayectoria al agruparlas.
+                            // Solo la posición actual se registra en touch_surface:
+
                             size_t pointer_count = AMotionEvent_getPointerCount (android_event);
+                            size_t history_size  = AMotionEvent_getHistorySize  (android_event);
+                            size_t sample_count  = history_size < max_history_samples ? history_size : max_history_samples;
 
                             for (size_t index = 0; index < pointer_count; ++index)
                             {
-                                Event event(ID(touch-moved));
-
-                                event[ID(id)] = AMotionEvent_getPointerId (android_event, index);
-                                event[ID(x) ] = AMotionEvent_getX         (android_event, index);
-                                event[ID(y) ] = AMotionEvent_getY         (android_event, index);
-
-                                director.handle (event);
+                                int32_t pointer_id = AMotionEvent_getPointerId (android_event, index);
+
+                                for (size_t step = 0; step < sample_count; ++step)
+                                {
+                                    size_t sample = step * history_size / sample_count;
+
+                                    director.handle
+                                    (
+                                        Touch_Event
+                                        {
+                                            ID(touch-moved),
+                                            pointer_id,
+                                            AMotionEvent_getHistoricalX         (android_event, index, sample),
+                                            AMotionEvent_getHistoricalY         (android_event, index, sample),
+                                            AMotionEvent_getHistoricalEventTime (android_event, sample)
+                                        }
+                                    );
+                                }
+
+                                send
+                                (
+                                    Touch_Event
+                                    {
+                                        ID(touch-moved),
+                                        pointer_id,
+                                        AMotionEvent_getX         (android_event, index),
+                                        AMotionEvent_getY         (android_event, index),
+                                        AMotionEvent_getEventTime (android_event)
+                                    }
+                                );
                             }
 
                             break;
@@ -75,17 +126,26 @@
                         {
                             int32_t index = (action & AMOTION_EVENT_ACTION_POINTER_INDEX_MASK) >> AMOTION_EVENT_ACTION_POINTER_INDEX_SHIFT;
 
-                            Event event(ID(touch-ended));
-
-                            event[ID(id)] = AMotionEvent_getPointerId (android_event, index);
-                            event[ID(x) ] = AMotionEvent_getX         (android_event, index);
-                            event[ID(y) ] = AMotionEvent_getY         (android_event, index);
-
-                            director.handle (event);
+                            send
+                            (
+                                Touch_Event
+                                {
+                                    ID(touch-ended),
+                                    AMotionEvent_getPointerId (android_event, index),
+                                    AMotionEvent_getX         (android_event, index),
+                                    AMotionEvent_getY         (android_event, index),
+                                    AMotionEvent_getEventTime (android_event)
+                                }
+                            );
 
                             break;
                         }
                     }
+
+                    // El estado se publica una vez por evento de Android (que puede incluir varios
+                    // dedos y varias muestras) para que el lector nunca vea un estado a medias:
+
+                    touch_surface->publish ();
                 }
             }
 
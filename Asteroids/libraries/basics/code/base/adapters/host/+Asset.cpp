@@ -0,0 +1,41 @@
+/*
+ * ASSET
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182035
+ */
+
+#include <basics/Asset>
+#include "Host_Asset.hpp"
+
+namespace basics
+{
+
+    std::shared_ptr< Asset > Asset::open (const std::string & path)
+    {
+        std::shared_ptr< Asset > asset(new internal::Host_Asset(path));
+
+        if (!asset->good ())
+        {
+             asset.reset ();
+        }
+
+        return asset;
+    }
+
+    bool Asset::exists (const std::string & path)
+    {
+        return internal::Host_Asset(path).good ();
+    }
+
+    size_t Asset::size (const std::string & path)
+    {
+        return internal::Host_Asset(path).size ();
+    }
+
+}
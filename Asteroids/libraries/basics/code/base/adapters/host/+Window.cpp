@@ -0,0 +1,38 @@
+/*
+ * WINDOW
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182020
+ */
+
+#include <basics/Window>
+
+namespace basics
+{
+
+    // En los ejecutables de escritorio no hay ventanas de plataforma. Las escenas se ejecutan con
+    // Director::run_headless(), que crea su propia ventana ficticia:
+
+    const bool Window::can_be_instantiated = false;
+
+    Window::Handle Window::create_window (Id )
+    {
+        return Handle();
+    }
+
+    bool Window::destroy_window (Id )
+    {
+        return false;
+    }
+
+    Window::Handle Window::get_window (Id )
+    {
+        return Handle();
+    }
+
+}
@@ -0,0 +1,41 @@
+/*
+ * HOST APPLICATION
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182010
+ */
+
+#ifndef BASICS_HOST_APPLICATION_HEADER
+#define BASICS_HOST_APPLICATION_HEADER
+
+    #include <basics/Application>
+
+    namespace basics { namespace internal
+    {
+
+        /**
+         * Aplicación de los ejecutables de escritorio (pruebas, benchmarks y herramientas). No
+         * tiene ciclo de vida de sistema: siempre es interactiva y solo recibe los eventos que se
+         * le envíen con push().
+         */
+        class Host_Application : public Application
+        {
+        public:
+
+            State get_state () const override
+            {
+                return INTERACTIVE;
+            }
+
+        };
+
+        extern Host_Application application;
+
+    }}
+
+#endif
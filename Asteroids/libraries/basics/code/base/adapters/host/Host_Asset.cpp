@@ -0,0 +1,167 @@
+/*
+ * HOST ASSET
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182030
+ */
+
+#include <cstdlib>
+#include <sys/mman.h>
+#include "Host_Asset.hpp"
+
+namespace basics { namespace internal
+{
+
+    std::string Host_Asset::resolve (const std::string & path)
+    {
+        if (!path.empty () && path[0] == '/') return path;
+
+        const char * root = std::getenv ("BASICS_ASSETS_PATH");
+
+        #if defined(BASICS_HOST_ASSETS_PATH)
+            if (!root) root = BASICS_HOST_ASSETS_PATH;
+        #endif
+
+        return root && *root ? std::string(root) + '/' + path : path;
+    }
+
+    Host_Asset::Host_Asset(const std::string & path)
+    :
+        file_size(0),
+        mapping  (nullptr),
+        at_end   (false)
+    {
+        file   = std::fopen (resolve (path).c_str (), "rb");
+        failed = file == nullptr;
+
+        if (file)
+        {
+            std::fseek (file, 0, SEEK_END);
+
+            file_size = size_t(std::ftell (file));
+
+            std::fseek (file, 0, SEEK_SET);
+        }
+    }
+
+    Host_Asset::~Host_Asset()
+    {
+        if (mapping) munmap (mapping, file_size), mapping = nullptr;
+        if (file   ) std::fclose (file), file = nullptr;
+    }
+
+    bool Host_Asset::good () const
+    {
+        return not failed;
+    }
+
+    bool Host_Asset::fail () const
+    {
+        return failed;
+    }
+
+    bool Host_Asset::eof () const
+    {
+        return at_end;
+    }
+
+    size_t Host_Asset::size () const
+    {
+        return good () ? file_size : 0;
+    }
+
+    bool Host_Asset::seek (ptrdiff_t offset, Anchor anchor)
+    {
+        if (good ())
+        {
+            int origin = anchor == BEGINNING ? SEEK_SET : anchor == END ? SEEK_END : SEEK_CUR;
+
+            if (std::fseek (file, long(offset), origin) == 0)
+            {
+                at_end = false;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    size_t Host_Asset::tell () const
+    {
+        return good () ? size_t(std::ftell (file)) : 0;
+    }
+
+    byte Host_Asset::read ()
+    {
+        byte data = 0;
+
+        if (good ())
+        {
+            read (&data, 1);
+        }
+
+        return data;
+    }
+
+    bool Host_Asset::read_all (std::vector< byte > & buffer)
+    {
+        if (good ())
+        {
+            buffer.resize (file_size);
+
+            return read (buffer.data (), file_size);
+        }
+
+        return false;
+    }
+
+    bool Host_Asset::read_all (std::string & buffer)
+    {
+        if (good ())
+        {
+            buffer.resize (file_size);
+
+            return read (&buffer[0], file_size);
+        }
+
+        return false;
+    }
+
+    const byte * Host_Asset::map ()
+    {
+        if (good () && !mapping && file_size > 0)
+        {
+            void * address = mmap (nullptr, file_size, PROT_READ, MAP_PRIVATE, fileno (file), 0);
+
+            if (address != MAP_FAILED) mapping = address;
+        }
+
+        return static_cast< const byte * >(mapping);
+    }
+
+    bool Host_Asset::read (void * buffer, size_t size)
+    {
+        if (size > 0)
+        {
+            size_t result = std::fread (buffer, 1, size, file);
+
+            if (result == size)
+            {
+                return true;
+            }
+
+            if (std::feof (file)) at_end = true; else failed = true;
+
+            return false;
+        }
+
+        return true;
+    }
+
+}}
@@ -0,0 +1,70 @@
+/*
+ * HOST ASSET
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182025
+ */
+
+#ifndef BASICS_HOST_ASSET_HEADER
+#define BASICS_HOST_ASSET_HEADER
+
+    #include <cstdio>
+    #include <string>
+    #include <basics/Asset>
+
+    namespace basics { namespace internal
+    {
+
+        /**
+         * Asset leído del sistema de archivos del ordenador. Las rutas relativas se buscan en la
+         * carpeta indicada por la variable de entorno BASICS_ASSETS_PATH o, si no existe, en la
+         * que se definió al compilar con BASICS_HOST_ASSETS_PATH (normalmente la carpeta assets
+         * del proyecto). map() mapea el archivo en memoria con mmap().
+         */
+        class Host_Asset final : public Asset
+        {
+
+            std::FILE * file;
+            size_t      file_size;
+            void      * mapping;
+            bool        failed;
+            bool        at_end;
+
+        public:
+
+            static std::string resolve (const std::string & path);
+
+        public:
+
+            Host_Asset(const std::string & path);
+           ~Host_Asset();
+
+        public:
+
+            bool   good () const override;
+            bool   fail () const override;
+            bool   eof  () const override;
+
+            size_t size () const override;
+            bool   seek (ptrdiff_t offset, Anchor = CURRENT) override;
+            size_t tell () const override;
+            byte   read () override;
+            bool   read_all (std::vector< byte > & buffer) override;
+            bool   read_all (std::string & buffer) override;
+
+            const byte * map () override;
+
+        private:
+
+            bool read (void * buffer, size_t size);
+
+        };
+
+    }}
+
+#endif
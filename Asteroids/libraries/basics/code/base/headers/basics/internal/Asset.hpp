@@ -58,6 +58,16 @@
             virtual bool   read_all (std::vector< byte > & buffer) = 0;
             virtual bool   read_all (std::string & buffer) = 0;
 
+            /**
+             * Devuelve un puntero a todo el contenido del asset si se puede acceder a él sin
+             * copiarlo (por ejemplo, porque está mapeado en memoria), o nullptr en caso contrario.
+             * El puntero es válido mientras exista el asset.
+             */
+            virtual const byte * map ()
+            {
+                return nullptr;
+            }
+
         };
 
     }
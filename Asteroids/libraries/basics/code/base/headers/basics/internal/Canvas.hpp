@@ -13,12 +13,14 @@
 #ifndef BASICS_CANVAS_HEADER
 #define BASICS_CANVAS_HEADER
 
+    #include <basics/Affine>
     #include <basics/Atlas>
     #include <basics/Graphics_Context>
     #include <basics/Point>
     #include <basics/Renderer>
     #include <basics/Size>
     #include <basics/Text_Layout>
+    #include <basics/Text_Prefab>
     #include <basics/Texture_2D>
     #include <basics/Transformation>
 
@@ -48,7 +50,7 @@
             {
                 NONE,
                 TRANSPARENCY,
-                MULTIPLY,
+                MULTIPLY,                               ///< Destino por color de origen. Ignora el alfa.
                 ADD
             };
 
@@ -101,6 +103,12 @@
             virtual void set_transform   (const Transformation2f & transform) { }
             virtual void apply_transform (const Transformation2f & transform) { }
 
+            /**
+             * Versiones con Affine2f. Por defecto se convierten a Transformation2f.
+             */
+            virtual void set_transform   (const Affine2f & transform) { set_transform   (Transformation2f(transform)); }
+            virtual void apply_transform (const Affine2f & transform) { apply_transform (Transformation2f(transform)); }
+
         public:
 
             virtual void clear           () { }
@@ -114,6 +122,58 @@
             virtual void fill_rectangle  (const Point2f & where, const Size2f & size, const Atlas::Slice * slice,   int handling = CENTER) { }
             virtual void draw_text       (const Point2f & where, const Text_Layout & text_layout, int handling = TOP | LEFT);
 
+            /**
+             * Dibuja un texto ya subido a la GPU. Por defecto se dibuja su Text_Layout.
+             */
+            virtual void draw_text       (const Point2f & where, const Text_Prefab & text_prefab, int handling = TOP | LEFT)
+            {
+                draw_text (where, text_prefab.get_layout (), handling);
+            }
+
+            /**
+             * Dibuja de una vez varios rectángulos con la misma textura. Cada rectángulo se define
+             * por su esquina inferior izquierda y su tamaño en arrays separados. De handling solo
+             * se tienen en cuenta FLIP_HORIZONTAL y FLIP_VERTICAL.
+             * Por defecto se dibujan uno a uno con fill_rectangle().
+             */
+            virtual void fill_rectangles
+            (
+                const Texture_2D * texture,
+                const float      * lefts,
+                const float      * bottoms,
+                const float      * widths,
+                const float      * heights,
+                size_t             count,
+                int                handling = 0
+            );
+
+            /**
+             * Dibuja de una vez varios cuadrados con la misma textura centrados en (xs[i], ys[i]) y
+             * de lado sizes[i]. El color de la textura se multiplica por el de cada cuadrado (reds,
+             * greens, blues y alphas entre 0 y 1). Está pensado para dibujar partículas.
+             * Por defecto se dibujan uno a uno con fill_rectangle() usando alphas como opacidad.
+             */
+            virtual void fill_particles
+            (
+                const Texture_2D * texture,
+                const float      * xs,
+                const float      * ys,
+                const float      * sizes,
+                const float      * reds,
+                const float      * greens,
+                const float      * blues,
+                const float      * alphas,
+                size_t             count
+            );
+
+        protected:
+
+            /**
+             * Calcula la esquina superior izquierda de un texto de tamaño (width, height) que se
+             * coloca en where según handling.
+             */
+            static Point2f text_origin (const Point2f & where, float width, float height, int handling);
+
         };
 
     }
@@ -13,9 +13,9 @@
 #ifndef BASICS_EVENT_HEADER
 #define BASICS_EVENT_HEADER
 
-    #include <map>
     #include <basics/fnv>
     #include <basics/Id>
+    #include <basics/Tiny_Map>
     #include <basics/Var>
 
     namespace basics
@@ -25,7 +25,10 @@
         {
         public:
 
-            typedef std::map< Id, Var > Property_List;      // REEMPLAZAR POR UN MAPA "LIGERO"
+            // Los eventos habituales (táctiles, de ventana...) tienen como mucho 4 propiedades, que se
+            // guardan dentro del propio evento sin reservar memoria dinámica:
+
+            typedef Tiny_Map< Id, Var, 4 > Property_List;
 
         public:
 
@@ -44,6 +47,17 @@
                 return properties[id];
             }
 
+            /**
+             * Busca una propiedad sin añadirla si no existe (al contrario que operator []).
+             * @return Un puntero a su valor o nullptr si el evento no tiene esa propiedad.
+             */
+            const Var * find (const Id & id) const
+            {
+                auto property = properties.find (id);
+
+                return property != properties.end () ? &property->value : nullptr;
+            }
+
             bool operator < (const Event & other) const
             {
                 return this->priority < other.priority;
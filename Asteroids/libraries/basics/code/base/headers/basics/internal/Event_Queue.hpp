@@ -13,49 +13,64 @@
 #ifndef BASICS_EVENT_QUEUE_HEADER
 #define BASICS_EVENT_QUEUE_HEADER
 
-    #include <queue>
     #include <mutex>
+    #include <utility>
+    #include <vector>
     #include <basics/Event>
 
     namespace basics
     {
 
+        /**
+         * Cola de eventos protegida por un mutex. Los eventos se guardan en un buffer circular que
+         * solo crece cuando se llena, por lo que, una vez alcanzado el tamaño de trabajo, encolar y
+         * desencolar eventos no reserva memoria dinámica.
+         */
         class Event_Queue
         {
 
-            std::queue< Event > queue;
-            std::mutex          mutex;
+            std::vector< Event > ring;
+            size_t               first;
+            size_t               count;
+            std::mutex           mutex;
 
         public:
 
+            Event_Queue() : ring(16), first(0), count(0)
+            {
+            }
+
             void clear ()
             {
-                std::queue< Event >().swap (queue);
+                std::lock_guard< std::mutex > lock(mutex);
+
+                first = count = 0;
             }
 
             void push (const Event & event)
             {
                 std::lock_guard< std::mutex > lock(mutex);
 
-                queue.push (event);
+                slot_for_push () = event;
             }
 
             void push (Event && event)
             {
                 std::lock_guard< std::mutex > lock(mutex);
 
-                queue.push (event);
+                slot_for_push () = std::move (event);
             }
 
             bool poll (Event & event)
             {
                 std::lock_guard< std::mutex > lock(mutex);
 
-                if (queue.size () > 0)
+                if (count > 0)
                 {
-                    event = queue.front ();
+                    event = std::move (ring[first]);
 
-                    queue.pop ();
+                    first = (first + 1) % ring.size ();
+                    count--;
 
                     return true;
                 }
@@ -67,9 +82,9 @@
             {
                 std::lock_guard< std::mutex > lock(mutex);
 
-                if (queue.size () > 0)
+                if (count > 0)
                 {
-                    event = queue.front ();
+                    event = ring[first];
 
                     return true;
                 }
@@ -77,6 +92,29 @@
                 return false;
             }
 
+        private:
+
+            Event & slot_for_push ()
+            {
+                if (count == ring.size ())
+                {
+                    // Se duplica la capacidad dejando los eventos pendientes en orden al principio:
+
+                    std::vector< Event > grown(ring.size () * 2);
+
+                    for (size_t index = 0; index < count; ++index)
+                    {
+                        grown[index] = std::move (ring[(first + index) % ring.size ()]);
+                    }
+
+                    ring.swap (grown);
+
+                    first = 0;
+                }
+
+                return ring[(first + count++) % ring.size ()];
+            }
+
         };
 
     }
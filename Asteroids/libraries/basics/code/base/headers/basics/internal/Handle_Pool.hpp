@@ -0,0 +1,260 @@
+/*
+ * HANDLE POOL
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181750
+ */
+
+#ifndef BASICS_HANDLE_POOL_HEADER
+#define BASICS_HANDLE_POOL_HEADER
+
+    #include <cstdint>
+    #include <new>
+    #include <type_traits>
+    #include <utility>
+    #include <basics/types>
+
+    namespace basics
+    {
+
+        /**
+         * Almacén de capacidad fija para objetos que se crean y se destruyen con frecuencia (balas,
+         * asteroides, elementos de menús...). Los huecos libres se enlazan en una lista, por lo que
+         * crear y destruir objetos no reserva memoria dinámica.
+         * Los objetos se referencian mediante Handles que incluyen la generación del hueco. Cada vez
+         * que un objeto se destruye la generación de su hueco cambia, de modo que los handles que
+         * apuntaban a él dejan de ser válidos aunque el hueco se reutilice.
+         * @tparam ITEM Tipo de los objetos.
+         * @tparam CAPACITY Número máximo de objetos vivos a la vez.
+         */
+        template< typename ITEM, size_t CAPACITY >
+        class Handle_Pool
+        {
+            static_assert(CAPACITY > 0 && CAPACITY < 0xFFFFFFFF, "basics::Handle_Pool error: invalid CAPACITY.");
+
+        public:
+
+            typedef ITEM Item;
+
+            static constexpr size_t   capacity = CAPACITY;
+            static constexpr uint32_t no_index = 0xFFFFFFFF;
+
+            struct Handle
+            {
+                uint32_t index;
+                uint32_t generation;                    ///< Nunca es 0 en un handle válido.
+
+                Handle() : index(no_index), generation(0)
+                {
+                }
+
+                Handle(uint32_t index, uint32_t generation) : index(index), generation(generation)
+                {
+                }
+
+                bool operator == (const Handle & other) const
+                {
+                    return index == other.index && generation == other.generation;
+                }
+
+                bool operator != (const Handle & other) const
+                {
+                    return !(*this == other);
+                }
+            };
+
+        private:
+
+            typedef typename std::aligned_storage< sizeof(Item), alignof(Item) >::type Storage;
+
+            Storage  items      [CAPACITY];
+            uint32_t generations[CAPACITY];             ///< Impar si el hueco está ocupado.
+            uint32_t next_free  [CAPACITY];
+
+            uint32_t first_free;
+            uint32_t count;
+            uint32_t high_water_mark;
+            uint32_t failed_allocations;
+
+        public:
+
+            Handle_Pool()
+            {
+                for (uint32_t index = 0; index < CAPACITY; ++index)
+                {
+                    generations[index] = 0;
+                    next_free  [index] = index + 1 < CAPACITY ? index + 1 : no_index;
+                }
+
+                first_free         = 0;
+                count              = 0;
+                high_water_mark    = 0;
+                failed_allocations = 0;
+            }
+
+           ~Handle_Pool()
+            {
+                clear ();
+            }
+
+            Handle_Pool(const Handle_Pool & ) = delete;
+            Handle_Pool & operator = (const Handle_Pool & ) = delete;
+
+        public:
+
+            /**
+             * Construye un nuevo objeto en un hueco libre.
+             * @return Handle del objeto o un handle no válido si el pool está lleno.
+             */
+            template< typename ...ARGUMENTS >
+            Handle allocate (ARGUMENTS && ...arguments)
+            {
+                if (first_free == no_index)
+                {
+                    failed_allocations++;
+                    return Handle();
+                }
+
+                uint32_t index = first_free;
+
+                first_free = next_free[index];
+
+                new (&items[index]) Item(std::forward< ARGUMENTS >(arguments)...);
+
+                generations[index]++;
+
+                if (++count > high_water_mark) high_water_mark = count;
+
+                return Handle(index, generations[index]);
+            }
+
+            /**
+             * Destruye el objeto al que apunta el handle (si sigue siendo válido).
+             * @return true si se ha destruido o false si el handle no era válido.
+             */
+            bool release (const Handle & handle)
+            {
+                if (!is_valid (handle)) return false;
+
+                release_index (handle.index);
+
+                return true;
+            }
+
+            /**
+             * Destruye todos los objetos.
+             */
+            void clear ()
+            {
+                for (uint32_t index = 0; index < CAPACITY; ++index)
+                {
+                    if (generations[index] & 1) release_index (index);
+                }
+            }
+
+        public:
+
+            bool is_valid (const Handle & handle) const
+            {
+                return handle.index < CAPACITY && handle.generation == generations[handle.index] && (handle.generation & 1);
+            }
+
+            /**
+             * @return Puntero al objeto o nullptr si el handle ya no es válido.
+             */
+            Item * get (const Handle & handle)
+            {
+                return is_valid (handle) ? item_at (handle.index) : nullptr;
+            }
+
+            const Item * get (const Handle & handle) const
+            {
+                return is_valid (handle) ? item_at (handle.index) : nullptr;
+            }
+
+            /**
+             * Acceso por índice para cuando solo se dispone de este (por ejemplo, el dato de usuario
+             * de un cuerpo de Collision_World).
+             * @return Puntero al objeto o nullptr si el hueco está libre.
+             */
+            Item * at (uint32_t index)
+            {
+                return index < CAPACITY && (generations[index] & 1) ? item_at (index) : nullptr;
+            }
+
+            Handle get_handle (uint32_t index) const
+            {
+                return index < CAPACITY && (generations[index] & 1) ? Handle(index, generations[index]) : Handle();
+            }
+
+            /**
+             * Invoca function(handle, item) con cada objeto vivo. Se puede destruir el objeto
+             * visitado desde la propia función.
+             */
+            template< typename FUNCTION >
+            void for_each (FUNCTION function)
+            {
+                for (uint32_t index = 0; index < CAPACITY; ++index)
+                {
+                    if (generations[index] & 1)
+                    {
+                        function (Handle(index, generations[index]), *item_at (index));
+                    }
+                }
+            }
+
+        public:
+
+            // Ocupación del pool:
+
+            size_t size                       () const { return count;              }
+            bool   empty                      () const { return count == 0;         }
+            bool   full                       () const { return count == CAPACITY;  }
+            size_t get_capacity               () const { return CAPACITY;           }
+            size_t get_high_water_mark        () const { return high_water_mark;    }
+            size_t get_failed_allocation_count() const { return failed_allocations; }
+
+            float get_occupancy () const
+            {
+                return float(count) / float(CAPACITY);
+            }
+
+            void reset_statistics ()
+            {
+                high_water_mark    = count;
+                failed_allocations = 0;
+            }
+
+        private:
+
+            Item * item_at (uint32_t index)
+            {
+                return reinterpret_cast< Item * >(&items[index]);
+            }
+
+            const Item * item_at (uint32_t index) const
+            {
+                return reinterpret_cast< const Item * >(&items[index]);
+            }
+
+            void release_index (uint32_t index)
+            {
+                item_at (index)->~Item ();
+
+                generations[index]++;
+                next_free  [index] = first_free;
+                first_free         = index;
+
+                count--;
+            }
+
+        };
+
+    }
+
+#endif
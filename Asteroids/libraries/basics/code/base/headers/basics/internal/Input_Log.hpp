@@ -0,0 +1,146 @@
+/*
+ * INPUT LOG
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181900
+ */
+
+#ifndef BASICS_INPUT_LOG_HEADER
+#define BASICS_INPUT_LOG_HEADER
+
+    #include <string>
+    #include <vector>
+    #include <basics/Touch_Event>
+    #include <basics/types>
+
+    namespace basics
+    {
+
+        /**
+         * Registro de los eventos táctiles que recibe una escena junto con el paso de simulación en
+         * el que se entregaron, la semilla y el paso de tiempo fijo. Junto con una escena
+         * determinista basta para reproducir exactamente una sesión (ver Director::replay()).
+         * Los eventos se acumulan en memoria y se escriben de una vez con save(), de modo que grabar
+         * no hace E/S durante los fotogramas.
+         *
+         * Formato del archivo (little-endian):
+         *   cabecera: "BIL1", semilla (u32), paso de tiempo (f32), número de pasos (u32), número de eventos (u32)
+         *   evento:   paso (u32), id (u32), dedo (i32), x (f32), y (f32), marca de tiempo (i64)
+         */
+        class Input_Log
+        {
+        public:
+
+            struct Record
+            {
+                uint32_t    step;                       ///< Índice del paso de simulación (0 es el primer update() de la escena).
+                Touch_Event touch;                      ///< Con las coordenadas ya en el espacio de la escena.
+            };
+
+            static constexpr size_t header_size = 20;
+            static constexpr size_t record_size = 28;
+
+        private:
+
+            uint32_t              seed;
+            float                 time_step;
+            uint32_t              step_count;
+            std::vector< Record > records;
+
+        public:
+
+            Input_Log()
+            :
+                seed      (0),
+                time_step (1.f / 60.f),
+                step_count(0)
+            {
+            }
+
+            Input_Log(uint32_t seed, float time_step)
+            :
+                seed      (seed),
+                time_step (time_step),
+                step_count(0)
+            {
+            }
+
+        public:
+
+            uint32_t get_seed () const
+            {
+                return seed;
+            }
+
+            float get_time_step () const
+            {
+                return time_step;
+            }
+
+            /**
+             * Número de pasos de simulación que abarca la grabación (incluidos los finales sin eventos).
+             */
+            uint32_t get_step_count () const
+            {
+                return step_count;
+            }
+
+            const std::vector< Record > & get_records () const
+            {
+                return records;
+            }
+
+            bool empty () const
+            {
+                return records.empty ();
+            }
+
+        public:
+
+            void set_step_count (uint32_t new_step_count)
+            {
+                step_count = new_step_count;
+            }
+
+            /**
+             * Añade un evento. Los pasos deben llegar en orden no decreciente.
+             */
+            void add (uint32_t step, const Touch_Event & touch)
+            {
+                records.push_back (Record{ step, touch });
+
+                if (step >= step_count) step_count = step + 1;
+            }
+
+            void clear ()
+            {
+                records.clear ();
+
+                step_count = 0;
+            }
+
+        public:
+
+            /**
+             * Escribe la grabación en un archivo.
+             * @return false si no se ha podido escribir completa.
+             */
+            bool save (const std::string & path) const;
+
+            /**
+             * Lee una grabación de un archivo, sustituyendo el contenido actual.
+             * @return false si el archivo no existe, no tiene el formato esperado o está truncado
+             *     (en cuyo caso el contenido actual no cambia).
+             */
+            bool load (const std::string & path);
+
+        };
+
+    }
+
+#endif
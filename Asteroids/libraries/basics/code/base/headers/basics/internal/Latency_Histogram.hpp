@@ -0,0 +1,97 @@
+/*
+ * LATENCY HISTOGRAM
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181630
+ */
+
+#ifndef BASICS_LATENCY_HISTOGRAM_HEADER
+#define BASICS_LATENCY_HISTOGRAM_HEADER
+
+    #include <string>
+    #include <basics/types>
+
+    namespace basics
+    {
+
+        /**
+         * Histograma de latencias con intervalos de medio milisegundo hasta 128 ms (las latencias
+         * mayores se acumulan en el último intervalo). Registrar una muestra no reserva memoria.
+         */
+        class Latency_Histogram
+        {
+        public:
+
+            static constexpr unsigned bucket_count    = 256;
+            static constexpr int64_t  bucket_width_ns = 500000;
+
+        private:
+
+            uint32_t buckets[bucket_count];
+            uint32_t count;
+            int64_t  total_ns;
+            int64_t  min_ns;
+            int64_t  max_ns;
+
+        public:
+
+            Latency_Histogram()
+            {
+                reset ();
+            }
+
+            void reset ();
+
+            /**
+             * Añade una muestra (en nanosegundos). Las latencias negativas se descartan.
+             */
+            void record (int64_t latency_ns);
+
+        public:
+
+            uint32_t get_count () const
+            {
+                return count;
+            }
+
+            uint32_t get_bucket (unsigned index) const
+            {
+                return buckets[index];
+            }
+
+            float get_min_ms () const
+            {
+                return count ? float(min_ns) * 1e-6f : 0.f;
+            }
+
+            float get_max_ms () const
+            {
+                return count ? float(max_ns) * 1e-6f : 0.f;
+            }
+
+            float get_mean_ms () const
+            {
+                return count ? float(double(total_ns) / count * 1e-6) : 0.f;
+            }
+
+            /**
+             * Retorna el percentil indicado (entre 0 y 1) en milisegundos, con la resolución de un
+             * intervalo del histograma (se retorna el límite superior del intervalo).
+             */
+            float get_percentile_ms (float percentile) const;
+
+            /**
+             * Retorna un resumen legible del histograma (número de muestras, media y percentiles).
+             */
+            std::string summary () const;
+
+        };
+
+    }
+
+#endif
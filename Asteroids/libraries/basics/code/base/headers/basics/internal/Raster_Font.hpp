@@ -14,7 +14,7 @@
 #define BASICS_RASTER_FONT_HEADER
 
     #include <memory>
-    #include <unordered_map>
+    #include <string>
     #include <vector>
     #include <basics/Atlas>
     #include <basics/Font>
@@ -23,6 +23,12 @@
     namespace basics
     {
 
+        /**
+         * Fuente de mapa de bits. Se puede cargar desde el XML de BMFont (.fnt) o desde el formato
+         * binario de Raster_Font_Format (.bfnt), que se lee directamente de la memoria del asset.
+         * Los caracteres de los rangos Basic Latin y Latin-1 se buscan indexando un array y el
+         * resto con una búsqueda binaria.
+         */
         class Raster_Font : public Font
         {
         public:
@@ -42,15 +48,26 @@
 
         private:
 
-            typedef std::unordered_map< uint32_t, Character > Character_Map;
-            typedef std::vector< byte >                       Buffer;
-            typedef std::unique_ptr< Atlas >                  Atlas_Handle;
+            struct Code_Index
+            {
+                uint32_t code;
+                uint32_t index;
+            };
+
+            typedef std::vector< Character >  Character_List;
+            typedef std::vector< Code_Index > Code_Index_List;
+            typedef std::vector< byte >       Buffer;
+            typedef std::unique_ptr< Atlas >  Atlas_Handle;
+
+            static const uint32_t direct_range = 256;       ///< Basic Latin y Latin-1.
 
         private:
 
-            Character_Map character_map;
-            Atlas_Handle  atlas;
-            Metrics       metrics;
+            Character_List  characters;
+            uint32_t        direct_indices[direct_range];   ///< Índice en characters más 1, o 0 si no existe el carácter.
+            Code_Index_List other_indices;                  ///< Caracteres a partir de direct_range ordenados por código.
+            Atlas_Handle    atlas;
+            Metrics         metrics;
 
         public:
 
@@ -63,13 +80,45 @@
                 return metrics;
             }
 
+            /**
+             * Los caracteres sin imagen (como el espacio) tienen slice nulo.
+             */
             const Character * get_character (uint32_t code) const
             {
-                Character_Map::const_iterator item = character_map.find (code);
+                if (code < direct_range)
+                {
+                    uint32_t index = direct_indices[code];
 
-                return item != character_map.end () ? &item->second : nullptr;
+                    return index > 0 ? &characters[index - 1] : nullptr;
+                }
+
+                return find_character (code);
             }
 
+        private:
+
+            const Character * find_character (uint32_t code) const;
+
+            bool add_character
+            (
+                uint32_t code,
+                int      x,
+                int      y,
+                int      width,
+                int      height,
+                int      x_offset,
+                int      y_offset,
+                int      advance
+            );
+
+            bool load_texture (const std::string & path, const std::string & texture_name, Graphics_Context::Accessor & context);
+
+        private:
+
+            static bool is_binary (const byte * data, size_t size);
+
+            bool load_binary  (const byte * data, size_t size, const std::string & path, Graphics_Context::Accessor & context);
+
         private:
 
             bool parse        (Buffer & font_data, const std::string & path, Graphics_Context::Accessor & context);
@@ -0,0 +1,72 @@
+/*
+ * RASTER FONT FORMAT
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181990
+ */
+
+#ifndef BASICS_RASTER_FONT_FORMAT_HEADER
+#define BASICS_RASTER_FONT_FORMAT_HEADER
+
+    #include <basics/types>
+
+    namespace basics
+    {
+
+        /**
+         * Formato binario de las fuentes de Raster_Font (.bfnt). Lo genera font_compiler (ver
+         * libraries/basics/tools) a partir del XML de BMFont y se puede leer directamente desde la
+         * memoria del asset, sin parsear texto. Todos los valores se guardan en little endian.
+         *
+         *   Header
+         *   Character_Record[character_count]     ordenados por código
+         *   char texture_name[texture_name_length] nombre del archivo de la textura (sin ruta)
+         *   char face_name   [face_name_length]
+         */
+        namespace raster_font_format
+        {
+
+            static const uint32_t magic   = 0x544E4642;     // "BFNT"
+            static const uint32_t version = 1;
+
+            struct Header
+            {
+                uint32_t magic;
+                uint32_t version;
+                int32_t  line_height;                       ///< lineHeight de BMFont.
+                int32_t  base;                              ///< base de BMFont.
+                uint32_t character_count;
+                uint32_t texture_name_length;
+                uint32_t face_name_length;
+                uint32_t reserved;
+            };
+
+            /**
+             * Los caracteres sin imagen (como el espacio) tienen ancho y alto 0.
+             */
+            struct Character_Record
+            {
+                uint32_t code;
+                uint16_t x;
+                uint16_t y;
+                uint16_t width;
+                uint16_t height;
+                int16_t  x_offset;
+                int16_t  y_offset;
+                int16_t  advance;
+                uint16_t reserved;
+            };
+
+            static_assert(sizeof(Header)           == 32, "basics::raster_font_format::Header must be packed.");
+            static_assert(sizeof(Character_Record) == 20, "basics::raster_font_format::Character_Record must be packed.");
+
+        }
+
+    }
+
+#endif
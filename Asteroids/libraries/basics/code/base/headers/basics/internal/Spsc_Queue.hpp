@@ -0,0 +1,202 @@
+/*
+ * SPSC QUEUE
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181240
+ */
+
+#ifndef BASICS_SPSC_QUEUE_HEADER
+#define BASICS_SPSC_QUEUE_HEADER
+
+    #include <atomic>
+    #include <thread>
+    #include <utility>
+    #include <basics/types>
+
+    namespace basics
+    {
+
+        /**
+         * Cola circular de capacidad fija sin bloqueos para exactamente un hilo productor y un hilo
+         * consumidor (por ejemplo, el hilo de entrada y el hilo principal). Los elementos se mueven
+         * al encolarlos y al desencolarlos, y no se reserva memoria dinámica.
+         * Si hay más de un productor o más de un consumidor se debe usar Event_Queue.
+         * @tparam ITEM Tipo de los elementos. Debe poder construirse por defecto y moverse.
+         * @tparam CAPACITY Número máximo de elementos pendientes. Debe ser potencia de 2.
+         */
+        template< typename ITEM, size_t CAPACITY >
+        class Spsc_Queue
+        {
+            static_assert(CAPACITY > 1 && (CAPACITY & (CAPACITY - 1)) == 0, "basics::Spsc_Queue error: CAPACITY must be a power of 2.");
+
+        public:
+
+            typedef ITEM Item;
+
+            static constexpr size_t capacity = CAPACITY;
+
+            /**
+             * Qué hacer cuando el productor encuentra la cola llena.
+             */
+            enum Overflow_Policy
+            {
+                DISCARD,            ///< Se descarta el elemento nuevo y se contabiliza en get_dropped_count().
+                WAIT,               ///< El productor cede su turno hasta que el consumidor libere un hueco.
+            };
+
+        private:
+
+            static constexpr size_t mask            = CAPACITY - 1;
+            static constexpr size_t cache_line_size = 64;
+
+            // Cada índice lo escribe un único hilo. Se separan en líneas de caché distintas para que
+            // el productor y el consumidor no se invaliden mutuamente la caché (false sharing):
+
+            alignas(cache_line_size) std::atomic< size_t > head;    ///< Siguiente posición a leer (consumidor).
+            alignas(cache_line_size) std::atomic< size_t > tail;    ///< Siguiente posición a escribir (productor).
+            alignas(cache_line_size) std::atomic< size_t > dropped;
+
+            Overflow_Policy overflow_policy;
+
+            Item items[CAPACITY];
+
+        public:
+
+            Spsc_Queue(Overflow_Policy overflow_policy = DISCARD)
+            :
+                head(0),
+                tail(0),
+                dropped(0),
+                overflow_policy(overflow_policy)
+            {
+            }
+
+            Spsc_Queue(const Spsc_Queue & ) = delete;
+            Spsc_Queue & operator = (const Spsc_Queue & ) = delete;
+
+        public:
+
+            void set_overflow_policy (Overflow_Policy new_policy)
+            {
+                overflow_policy = new_policy;
+            }
+
+            /**
+             * Retorna cuántos elementos se han descartado por encontrar la cola llena.
+             */
+            size_t get_dropped_count () const
+            {
+                return dropped.load (std::memory_order_relaxed);
+            }
+
+            /**
+             * Número aproximado de elementos pendientes (exacto si se llama desde uno de los dos hilos
+             * y el otro no está operando con la cola).
+             */
+            size_t size () const
+            {
+                return tail.load (std::memory_order_acquire) - head.load (std::memory_order_acquire);
+            }
+
+            bool empty () const
+            {
+                return size () == 0;
+            }
+
+        public:
+
+            // Solo se puede llamar desde el hilo productor:
+
+            bool push (const Item & item)
+            {
+                Item copy(item);
+
+                return push (std::move (copy));
+            }
+
+            bool push (Item && item)
+            {
+                return push (std::move (item), overflow_policy);
+            }
+
+            /**
+             * Encola un elemento aplicando la política indicada en lugar de la de la cola (por ejemplo,
+             * para esperar solo con los elementos que no se pueden perder).
+             */
+            bool push (Item && item, Overflow_Policy policy)
+            {
+                size_t position = tail.load (std::memory_order_relaxed);
+
+                while (position - head.load (std::memory_order_acquire) == CAPACITY)
+                {
+                    if (policy == DISCARD)
+                    {
+                        dropped.fetch_add (1, std::memory_order_relaxed);
+
+                        return false;
+                    }
+
+                    std::this_thread::yield ();
+                }
+
+                items[position & mask] = std::move (item);
+
+                tail.store (position + 1, std::memory_order_release);
+
+                return true;
+            }
+
+        public:
+
+            // Solo se puede llamar desde el hilo consumidor:
+
+            bool poll (Item & item)
+            {
+                size_t position = head.load (std::memory_order_relaxed);
+
+                if (position == tail.load (std::memory_order_acquire))
+                {
+                    return false;
+                }
+
+                item = std::move (items[position & mask]);
+
+                head.store (position + 1, std::memory_order_release);
+
+                return true;
+            }
+
+            /**
+             * Desencola de una vez hasta max_count elementos y los mueve al array indicado. Solo se
+             * sincroniza con el productor una vez por lote.
+             * @return El número de elementos desencolados.
+             */
+            size_t poll (Item * output, size_t max_count)
+            {
+                size_t position  = head.load (std::memory_order_relaxed);
+                size_t available = tail.load (std::memory_order_acquire) - position;
+                size_t count     = available < max_count ? available : max_count;
+
+                for (size_t index = 0; index < count; ++index)
+                {
+                    output[index] = std::move (items[(position + index) & mask]);
+                }
+
+                if (count > 0)
+                {
+                    head.store (position + count, std::memory_order_release);
+                }
+
+                return count;
+            }
+
+        };
+
+    }
+
+#endif
@@ -51,6 +51,11 @@
 
             Text_Layout(const Raster_Font & font, const std::wstring & text);
 
+            /**
+             * Vuelve a maquetar otro texto reutilizando la memoria de los glifos anteriores.
+             */
+            void assign (const Raster_Font & font, const std::wstring & text);
+
         public:
 
             const Glyph_List & get_glyphs () const
@@ -0,0 +1,105 @@
+/*
+ * TEXT LAYOUT CACHE
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181980
+ */
+
+#ifndef BASICS_TEXT_LAYOUT_CACHE_HEADER
+#define BASICS_TEXT_LAYOUT_CACHE_HEADER
+
+    #include <string>
+    #include <vector>
+    #include <basics/Raster_Font>
+    #include <basics/Text_Layout>
+    #include <basics/types>
+
+    namespace basics
+    {
+
+        /**
+         * Caché LRU de Text_Layout indexada por fuente y texto. Sirve para los textos que cambian
+         * (marcadores, contadores...) pero que suelen repetirse de un fotograma a otro, de modo que
+         * solo se maqueta un texto cuando no se ha usado recientemente. Cuando se llena se descarta
+         * el que lleva más tiempo sin usarse.
+         * Como la capacidad es pequeña, las entradas se guardan en un array y se buscan
+         * comparando primero su hash, lo que resulta más rápido que una lista con un mapa y no
+         * reserva memoria al buscar. Al descartar una entrada se reutiliza la memoria de su texto
+         * y de sus glifos.
+         * Los textos que cambian en cada fotograma (un cronómetro con décimas, coordenadas...) no
+         * deben pasar por la caché: como nunca se repiten, cada get() falla y al coste de maquetar
+         * se suman el hash y la búsqueda, por lo que resulta más caro que construir directamente
+         * un Text_Layout.
+         * Las fuentes no deben destruirse mientras haya textos suyos en la caché (ver clear()).
+         */
+        class Text_Layout_Cache
+        {
+
+            struct Entry
+            {
+                const Raster_Font * font;
+                size_t              hash;
+                uint64_t            last_use;
+                std::wstring        text;
+                Text_Layout         layout;
+
+                Entry(const Raster_Font & font, size_t hash, const std::wstring & text)
+                :
+                    font    (&font),
+                    hash    ( hash),
+                    last_use(0),
+                    text    ( text),
+                    layout  ( font, text)
+                {
+                }
+            };
+
+        private:
+
+            std::vector< Entry > entries;               ///< Nunca crece más allá de capacity, por lo que no se mueven.
+            size_t               capacity;
+            uint64_t             clock;                 ///< Se incrementa en cada get() para saber qué entrada se usó antes.
+
+        public:
+
+            Text_Layout_Cache(size_t capacity = 32);
+
+            Text_Layout_Cache(const Text_Layout_Cache & ) = delete;
+            Text_Layout_Cache & operator = (const Text_Layout_Cache & ) = delete;
+
+        public:
+
+            /**
+             * Devuelve la maquetación de text con font y la marca como la usada más recientemente.
+             * La referencia deja de ser válida cuando la entrada se descarta, lo que puede ocurrir
+             * en cualquier llamada posterior a get(), por lo que no conviene guardarla.
+             */
+            const Text_Layout & get (const Raster_Font & font, const std::wstring & text);
+
+            void clear ()
+            {
+                entries.clear ();
+            }
+
+        public:
+
+            size_t size () const
+            {
+                return entries.size ();
+            }
+
+            size_t get_capacity () const
+            {
+                return capacity;
+            }
+
+        };
+
+    }
+
+#endif
@@ -13,18 +13,80 @@
 #ifndef BASICS_TEXT_PREFAB_HEADER
 #define BASICS_TEXT_PREFAB_HEADER
 
+    #include <memory>
+    #include <basics/Graphics_Context>
+    #include <basics/Graphics_Resource>
+    #include <basics/Id>
     #include <basics/Text_Layout>
 
     namespace basics
     {
 
-        class Text_Prefab
+        /**
+         * Texto ya maquetado que se guarda en la memoria de la GPU para dibujarlo con una sola
+         * llamada. Es útil con los textos que no cambian (títulos, etiquetas del HUD...). Con los
+         * textos que cambian a menudo es mejor usar un Text_Layout_Cache.
+         * Se crea con create() y, como las texturas, se debe añadir al contexto gráfico para que
+         * se inicialice.
+         */
+        class Text_Prefab : public Graphics_Resource
         {
         public:
 
-            Text_Prefab() = default;
+            typedef std::shared_ptr< Text_Prefab > (* Factory) (const Text_Layout & layout);
+
+        private:
+
+            static Id      text_prefab_specialization_ids      [10];
+            static Factory text_prefab_specialization_factories[10];
+            static size_t  text_prefab_specialization_count;
+
+        public:
+
+            static void register_factory (Id id, Factory factory)
+            {
+                text_prefab_specialization_ids      [text_prefab_specialization_count] = id;
+                text_prefab_specialization_factories[text_prefab_specialization_count] = factory;
+                text_prefab_specialization_count++;
+            }
+
+        public:
+
+            static std::shared_ptr< Text_Prefab > create (Graphics_Context::Accessor & context, const Text_Layout & layout);
+
+        protected:
+
+            Text_Layout layout;
+
+        protected:
+
+            Text_Prefab(const Text_Layout & layout)
+            :
+                layout(layout)
+            {
+            }
+
+        public:
+
             virtual ~Text_Prefab() = default;
 
+        public:
+
+            const Text_Layout & get_layout () const
+            {
+                return layout;
+            }
+
+            float get_width () const
+            {
+                return layout.get_width ();
+            }
+
+            float get_height () const
+            {
+                return layout.get_height ();
+            }
+
         };
 
     }
@@ -0,0 +1,102 @@
+/*
+ * THREAD POOL
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181910
+ */
+
+#ifndef BASICS_THREAD_POOL_HEADER
+#define BASICS_THREAD_POOL_HEADER
+
+    #include <condition_variable>
+    #include <deque>
+    #include <functional>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+    #include <basics/Non_Copyable>
+    #include <basics/types>
+
+    namespace basics
+    {
+
+        /**
+         * Conjunto fijo de hilos que ejecutan las tareas que se le encargan en orden de llegada.
+         * Está pensado para repartir trabajo independiente y de grano grueso (por ejemplo, varias
+         * simulaciones completas) entre los núcleos, no para tareas de microsegundos: cada tarea
+         * pasa por una cola protegida con un mutex.
+         */
+        class Thread_Pool : Non_Copyable
+        {
+        public:
+
+            typedef std::function< void () > Task;
+
+        private:
+
+            std::vector< std::thread > threads;
+            std::deque < Task        > tasks;
+
+            std::mutex                 mutex;
+            std::condition_variable    task_available;
+            std::condition_variable    all_done;
+
+            size_t                     busy_count;      ///< Tareas que se están ejecutando en este momento.
+            bool                       stopping;
+
+        public:
+
+            /**
+             * @param thread_count Número de hilos. Si es 0 se usa el número de núcleos disponibles.
+             */
+            Thread_Pool(unsigned thread_count = 0);
+
+           ~Thread_Pool();
+
+        public:
+
+            static unsigned get_hardware_thread_count ()
+            {
+                unsigned count = std::thread::hardware_concurrency ();
+
+                return count > 0 ? count : 1;
+            }
+
+            unsigned get_thread_count () const
+            {
+                return unsigned(threads.size ());
+            }
+
+        public:
+
+            /**
+             * Encarga una tarea. Puede llamarse desde cualquier hilo, incluidos los del pool.
+             */
+            void submit (Task task);
+
+            /**
+             * Espera hasta que se han ejecutado todas las tareas encargadas. No debe llamarse desde
+             * una tarea del propio pool.
+             */
+            void wait ();
+
+            /**
+             * Ejecuta function(index) para cada index en [0, count) repartiendo los índices entre los
+             * hilos en bloques contiguos, y espera a que terminen todos.
+             */
+            void parallel_for (size_t count, const std::function< void (size_t) > & function);
+
+        private:
+
+            void work ();
+
+        };
+
+    }
+
+#endif
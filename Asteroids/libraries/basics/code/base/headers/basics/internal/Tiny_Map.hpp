@@ -13,115 +13,249 @@
 #ifndef BASICS_TINY_MAP_HEADER
 #define BASICS_TINY_MAP_HEADER
 
+    #include <utility>
+    #include <vector>
     #include <basics/types>
-    #include <basics/assert>
 
     namespace basics
     {
 
+        /**
+         * Mapa asociativo pensado para unos pocos elementos. Los primeros CAPACITY elementos se
+         * guardan dentro del propio objeto, por lo que no se reserva memoria dinámica mientras no se
+         * supere esa cantidad. Los elementos que no caben se guardan en un vector aparte.
+         * Las búsquedas son lineales y se mantiene el orden de inserción.
+         */
         template< typename KEY, typename VALUE, size_t CAPACITY >
         class Tiny_Map
         {
+            static_assert(CAPACITY > 0, "basics::Tiny_Map error: CAPACITY must be greater than zero.");
+
+        public:
+
             typedef KEY   Key;
             typedef VALUE Value;
 
-            static constexpr size_t capacity = CAPACITY;
+            static constexpr size_t inline_capacity = CAPACITY;
 
             struct Item
             {
                 Key   key;
-                Value value,
+                Value value;
             };
 
-            template< class ITEM >
+        private:
+
+            template< class MAP, class ITEM >
             class Iterator_Template
             {
 
-                ITEM * item;
+                MAP  * map;
+                size_t index;
 
             public:
 
-                Iterator()            : item(nullptr) { }
-                Iterator(Item * item) : item(item   ) { }
+                Iterator_Template() : map(nullptr), index(0) { }
+                Iterator_Template(MAP * map, size_t index) : map(map), index(index) { }
+
+                ITEM & operator  * () const { return  map->item_at (index); }
+                ITEM * operator -> () const { return &map->item_at (index); }
 
-                      Value & operator  * ()       { return  item->value; }
-                const Value & operator  * () const { return  item->value; }
+                Iterator_Template & operator ++ ()
+                {
+                    return ++index, *this;
+                }
 
-                      Value * operator -> ()       { return &item->value; }
-                const Value * operator -> () const { return &item->value; }
+                bool operator == (const Iterator_Template & other) const
+                {
+                    return index == other.index && map == other.map;
+                }
 
-                operator bool () const
+                bool operator != (const Iterator_Template & other) const
                 {
-                    return item != nullptr;
+                    return !(*this == other);
                 }
+
             };
 
         public:
 
-            typedef Iterator_Template<       Item >       Iterator;
-            typedef Iterator_Template< const Item > Const_Iterator;
+            typedef Iterator_Template<       Tiny_Map,       Item >       Iterator;
+            typedef Iterator_Template< const Tiny_Map, const Item > Const_Iterator;
 
         private:
 
-            Item   items[capacity];
-            size_t count;
+            Item                items[CAPACITY];
+            std::vector< Item > spill;
+            size_t              item_count;
 
         public:
 
-            size_t size () const
+            Tiny_Map() : item_count(0)
             {
-                return count;
             }
 
-            size_t capacity () const
+            Tiny_Map(const Tiny_Map & ) = default;
+
+            Tiny_Map(Tiny_Map && other) : spill(std::move (other.spill)), item_count(other.item_count)
             {
-                return capacity;
+                move_inline_items (other);
+            }
+
+            Tiny_Map & operator = (const Tiny_Map & ) = default;
+
+            Tiny_Map & operator = (Tiny_Map && other)
+            {
+                if (this != &other)
+                {
+                    spill = std::move (other.spill);
+                    item_count = other.item_count;
+
+                    move_inline_items (other);
+                }
+
+                return *this;
             }
 
         public:
 
-            Iterator begin ()
+            size_t size () const
             {
-                return Iterator(items[0]);
+                return item_count;
             }
 
-            Const_Iterator cbegin () const
+            bool empty () const
             {
-                return Const_Iterator(items[0]);
+                return item_count == 0;
             }
 
-            Iterator end ()
+            /**
+             * Retorna true si los elementos ya no caben en el almacenamiento interno y se ha tenido
+             * que reservar memoria dinámica.
+             */
+            bool spilled () const
             {
-                return Iterator(items[count]);
+                return item_count > CAPACITY;
             }
 
-            Const_Iterator cend () const
+            void clear ()
             {
-                return Const_Iterator(items[count]);
+                spill.clear ();
+                item_count = 0;
             }
 
         public:
 
+            Iterator       begin ()       { return       Iterator(this, 0); }
+            Const_Iterator begin () const { return Const_Iterator(this, 0); }
+            Iterator       end   ()       { return       Iterator(this, item_count); }
+            Const_Iterator end   () const { return Const_Iterator(this, item_count); }
+
+            Const_Iterator cbegin () const { return begin (); }
+            Const_Iterator cend   () const { return end   (); }
+
+        public:
+
+            Iterator find (const Key & key)
+            {
+                return Iterator(this, index_of (key));
+            }
+
+            Const_Iterator find (const Key & key) const
+            {
+                return Const_Iterator(this, index_of (key));
+            }
+
+            size_t count (const Key & key) const
+            {
+                return index_of (key) < item_count ? 1 : 0;
+            }
+
+            /**
+             * Retorna una referencia al valor asociado a la clave indicada. Si no existe, se añade
+             * con un valor construido por defecto.
+             */
             Value & operator [] (const Key & key)
             {
-                for (size_t  index = 0; index < count; ++index)
+                size_t index = index_of (key);
+
+                if (index == item_count)
+                {
+                    if (item_count < CAPACITY)
+                    {
+                        items[item_count].key   = key;
+                        items[item_count].value = Value();
+                    }
+                    else
+                    {
+                        spill.push_back (Item{ key, Value() });
+                    }
+
+                    ++item_count;
+                }
+
+                return item_at (index).value;
+            }
+
+            /**
+             * Elimina el elemento con la clave indicada (si existe). No se conserva el orden: el
+             * último elemento pasa a ocupar el hueco del eliminado.
+             * @return true si se ha eliminado algún elemento.
+             */
+            bool erase (const Key & key)
+            {
+                size_t index = index_of (key);
+
+                if (index == item_count)
                 {
-                    if (item[index].key == key) return item[index].value;
+                    return false;
                 }
 
-                assert(count < capacity);
+                if (index != item_count - 1)
+                {
+                    item_at (index) = std::move (item_at (item_count - 1));
+                }
+
+                if (item_count > CAPACITY) spill.pop_back ();
+
+                --item_count;
 
-                return item[count].key = key, item[count++];
+                return true;
+            }
+
+        private:
+
+            size_t index_of (const Key & key) const
+            {
+                size_t index = 0;
+
+                for (; index < item_count; ++index)
+                {
+                    if (item_at (index).key == key) break;
+                }
+
+                return index;
+            }
+
+            Item & item_at (size_t index)
+            {
+                return index < CAPACITY ? items[index] : spill[index - CAPACITY];
+            }
+
+            const Item & item_at (size_t index) const
+            {
+                return index < CAPACITY ? items[index] : spill[index - CAPACITY];
             }
 
-            const Value & operator [] (const Key & key) const
+            void move_inline_items (Tiny_Map & other)
             {
-                for (auto & item : items)
+                for (size_t index = 0, end = item_count < CAPACITY ? item_count : CAPACITY; index < end; ++index)
                 {
-                    if (item.key == key) return item.value;
+                    items[index] = std::move (other.items[index]);
                 }
 
-                return *reinterpret_cast< Value * >(nullptr);
+                other.spill.clear ();
+                other.item_count = 0;
             }
 
         };
@@ -0,0 +1,93 @@
+/*
+ * TOUCH EVENT
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181430
+ */
+
+#ifndef BASICS_TOUCH_EVENT_HEADER
+#define BASICS_TOUCH_EVENT_HEADER
+
+    #include <basics/Event>
+    #include <basics/Id>
+    #include <basics/types>
+
+    namespace basics
+    {
+
+        /**
+         * Evento táctil con los campos tipados. Es la vía rápida para los toques: no reserva memoria,
+         * se copia con memcpy y sus campos se leen sin búsquedas ni comprobaciones de tipo.
+         * El resto de eventos siguen usando Event.
+         */
+        struct Touch_Event
+        {
+            Id      id;                                 ///< ID(touch-started), ID(touch-moved) o ID(touch-ended).
+            int32_t pointer;                            ///< Identificador del dedo (estable mientras dura el toque).
+            float   x;
+            float   y;
+            int64_t timestamp;                          ///< Nanosegundos de CLOCK_MONOTONIC (0 si se desconoce).
+
+            static bool is_touch (Id id)
+            {
+                return id == ID(touch-started) || id == ID(touch-moved) || id == ID(touch-ended);
+            }
+
+            /**
+             * Construye un Touch_Event a partir de un Event táctil con las propiedades id, x, y y time
+             * (las que falten o no tengan el tipo esperado se consideran cero). El evento no se
+             * modifica.
+             */
+            static Touch_Event from (const Event & event)
+            {
+                const var::Int32 * pointer = property< var::Int32 > (event, ID(id)  );
+                const var::Float * x       = property< var::Float > (event, ID(x)   );
+                const var::Float * y       = property< var::Float > (event, ID(y)   );
+                const var::Int64 * time    = property< var::Int64 > (event, ID(time));
+
+                return Touch_Event
+                {
+                    event.id,
+                    pointer ? int32_t(*pointer) : 0,
+                    x       ? float  (*x      ) : 0.f,
+                    y       ? float  (*y      ) : 0.f,
+                    time    ? int64_t(*time   ) : 0
+                };
+            }
+
+            /**
+             * Convierte el evento táctil en un Event genérico (para las escenas que no usan la vía
+             * rápida).
+             */
+            Event to_event () const
+            {
+                Event event(id);
+
+                event[ID(id)  ] = pointer;
+                event[ID(x)   ] = x;
+                event[ID(y)   ] = y;
+                event[ID(time)] = timestamp;
+
+                return event;
+            }
+
+        private:
+
+            template< typename TYPE >
+            static const TYPE * property (const Event & event, Id id)
+            {
+                const Var * value = event.find (id);
+
+                return value ? value->as< TYPE > () : nullptr;
+            }
+
+        };
+
+    }
+
+#endif
@@ -13,49 +13,152 @@
 #ifndef BASICS_TOUCH_SURFACE_HEADER
 #define BASICS_TOUCH_SURFACE_HEADER
 
+    #include <atomic>
     #include <basics/Input_Device>
+    #include <basics/Touch_Event>
 
     namespace basics
     {
 
+        /**
+         * Permite consultar el estado de todos los dedos que tocan la pantalla en lugar de (o además
+         * de) procesar los eventos táctiles uno a uno.
+         * El hilo de entrada registra cada toque con record() y publica el resultado con publish().
+         * El hilo principal obtiene una copia coherente con read() una vez por fotograma. Ambos
+         * hilos se comunican mediante un triple buffer, por lo que ninguno de los dos se bloquea.
+         */
         class Touch_Surface : public Input_Device
         {
         public:
 
+            static constexpr unsigned max_touches = 10;
+
             struct Touch
             {
-                int id;
+                int   id;
+                float x;
+                float y;
+                bool  down;                             ///< El dedo se ha apoyado desde la lectura anterior.
+                bool  held;                             ///< El dedo sigue apoyado en el momento de la lectura.
+                bool  up;                               ///< El dedo se ha levantado desde la lectura anterior.
+            };
+
+        private:
+
+            // Estado de un dedo tal como lo ve el hilo de entrada. Los contadores solo crecen, de modo
+            // que el lector puede detectar pulsaciones y liberaciones aunque ocurran ambas entre dos
+            // lecturas (por ejemplo, un toque muy rápido):
+
+            struct Pointer
+            {
+                int32_t  id;
+                float    x;
+                float    y;
+                bool     pressed;
+                uint32_t presses;
+                uint32_t releases;
+            };
+
+            struct Snapshot
+            {
+                Pointer  pointers[max_touches];
+                unsigned count;
             };
 
         public:
 
             class State
             {
+
+                Touch    touches[max_touches];
+                unsigned count;
+
+                uint32_t last_presses [max_touches];
+                uint32_t last_releases[max_touches];
+
+                friend class Touch_Surface;
+
             public:
 
-                int touch_count () const;
+                State();
+
+                int touch_count () const
+                {
+                    return int(count);
+                }
 
-                const Touch & get_touch (int index) const;
+                const Touch & get_touch (int index) const
+                {
+                    return touches[index];
+                }
+
+                /**
+                 * Retorna el toque del dedo con el id indicado o nullptr si no está en el estado.
+                 */
+                const Touch * find_touch (int id) const;
 
             };
 
+        private:
+
+            static constexpr uint8_t index_mask = 0x03;
+            static constexpr uint8_t fresh_flag = 0x04;
+
+            Snapshot              buffers[3];
+            Snapshot              working;              ///< Solo lo usa el hilo de entrada.
+            uint8_t               back;                 ///< Solo lo usa el hilo de entrada.
+            uint8_t               front;                ///< Solo lo usa el lector.
+            std::atomic< uint8_t > middle;              ///< Índice intercambiado entre ambos (+ fresh_flag).
+
         protected:
 
-            Touch_Surface() = default;
+            Touch_Surface();
             virtual ~Touch_Surface() = default;
 
         public:
 
-            Id get_id () const
+            Id get_id () const override
             {
                 return FNV(touch-surface);
             }
 
-            const char * get_name () const
+            const char * get_name () const override
             {
                 return "touch surface";
             }
 
+            bool has_state () const override { return true;  }
+            bool has_queue () const override { return false; }
+            bool keep_state (bool keep) override { return keep;  }
+            bool keep_queue (bool keep) override { return !keep; }
+
+        public:
+
+            /**
+             * Actualiza el estado del dedo al que se refiere el evento. Solo lo puede llamar el hilo
+             * de entrada. El cambio no es visible para el lector hasta que se llama a publish().
+             */
+            void record (const Touch_Event & touch);
+
+            /**
+             * Hace visible para el lector el estado registrado hasta el momento.
+             */
+            void publish ();
+
+            /**
+             * Actualiza state con el último estado publicado. Las coordenadas se transforman como
+             * x' = x * x_scale, y' = (flip_height - y) * y_scale (se puede usar flip_height = 0 y
+             * y_scale = -1 para no invertir el eje Y). Los flancos down/up son relativos a la anterior
+             * lectura hecha sobre el mismo state, por lo que debe haber un único lector por State.
+             */
+            void read (State & state, float x_scale = 1.f, float y_scale = -1.f, float flip_height = 0.f);
+
+            /**
+             * Olvida todos los dedos (incluido lo ya publicado). Solo se puede llamar cuando ningún
+             * otro hilo está usando la superficie. Los State leídos antes se deben descartar.
+             */
+            void clear ();
+
         };
 
         extern Touch_Surface * const touch_surface;
@@ -111,6 +111,12 @@
                 return value.type_info ().id == TYPE::id ? static_cast< TYPE * >(&value) : nullptr;
             }
 
+            template< typename TYPE >
+            const TYPE * as () const
+            {
+                return value.type_info ().id == TYPE::id ? static_cast< const TYPE * >(&value) : nullptr;
+            }
+
             // AL CONTRARIO QUE EL MÉTODO AS(), EL MÉTODO TO() REALIZA CONVERSIÓN ENTRE TIPOS.
             // UNA PLANTILLA INDEX_OF<TYPE> DEVOLVERÍA EL ÍNDICE EN LA TABLA DE CONVERSIÓN DE UN TIPO
             // CUALQUIERA EN TIEMPO DE COMPILACIÓN. SI NO EXISTE EL ÍNDICE O SI LA ENTRADA EN DICHO
@@ -211,6 +217,37 @@
 
             // -------------------------------------------------------------------------------------
 
+            class Int64 : public Var::Type
+            {
+            public:
+
+                static constexpr Id   id = ID(basics::var::Int64);
+                static const     Info info;
+
+            public:
+
+                Int64() : Type(&info)
+                {
+                }
+
+                Int64(int64_t x) : Type(&info)
+                {
+                    *this = x;
+                }
+
+                Int64 & operator = (const int64_t value)
+                {
+                    return data< int64_t > () = value, *this;
+                }
+
+                operator const int64_t & () const
+                {
+                    return data< int64_t > ();
+                }
+            };
+
+            // -------------------------------------------------------------------------------------
+
             class Float : public Var::Type
             {
             public:
@@ -285,6 +322,7 @@
 
         template< > inline Var & Var::operator = < bool    > (const bool    & x) { return value = var::Bool (x), *this; }
         template< > inline Var & Var::operator = < int32_t > (const int32_t & x) { return value = var::Int32(x), *this; }
+        template< > inline Var & Var::operator = < int64_t > (const int64_t & x) { return value = var::Int64(x), *this; }
         template< > inline Var & Var::operator = < float   > (const float   & x) { return value = var::Float(x), *this; }
 
     }
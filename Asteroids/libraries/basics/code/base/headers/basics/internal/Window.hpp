@@ -240,7 +240,7 @@
 
             void push (Event && event)
             {
-                event_queue.push (event);
+                event_queue.push (std::move (event));
             }
 
             bool poll (Event & event)
@@ -34,14 +34,73 @@ namespace basics
         return nullptr;
     }
 
+    void Canvas::fill_rectangles
+    (
+        const Texture_2D * texture,
+        const float      * lefts,
+        const float      * bottoms,
+        const float      * widths,
+        const float      * heights,
+        size_t             count,
+        int                handling
+    )
+    {
+        handling = BOTTOM | LEFT | (handling & (FLIP_HORIZONTAL | FLIP_VERTICAL));
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            fill_rectangle ({ lefts[index], bottoms[index] }, { widths[index], heights[index] }, texture, handling);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Canvas::fill_particles
+    (
+        const Texture_2D * texture,
+        const float      * xs,
+        const float      * ys,
+        const float      * sizes,
+        const float      * ,
+        const float      * ,
+        const float      * ,
+        const float      * alphas,
+        size_t             count
+    )
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            set_opacity    (alphas[index]);
+            fill_rectangle ({ xs[index], ys[index] }, { sizes[index], sizes[index] }, texture, CENTER);
+        }
+
+        set_opacity (1.f);
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
     void Canvas::draw_text (const Point2f & where, const Text_Layout & text_layout, int handling)
     {
         const Text_Layout::Glyph_List & glyphs = text_layout.get_glyphs ();
 
-        float width  = text_layout.get_width  ();
-        float height = text_layout.get_height ();
-        float left   = where[0];
-        float top    = where[1];
+        Point2f origin = text_origin (where, text_layout.get_width (), text_layout.get_height (), handling);
+
+        for (auto & glyph : glyphs)
+        {
+            fill_rectangle
+            (
+                { origin[0] + glyph.position[0], origin[1] + glyph.position[1] },
+                glyph.size,
+                glyph.slice,
+                TOP | LEFT
+            );
+        }
+    }
+
+    Point2f Canvas::text_origin (const Point2f & where, float width, float height, int handling)
+    {
+        float left = where[0];
+        float top  = where[1];
 
         switch (handling & 0x03)
         {
@@ -57,16 +116,7 @@ namespace basics
             default:     break;
         }
 
-        for (auto & glyph : glyphs)
-        {
-            fill_rectangle
-            (
-                { left + glyph.position[0], top + glyph.position[1] },
-                glyph.size,
-                glyph.slice,
-                TOP | LEFT
-            );
-        }
+        return Point2f{ left, top };
     }
 
 }
@@ -0,0 +1,179 @@
+/*
+ * INPUT LOG
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181901
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <basics/Input_Log>
+
+namespace basics
+{
+
+    // Los valores se serializan byte a byte en little-endian para que el archivo no dependa del
+    // relleno de las estructuras ni del orden de bytes de la plataforma (los float se tratan como
+    // su representación binaria de 32 bits):
+
+    namespace
+    {
+
+        typedef std::unique_ptr< std::FILE, int (*)(std::FILE *) > File;
+
+        const char magic[4] = { 'B', 'I', 'L', '1' };
+
+        template< typename TYPE >
+        using Bits = typename std::conditional< sizeof(TYPE) == 8, uint64_t, uint32_t >::type;
+
+        template< typename TYPE >
+        uint8_t * put (uint8_t * buffer, TYPE value)
+        {
+            static_assert(sizeof(TYPE) == 4 || sizeof(TYPE) == 8, "Input_Log: unexpected field size.");
+
+            Bits< TYPE > bits;
+
+            std::memcpy (&bits, &value, sizeof(TYPE));
+
+            for (size_t index = 0; index < sizeof(TYPE); ++index) *buffer++ = uint8_t(bits >> (8 * index));
+
+            return buffer;
+        }
+
+        template< typename TYPE >
+        const uint8_t * get (const uint8_t * buffer, TYPE & value)
+        {
+            Bits< TYPE > bits = 0;
+
+            for (size_t index = 0; index < sizeof(TYPE); ++index) bits |= Bits< TYPE >(buffer[index]) << (8 * index);
+
+            std::memcpy (&value, &bits, sizeof(TYPE));
+
+            return buffer + sizeof(TYPE);
+        }
+
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    bool Input_Log::save (const std::string & path) const
+    {
+        File file(std::fopen (path.c_str (), "wb"), std::fclose);
+
+        if (!file) return false;
+
+        uint8_t header[header_size];
+
+        std::memcpy (header, magic, 4);
+
+        uint8_t * cursor = header + 4;
+
+        cursor = put (cursor, seed);
+        cursor = put (cursor, time_step);
+        cursor = put (cursor, step_count);
+        cursor = put (cursor, uint32_t(records.size ()));
+
+        if (std::fwrite (header, header_size, 1, file.get ()) != 1) return false;
+
+        // Los eventos se escriben por bloques para no hacer una llamada por cada uno:
+
+        static constexpr size_t block_records = 256;
+
+        uint8_t block[block_records * record_size];
+
+        for (size_t first = 0; first < records.size (); first += block_records)
+        {
+            size_t count = std::min (block_records, records.size () - first);
+
+            cursor = block;
+
+            for (size_t index = first; index < first + count; ++index)
+            {
+                const Record & record = records[index];
+
+                cursor = put (cursor, record.step);
+                cursor = put (cursor, uint32_t(record.touch.id));
+                cursor = put (cursor, record.touch.pointer);
+                cursor = put (cursor, record.touch.x);
+                cursor = put (cursor, record.touch.y);
+                cursor = put (cursor, record.touch.timestamp);
+            }
+
+            if (std::fwrite (block, record_size, count, file.get ()) != count) return false;
+        }
+
+        return std::fflush (file.get ()) == 0;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    bool Input_Log::load (const std::string & path)
+    {
+        File file(std::fopen (path.c_str (), "rb"), std::fclose);
+
+        if (!file) return false;
+
+        uint8_t header[header_size];
+
+        if (std::fread (header, header_size, 1, file.get ()) != 1 || std::memcmp (header, magic, 4) != 0)
+        {
+            return false;
+        }
+
+        uint32_t loaded_seed;
+        float    loaded_time_step;
+        uint32_t loaded_step_count;
+        uint32_t loaded_record_count;
+
+        const uint8_t * cursor = header + 4;
+
+        cursor = get (cursor, loaded_seed);
+        cursor = get (cursor, loaded_time_step);
+        cursor = get (cursor, loaded_step_count);
+        cursor = get (cursor, loaded_record_count);
+
+        // No se reserva de golpe lo que indica la cabecera por si el archivo está dañado:
+
+        std::vector< Record > loaded_records;
+
+        loaded_records.reserve (std::min< uint32_t > (loaded_record_count, 4096));
+
+        uint8_t buffer[record_size];
+
+        for (uint32_t count = 0; count < loaded_record_count; ++count)
+        {
+            if (std::fread (buffer, record_size, 1, file.get ()) != 1) return false;
+
+            loaded_records.emplace_back ();
+
+            Record & record = loaded_records.back ();
+            uint32_t id;
+
+            cursor = buffer;
+            cursor = get (cursor, record.step);
+            cursor = get (cursor, id);
+            cursor = get (cursor, record.touch.pointer);
+            cursor = get (cursor, record.touch.x);
+            cursor = get (cursor, record.touch.y);
+            cursor = get (cursor, record.touch.timestamp);
+
+            record.touch.id = Id(id);
+        }
+
+        seed       = loaded_seed;
+        time_step  = loaded_time_step;
+        step_count = loaded_step_count;
+        records.swap (loaded_records);
+
+        return true;
+    }
+
+}
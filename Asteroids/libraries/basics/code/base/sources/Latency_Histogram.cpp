@@ -0,0 +1,86 @@
+/*
+ * LATENCY HISTOGRAM
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181636
+ */
+
+#include <cstdio>
+#include <basics/Latency_Histogram>
+
+namespace basics
+{
+
+    void Latency_Histogram::reset ()
+    {
+        for (auto & bucket : buckets) bucket = 0;
+
+        count    = 0;
+        total_ns = 0;
+        min_ns   = 0;
+        max_ns   = 0;
+    }
+
+    void Latency_Histogram::record (int64_t latency_ns)
+    {
+        if (latency_ns >= 0)
+        {
+            int64_t index = latency_ns / bucket_width_ns;
+
+            buckets[index < bucket_count ? index : bucket_count - 1]++;
+
+            if (count == 0 || latency_ns < min_ns) min_ns = latency_ns;
+            if (count == 0 || latency_ns > max_ns) max_ns = latency_ns;
+
+            total_ns += latency_ns;
+            count    ++;
+        }
+    }
+
+    float Latency_Histogram::get_percentile_ms (float percentile) const
+    {
+        if (count == 0) return 0.f;
+
+        uint32_t target      = uint32_t(percentile * float(count) + .5f);
+        uint32_t accumulated = 0;
+
+        if (target < 1) target = 1;
+
+        for (unsigned index = 0; index < bucket_count; ++index)
+        {
+            accumulated += buckets[index];
+
+            if (accumulated >= target)
+            {
+                return float((index + 1) * bucket_width_ns) * 1e-6f;
+            }
+        }
+
+        return get_max_ms ();
+    }
+
+    std::string Latency_Histogram::summary () const
+    {
+        char buffer[160];
+
+        snprintf
+        (
+            buffer, sizeof(buffer),
+            "n=%u mean=%.1fms p50=%.1fms p95=%.1fms p99=%.1fms max=%.1fms",
+            unsigned(count),
+            get_mean_ms (),
+            get_percentile_ms (.50f),
+            get_percentile_ms (.95f),
+            get_percentile_ms (.99f),
+            get_max_ms ()
+        );
+
+        return buffer;
+    }
+
+}
@@ -10,9 +10,11 @@
  * C1802030114
  */
 
+#include <algorithm>
 #include <cstring>
 #include <rapidxml.hpp>
 #include <basics/Raster_Font>
+#include <basics/Raster_Font_Format>
 
 using namespace std;
 using namespace rapidxml;
@@ -21,18 +23,253 @@ namespace basics
 {
 
     Raster_Font::Raster_Font(const string & path, Graphics_Context::Accessor & context)
+    :
+        direct_indices()
     {
         shared_ptr< Asset > font_file = Asset::open (path);
 
-        if (font_file->good ())
+        if (font_file && font_file->good ())
         {
-            Buffer font_data;
+            // Las fuentes binarias se leen directamente de la memoria del asset si es posible. Si
+            // no, se leen a un buffer como las de XML:
 
-            if (font_file->read_all (font_data))
+            const byte * mapped_data = font_file->map  ();
+            size_t       data_size   = font_file->size ();
+
+            if (mapped_data && is_binary (mapped_data, data_size))
+            {
+                ready = load_binary (mapped_data, data_size, path, context);
+            }
+            else
+            {
+                Buffer font_data;
+
+                if (font_file->read_all (font_data))
+                {
+                    ready = is_binary (font_data.data (), font_data.size ())
+                          ? load_binary (font_data.data (), font_data.size (), path, context)
+                          : parse       (font_data, path, context);
+                }
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    const Raster_Font::Character * Raster_Font::find_character (uint32_t code) const
+    {
+        Code_Index_List::const_iterator item = std::lower_bound
+        (
+            other_indices.begin (),
+            other_indices.end   (),
+            code,
+            [] (const Code_Index & item, uint32_t code) { return item.code < code; }
+        );
+
+        return item != other_indices.end () && item->code == code ? &characters[item->index] : nullptr;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    bool Raster_Font::add_character
+    (
+        uint32_t code,
+        int      x,
+        int      y,
+        int      width,
+        int      height,
+        int      x_offset,
+        int      y_offset,
+        int      advance
+    )
+    {
+        if (width < 0 || height < 0 || get_character (code)) return false;
+
+        Character character;
+
+        // Los caracteres sin imagen (como el espacio) solo sirven para avanzar:
+
+        character.slice   = width > 0 && height > 0
+                          ? atlas->add_slice (Id(code), { float(x), float(y) }, { float(width), float(height) })
+                          : nullptr;
+        character.offset  = Vector2f{ float(x_offset), float(y_offset) };
+        character.advance = float(advance);
+
+        uint32_t index = uint32_t(characters.size ());
+
+        characters.push_back (character);
+
+        if (code < direct_range)
+        {
+            direct_indices[code] = index + 1;
+        }
+        else
+        {
+            Code_Index_List::iterator position = std::lower_bound
+            (
+                other_indices.begin (),
+                other_indices.end   (),
+                code,
+                [] (const Code_Index & item, uint32_t code) { return item.code < code; }
+            );
+
+            other_indices.insert (position, Code_Index{ code, index });
+        }
+
+        return true;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    bool Raster_Font::load_texture
+    (
+        const std::string          & path,
+        const std::string          & texture_name,
+        Graphics_Context::Accessor & context
+    )
+    {
+        // Se determina la ruta de la textura, que está en la misma carpeta que la fuente:
+
+        size_t slash     = path.find_last_of ('/' );
+        size_t backslash = path.find_last_of ('\\');
+        string texture_path;
+
+        if (slash != string::npos && backslash != string::npos)
+        {
+            texture_path = path.substr (0, std::max (slash, backslash + 1));
+        }
+        else
+        if (slash != string::npos)
+        {
+            texture_path = path.substr (0, slash + 1);
+        }
+        else
+        if (backslash != string::npos)
+        {
+            texture_path = path.substr (0, backslash + 1);
+        }
+
+        // Se intenta cargar la textura:
+
+        auto texture = Texture_2D::create (0, context, texture_path + texture_name);
+
+        assert(texture);
+
+        if (texture)
+        {
+            context->add (texture);
+
+            atlas.reset (new Atlas(texture));
+
+            return true;
+        }
+
+        return false;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    bool Raster_Font::is_binary (const byte * data, size_t size)
+    {
+        uint32_t magic;
+
+        if (size < sizeof(magic)) return false;
+
+        std::memcpy (&magic, data, sizeof(magic));
+
+        return magic == raster_font_format::magic;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    bool Raster_Font::load_binary
+    (
+        const byte                 * data,
+        size_t                       size,
+        const std::string          & path,
+        Graphics_Context::Accessor & context
+    )
+    {
+        using namespace raster_font_format;
+
+        // Los datos pueden no estar alineados dentro del asset, por lo que se copian con memcpy()
+        // en lugar de hacer un cast:
+
+        Header header;
+
+        if (size < sizeof(Header)) return false;
+
+        std::memcpy (&header, data, sizeof(Header));
+
+        if (header.magic != magic || header.version != version || header.character_count == 0)
+        {
+            return false;
+        }
+
+        // Cada longitud se compara con lo que queda por leer antes de multiplicar o sumar, ya que
+        // con size_t de 32 bits una cabecera corrupta podría desbordar el cálculo del tamaño:
+
+        size_t remaining = size - sizeof(Header);
+
+        if (header.character_count > remaining / sizeof(Character_Record)) return false;
+
+        size_t records_size = size_t(header.character_count) * sizeof(Character_Record);
+
+        remaining -= records_size;
+
+        if (header.texture_name_length > remaining) return false;
+
+        remaining -= header.texture_name_length;
+
+        if (header.face_name_length > remaining) return false;
+
+        const byte * records      = data + sizeof(Header);
+        const char * texture_name = reinterpret_cast< const char * >(records + records_size);
+        const char * face_name    = texture_name + header.texture_name_length;
+
+        if (!load_texture (path, string(texture_name, header.texture_name_length), context))
+        {
+            return false;
+        }
+
+        name.assign (face_name, header.face_name_length);
+
+        metrics.line_height = float(header.line_height);
+        metrics.base_height = float(header.line_height - header.base);
+
+        if (!(metrics.line_height > 0 && metrics.base_height < metrics.line_height))
+        {
+            return false;
+        }
+
+        characters.reserve (header.character_count);
+
+        for (uint32_t index = 0; index < header.character_count; ++index)
+        {
+            Character_Record record;
+
+            std::memcpy (&record, records + index * sizeof(Character_Record), sizeof(Character_Record));
+
+            if
+            (
+                !add_character
+                (
+                    record.code,
+                    record.x,
+                    record.y,
+                    record.width,
+                    record.height,
+                    record.x_offset,
+                    record.y_offset,
+                    record.advance
+                )
+            )
             {
-                ready = parse (font_data, path, context);
+                return false;
             }
         }
+
+        return true;
     }
 
     // ---------------------------------------------------------------------------------------------
@@ -109,41 +346,7 @@ namespace basics
 
             if (file_attritube)
             {
-                // Se determina la ruta de la textura:
-
-                size_t slash     = path.find_last_of ('/' );
-                size_t backslash = path.find_last_of ('\\');
-                string texture_path;
-
-                if (slash != string::npos && backslash != string::npos)
-                {
-                    texture_path = path.substr (0, std::max (slash, backslash + 1));
-                }
-                else
-                if (slash != string::npos)
-                {
-                    texture_path = path.substr (0, slash + 1);
-                }
-                else
-                if (backslash != string::npos)
-                {
-                    texture_path = path.substr (0, backslash + 1);
-                }
-
-                // Se intenta cargar la textura:
-
-                auto texture = Texture_2D::create (0, context, texture_path + file_attritube->value ());
-
-                assert(texture);
-
-                if (texture)
-                {
-                    context->add (texture);
-
-                    atlas.reset (new Atlas(texture));
-
-                    return true;
-                }
+                return load_texture (path, file_attritube->value (), context);
             }
         }
 
@@ -252,16 +455,7 @@ namespace basics
             int y_offset = std::atoi (y_offset_attribute->value ());
             int advance  = std::atoi ( advance_attribute->value ());
 
-            if (width > 0 && height > 0 && character_map.count (uint32_t(id)) == 0)
-            {
-                Character & character = character_map[uint32_t(id)];
-
-                character.slice   = atlas->add_slice (Id(id), { float(x), float(y) }, { float(width), float(height) });
-                character.offset  = Vector2f{ float(x_offset), float(y_offset) };
-                character.advance = float(advance);
-
-                return true;
-            };
+            return add_character (uint32_t(id), x, y, width, height, x_offset, y_offset, advance);
         }
 
         return false;
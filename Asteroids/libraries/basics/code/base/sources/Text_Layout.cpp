@@ -16,14 +16,20 @@ namespace basics
 {
 
     Text_Layout::Text_Layout(const Raster_Font & font, const std::wstring & text)
-    :
-        width (0.f),
-        height(0.f)
+    {
+        assign (font, text);
+    }
+
+    void Text_Layout::assign (const Raster_Font & font, const std::wstring & text)
     {
         Raster_Font::Metrics metrics = font.get_metrics ();
 
+        glyphs.clear   ();
         glyphs.reserve (text.length ());
 
+        width  = 0.f;
+        height = 0.f;
+
         float current_x  = 0;
         float current_y  = -metrics.line_height;
         float line_width = 0;
@@ -43,12 +49,17 @@ namespace basics
 
                 if (character)
                 {
-                    glyphs.emplace_back
-                    (
-                         character->slice,
-                         Point2f{ current_x + character->offset[0], current_y + metrics.line_height - character->offset[1] },
-                         Size2f { character->slice->width, character->slice->height }
-                    );
+                    // Los caracteres sin imagen (como el espacio) solo hacen avanzar:
+
+                    if (character->slice)
+                    {
+                        glyphs.emplace_back
+                        (
+                             character->slice,
+                             Point2f{ current_x + character->offset[0], current_y + metrics.line_height - character->offset[1] },
+                             Size2f { character->slice->width, character->slice->height }
+                        );
+                    }
 
                     if (current_x == 0.f) height += metrics.line_height;
 
@@ -0,0 +1,70 @@
+/*
+ * TEXT LAYOUT CACHE
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181985
+ */
+
+#include <functional>
+#include <basics/Text_Layout_Cache>
+
+namespace basics
+{
+
+    Text_Layout_Cache::Text_Layout_Cache(size_t capacity)
+    :
+        capacity(capacity > 0 ? capacity : 1),
+        clock   (0)
+    {
+        entries.reserve (this->capacity);
+    }
+
+    const Text_Layout & Text_Layout_Cache::get (const Raster_Font & font, const std::wstring & text)
+    {
+        size_t hash = std::hash< std::wstring >()(text);
+
+        ++clock;
+
+        // Mientras se busca el texto se localiza también la entrada usada hace más tiempo, por si
+        // hay que reutilizarla:
+
+        Entry * oldest = nullptr;
+
+        for (auto & entry : entries)
+        {
+            if (entry.hash == hash && entry.font == &font && entry.text == text)
+            {
+                entry.last_use = clock;
+
+                return entry.layout;
+            }
+
+            if (!oldest || entry.last_use < oldest->last_use) oldest = &entry;
+        }
+
+        if (entries.size () < capacity)
+        {
+            entries.emplace_back (font, hash, text);
+            entries.back ().last_use = clock;
+
+            return entries.back ().layout;
+        }
+
+        // La entrada descartada se maqueta en el sitio para aprovechar la memoria de su texto y
+        // de sus glifos:
+
+        oldest->font     = &font;
+        oldest->hash     =  hash;
+        oldest->last_use =  clock;
+        oldest->text     =  text;
+        oldest->layout.assign (font, text);
+
+        return oldest->layout;
+    }
+
+}
@@ -15,4 +15,23 @@
 namespace basics
 {
 
+    Id                   Text_Prefab::text_prefab_specialization_ids      [10];
+    Text_Prefab::Factory Text_Prefab::text_prefab_specialization_factories[10];
+    size_t               Text_Prefab::text_prefab_specialization_count;
+
+    std::shared_ptr< Text_Prefab > Text_Prefab::create (Graphics_Context::Accessor & context, const Text_Layout & layout)
+    {
+        Id context_id = context->get_id ();
+
+        for (unsigned index = 0; index < text_prefab_specialization_count; ++index)
+        {
+            if (text_prefab_specialization_ids[index] == context_id)
+            {
+                return text_prefab_specialization_factories[index] (layout);
+            }
+        }
+
+        return std::shared_ptr< Text_Prefab >();
+    }
+
 }
@@ -0,0 +1,126 @@
+/*
+ * THREAD POOL
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181911
+ */
+
+#include <algorithm>
+#include <basics/Thread_Pool>
+
+namespace basics
+{
+
+    Thread_Pool::Thread_Pool(unsigned thread_count)
+    :
+        busy_count(0),
+        stopping  (false)
+    {
+        if (thread_count == 0) thread_count = get_hardware_thread_count ();
+
+        threads.reserve (thread_count);
+
+        for (unsigned index = 0; index < thread_count; ++index)
+        {
+            threads.emplace_back (&Thread_Pool::work, this);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    Thread_Pool::~Thread_Pool()
+    {
+        // Se terminan las tareas pendientes antes de detener los hilos:
+
+        {
+            std::unique_lock< std::mutex > lock(mutex);
+
+            stopping = true;
+        }
+
+        task_available.notify_all ();
+
+        for (auto & thread : threads) thread.join ();
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Thread_Pool::submit (Task task)
+    {
+        {
+            std::unique_lock< std::mutex > lock(mutex);
+
+            tasks.push_back (std::move (task));
+        }
+
+        task_available.notify_one ();
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Thread_Pool::wait ()
+    {
+        std::unique_lock< std::mutex > lock(mutex);
+
+        all_done.wait (lock, [this] () { return tasks.empty () && busy_count == 0; });
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Thread_Pool::parallel_for (size_t count, const std::function< void (size_t) > & function)
+    {
+        if (count == 0) return;
+
+        size_t block_count = std::min< size_t > (count, threads.size ());
+        size_t block_size  = (count + block_count - 1) / block_count;
+
+        for (size_t first = 0; first < count; first += block_size)
+        {
+            size_t last = std::min (first + block_size, count);
+
+            submit ([&function, first, last] () { for (size_t index = first; index < last; ++index) function (index); });
+        }
+
+        wait ();
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Thread_Pool::work ()
+    {
+        for (;;)
+        {
+            Task task;
+
+            {
+                std::unique_lock< std::mutex > lock(mutex);
+
+                task_available.wait (lock, [this] () { return stopping || !tasks.empty (); });
+
+                if (tasks.empty ()) return;             // stopping y sin trabajo pendiente
+
+                task = std::move (tasks.front ());
+
+                tasks.pop_front ();
+
+                busy_count++;
+            }
+
+            task ();
+
+            {
+                std::unique_lock< std::mutex > lock(mutex);
+
+                busy_count--;
+
+                if (tasks.empty () && busy_count == 0) all_done.notify_all ();
+            }
+        }
+    }
+
+}
@@ -0,0 +1,191 @@
+/*
+ * TOUCH SURFACE
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181540
+ */
+
+#include <basics/Touch_Surface>
+
+namespace basics
+{
+
+    namespace
+    {
+
+        class Default_Touch_Surface : public Touch_Surface
+        {
+        }
+        default_touch_surface;
+
+    }
+
+    Touch_Surface * const touch_surface = &default_touch_surface;
+
+    // ---------------------------------------------------------------------------------------------
+
+    Touch_Surface::State::State() : count(0)
+    {
+        for (unsigned index = 0; index < max_touches; ++index)
+        {
+            last_presses [index] = 0;
+            last_releases[index] = 0;
+        }
+    }
+
+    const Touch_Surface::Touch * Touch_Surface::State::find_touch (int id) const
+    {
+        for (unsigned index = 0; index < count; ++index)
+        {
+            if (touches[index].id == id) return &touches[index];
+        }
+
+        return nullptr;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    Touch_Surface::Touch_Surface() : back(0), front(1), middle(2)
+    {
+        clear ();
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Touch_Surface::clear ()
+    {
+        working.count = 0;
+
+        for (auto & buffer : buffers) buffer.count = 0;
+
+        back  = 0;
+        front = 1;
+
+        middle.store (2, std::memory_order_relaxed);
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Touch_Surface::record (const Touch_Event & touch)
+    {
+        // Se busca el dedo. Si no está, se reutiliza el hueco de uno que ya se haya levantado o
+        // se ocupa uno nuevo:
+
+        Pointer * pointer = nullptr;
+        Pointer * vacant  = nullptr;
+
+        for (unsigned index = 0; index < working.count; ++index)
+        {
+            Pointer & candidate = working.pointers[index];
+
+            if (candidate.id == touch.pointer) { pointer = &candidate; break; }
+
+            if (!candidate.pressed && !vacant) vacant = &candidate;
+        }
+
+        if (!pointer)
+        {
+            if (touch.id != ID(touch-started))
+            {
+                return;             // Se ignoran movimientos y liberaciones de dedos desconocidos
+            }
+
+            if (!vacant && working.count < max_touches)
+            {
+                vacant = &working.pointers[working.count++];
+
+                vacant->presses  = 0;
+                vacant->releases = 0;
+            }
+
+            if (!vacant) return;
+
+            pointer          = vacant;
+            pointer->id      = touch.pointer;
+            pointer->pressed = false;
+        }
+
+        pointer->x = touch.x;
+        pointer->y = touch.y;
+
+        switch (touch.id)
+        {
+            case ID(touch-started):
+            {
+                if (!pointer->pressed)
+                {
+                    pointer->pressed = true;
+                    pointer->presses++;
+                }
+
+                break;
+            }
+
+            case ID(touch-ended):
+            {
+                if (pointer->pressed)
+                {
+                    pointer->pressed = false;
+                    pointer->releases++;
+                }
+
+                break;
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Touch_Surface::publish ()
+    {
+        buffers[back] = working;
+
+        // Se entrega el buffer recién escrito y se recupera el que el lector haya dejado libre:
+
+        back = middle.exchange (uint8_t(back | fresh_flag), std::memory_order_acq_rel) & index_mask;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Touch_Surface::read (State & state, float x_scale, float y_scale, float flip_height)
+    {
+        if (middle.load (std::memory_order_relaxed) & fresh_flag)
+        {
+            front = middle.exchange (front, std::memory_order_acq_rel) & index_mask;
+        }
+
+        const Snapshot & snapshot = buffers[front];
+
+        state.count = 0;
+
+        for (unsigned index = 0; index < snapshot.count; ++index)
+        {
+            const Pointer & pointer = snapshot.pointers[index];
+
+            bool down = pointer.presses  != state.last_presses [index];
+            bool up   = pointer.releases != state.last_releases[index];
+
+            state.last_presses [index] = pointer.presses;
+            state.last_releases[index] = pointer.releases;
+
+            if (pointer.pressed || down || up)
+            {
+                state.touches[state.count++] = Touch
+                {
+                    pointer.id,
+                    pointer.x * x_scale,
+                    (flip_height - pointer.y) * y_scale,
+                    down,
+                    pointer.pressed,
+                    up
+                };
+            }
+        }
+    }
+
+}
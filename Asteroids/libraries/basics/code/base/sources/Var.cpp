@@ -21,6 +21,7 @@ namespace basics
         const Var::Type::Info  Void::info{  Void::id,  "Void", nullptr };
         const Var::Type::Info  Bool::info{  Bool::id,  "Bool", nullptr };
         const Var::Type::Info Int32::info{ Int32::id, "Int32", nullptr };
+        const Var::Type::Info Int64::info{ Int64::id, "Int64", nullptr };
         const Var::Type::Info Float::info{ Float::id, "Float", nullptr };
 
     }
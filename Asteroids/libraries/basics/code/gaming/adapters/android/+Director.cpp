@@ -0,0 +1,26 @@
+/*
+ * DIRECTOR
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182040
+ */
+
+#include <basics/Director>
+#include <basics/opengles/Context>
+
+namespace basics
+{
+
+    // En Android las escenas se dibujan con OpenGL ES:
+
+    Director::Graphics_Context_Factory Director::default_graphics_context_factory ()
+    {
+        return opengles::Context::create;
+    }
+
+}
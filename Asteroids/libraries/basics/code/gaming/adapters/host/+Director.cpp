@@ -0,0 +1,26 @@
+/*
+ * DIRECTOR
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182045
+ */
+
+#include <basics/Director>
+
+namespace basics
+{
+
+    // En el ordenador no hay contexto gráfico de plataforma. Las escenas solo se pueden ejecutar
+    // con Director::run_headless():
+
+    Director::Graphics_Context_Factory Director::default_graphics_context_factory ()
+    {
+        return nullptr;
+    }
+
+}
@@ -0,0 +1,135 @@
+/*
+ * ALPHA MASK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181920
+ */
+
+#ifndef BASICS_ALPHA_MASK_HEADER
+#define BASICS_ALPHA_MASK_HEADER
+
+    #include <cstdint>
+    #include <vector>
+    #include <basics/Color>
+    #include <basics/Color_Buffer>
+    #include <basics/Sprite_Pool>
+
+    namespace basics
+    {
+
+        /**
+         * Silueta de una imagen (los píxeles cuya opacidad supera un umbral) guardada como un bitset
+         * de 64 bits por palabra para cada fila, de modo que la fase estrecha de las colisiones se
+         * reduce a desplazar, hacer AND y contar bits sobre las filas que se solapan.
+         * Se calcula a partir del canal alfa de la imagen decodificada (normalmente en el mismo hilo
+         * que la decodifica) y se puede reducir de resolución: cada bit representa entonces un
+         * bloque de reduction x reduction píxeles, que se marca si cualquiera de ellos es opaco.
+         * La fila 0 es la de abajo de la imagen, igual que el eje Y de las escenas.
+         */
+        class Alpha_Mask
+        {
+
+            unsigned image_width;                       ///< Ancho en píxeles de la imagen original.
+            unsigned image_height;                      ///< Alto  en píxeles de la imagen original.
+            unsigned reduction;                         ///< Lado en píxeles del bloque que representa cada bit.
+            unsigned width;                             ///< Bits útiles por fila.
+            unsigned height;                            ///< Número de filas.
+            unsigned words_per_row;
+            std::vector< uint64_t > bits;               ///< Filas consecutivas (los bits de relleno valen 0).
+
+        public:
+
+            /**
+             * Crea una máscara vacía (no colisiona con nada).
+             */
+            Alpha_Mask();
+
+            /**
+             * @param image Imagen decodificada con png_decode() (la fila 0 es la de arriba).
+             * @param reduction Píxeles por lado que representa cada bit (1 para resolución completa).
+             * @param threshold Opacidad mínima (0-255) de un píxel para considerarlo sólido.
+             */
+            Alpha_Mask(const Color_Buffer< Rgba8888 > & image, unsigned reduction = 1, uint8_t threshold = 128);
+
+        public:
+
+            bool     empty            () const { return bits.empty ();  }
+            unsigned get_width        () const { return width;          }
+            unsigned get_height       () const { return height;         }
+            unsigned get_reduction    () const { return reduction;      }
+            unsigned get_image_width  () const { return image_width;    }
+            unsigned get_image_height () const { return image_height;   }
+
+            /**
+             * Retorna el valor de un bit. La columna y la fila se cuentan en bits, no en píxeles.
+             */
+            bool test (unsigned x, unsigned y) const
+            {
+                return x < width && y < height && (bits[y * words_per_row + (x >> 6)] >> (x & 63) & 1) != 0;
+            }
+
+            /**
+             * Número de bits sólidos de la máscara.
+             */
+            unsigned count () const;
+
+        public:
+
+            /**
+             * Comprueba si las partes sólidas de dos máscaras se tocan cuando se colocan sobre los
+             * rectángulos indicados (en las coordenadas de la escena). Cada máscara se estira para
+             * ocupar su rectángulo, como lo hace la textura al dibujarse.
+             * Solo se recorren las filas que caen dentro de la intersección de ambos rectángulos y se
+             * sale en cuanto se encuentra un bit común.
+             */
+            static bool overlap
+            (
+                const Alpha_Mask & a, float a_left, float a_bottom, float a_width, float a_height,
+                const Alpha_Mask & b, float b_left, float b_bottom, float b_width, float b_height
+            )
+            {
+                return overlap_count (a, a_left, a_bottom, a_width, a_height, b, b_left, b_bottom, b_width, b_height, true) > 0;
+            }
+
+            /**
+             * Igual que la anterior usando el rectángulo de cada sprite (sin escalar, igual que
+             * Sprite_Pool::Handle::intersects() y Collision_World).
+             */
+            static bool overlap (const Alpha_Mask & a, const Sprite_Pool::Handle & a_sprite, const Alpha_Mask & b, const Sprite_Pool::Handle & b_sprite)
+            {
+                return overlap
+                (
+                    a, a_sprite.get_left_x (), a_sprite.get_bottom_y (), a_sprite.get_width (), a_sprite.get_height (),
+                    b, b_sprite.get_left_x (), b_sprite.get_bottom_y (), b_sprite.get_width (), b_sprite.get_height ()
+                );
+            }
+
+            /**
+             * Número de bits de a que coinciden con un bit sólido de b (medido en la rejilla de a).
+             * @param stop_at_first Si es true se retorna en cuanto se encuentra el primero.
+             */
+            static unsigned overlap_count
+            (
+                const Alpha_Mask & a, float a_left, float a_bottom, float a_width, float a_height,
+                const Alpha_Mask & b, float b_left, float b_bottom, float b_width, float b_height,
+                bool stop_at_first = false
+            );
+
+        private:
+
+            /**
+             * Retorna los 64 bits de la fila row que empiezan en la columna first (que puede ser
+             * negativa o pasar del final: los bits de fuera de la máscara valen 0).
+             */
+            uint64_t extract (unsigned row, int first) const;
+
+        };
+
+    }
+
+#endif
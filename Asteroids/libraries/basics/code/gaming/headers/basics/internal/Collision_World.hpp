@@ -0,0 +1,222 @@
+/*
+ * COLLISION WORLD
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181740
+ */
+
+#ifndef BASICS_COLLISION_WORLD_HEADER
+#define BASICS_COLLISION_WORLD_HEADER
+
+    #include <cstdint>
+    #include <unordered_map>
+    #include <vector>
+    #include <basics/Sprite_Pool>
+
+    namespace basics
+    {
+
+        /**
+         * Detección de colisiones entre rectángulos alineados con los ejes (fase amplia).
+         * Los cuerpos se reparten en una rejilla uniforme dispersa (spatial hash) de celdas
+         * cuadradas. Solo se vuelven a insertar en la rejilla los cuerpos que cambian de celda, por
+         * lo que el coste de cada paso crece casi linealmente con el número de cuerpos.
+         * Cada cuerpo pertenece a una o varias capas (layer) y tiene una máscara (mask) con las
+         * capas con las que puede colisionar. Dos cuerpos solo se consideran en contacto si la
+         * máscara de cada uno incluye alguna capa del otro.
+         */
+        class Collision_World
+        {
+        public:
+
+            typedef uint32_t Body_Id;
+
+            static constexpr Body_Id invalid_body = 0xFFFFFFFF;
+
+            struct Pair
+            {
+                Body_Id a;
+                Body_Id b;
+            };
+
+        private:
+
+            struct Cell_Range
+            {
+                int32_t min_x, min_y;
+                int32_t max_x, max_y;
+
+                bool operator == (const Cell_Range & other) const
+                {
+                    return min_x == other.min_x && min_y == other.min_y && max_x == other.max_x && max_y == other.max_y;
+                }
+
+                bool operator != (const Cell_Range & other) const
+                {
+                    return !(*this == other);
+                }
+            };
+
+            struct Body
+            {
+                float      left, bottom, right, top;
+                uint32_t   layer;
+                uint32_t   mask;
+                uintptr_t  user_data;
+                Cell_Range cells;                       ///< Celdas en las que está insertado (si inserted).
+                Cell_Range target_cells;                ///< Celdas que corresponden a sus límites actuales.
+                bool       used;
+                bool       enabled;
+                bool       inserted;
+                bool       dirty;
+            };
+
+            struct Cell
+            {
+                int32_t                x, y;
+                std::vector< Body_Id > bodies;
+            };
+
+            typedef std::unordered_map< uint64_t, Cell > Cell_Map;
+
+        private:
+
+            float                  cell_size;
+            float                  inverse_cell_size;
+
+            std::vector< Body    > bodies;
+            std::vector< Body_Id > free_bodies;
+            std::vector< Body_Id > dirty_bodies;
+            Cell_Map               cells;
+            std::vector< Pair    > pairs;
+
+        public:
+
+            /**
+             * @param cell_size Lado de las celdas. Conviene que sea similar al tamaño de los cuerpos
+             *     más habituales (si es mucho menor cada cuerpo ocupa muchas celdas y si es mucho
+             *     mayor cada celda contiene muchos cuerpos).
+             */
+            Collision_World(float cell_size = 128.f);
+
+        public:
+
+            Body_Id add_body    (uint32_t layer, uint32_t mask, uintptr_t user_data = 0);
+            void    remove_body (Body_Id body);
+            void    clear       ();
+
+            size_t size () const
+            {
+                return bodies.size () - free_bodies.size ();
+            }
+
+        public:
+
+            /**
+             * Establece el rectángulo envolvente del cuerpo. Si el cuerpo cambia de celdas se
+             * reubicará en la rejilla en la siguiente llamada a update() o find_pairs().
+             */
+            void set_bounds (Body_Id body, float left, float bottom, float right, float top);
+
+            /**
+             * Toma como rectángulo envolvente el de un sprite (sin escalar, como Handle::intersects()).
+             */
+            void set_bounds (Body_Id body, const Sprite_Pool::Handle & sprite)
+            {
+                float left   = sprite.get_left_x   ();
+                float bottom = sprite.get_bottom_y ();
+
+                set_bounds (body, left, bottom, left + sprite.get_width (), bottom + sprite.get_height ());
+            }
+
+            /**
+             * Los cuerpos deshabilitados se sacan de la rejilla y no generan contactos.
+             */
+            void set_enabled (Body_Id body, bool enabled);
+
+            void set_layer (Body_Id body, uint32_t layer)
+            {
+                bodies[body].layer = layer;
+            }
+
+            void set_mask (Body_Id body, uint32_t mask)
+            {
+                bodies[body].mask = mask;
+            }
+
+            uint32_t get_layer (Body_Id body) const
+            {
+                return bodies[body].layer;
+            }
+
+            uintptr_t get_user_data (Body_Id body) const
+            {
+                return bodies[body].user_data;
+            }
+
+            bool is_enabled (Body_Id body) const
+            {
+                return bodies[body].enabled;
+            }
+
+        public:
+
+            /**
+             * Reubica en la rejilla los cuerpos que han cambiado de celdas desde la última vez.
+             */
+            void update ();
+
+            /**
+             * Actualiza la rejilla y retorna todos los pares de cuerpos cuyos rectángulos se solapan
+             * y cuyas capas y máscaras lo permiten. Cada par aparece una sola vez.
+             * La lista retornada es válida hasta la siguiente llamada.
+             */
+            const std::vector< Pair > & find_pairs ();
+
+            /**
+             * Invoca callback(a, b) por cada par retornado por find_pairs().
+             */
+            template< typename CALLBACK >
+            void for_each_pair (CALLBACK callback)
+            {
+                for (const Pair & pair : find_pairs ())
+                {
+                    callback (pair.a, pair.b);
+                }
+            }
+
+            /**
+             * Añade a output los cuerpos habilitados cuyas capas están en mask y cuyo rectángulo se
+             * solapa con el indicado.
+             * @return Número de cuerpos añadidos.
+             */
+            size_t query (float left, float bottom, float right, float top, uint32_t mask, std::vector< Body_Id > & output);
+
+        private:
+
+            Cell_Range compute_cells (float left, float bottom, float right, float top) const;
+
+            void mark_dirty  (Body_Id body);
+            void insert_body (Body_Id body);
+            void detach_body (Body_Id body);
+
+            static uint64_t cell_key (int32_t x, int32_t y)
+            {
+                return uint64_t(uint32_t(x)) << 32 | uint32_t(y);
+            }
+
+            static bool overlap (const Body & a, const Body & b)
+            {
+                return !(b.left >= a.right || b.right <= a.left || b.bottom >= a.top || b.top <= a.bottom);
+            }
+
+        };
+
+    }
+
+#endif
@@ -13,11 +13,20 @@
 #ifndef BASICS_DIRECTOR_HEADER
 #define BASICS_DIRECTOR_HEADER
 
+    #include <future>
+    #include <map>
     #include <memory>
+    #include <vector>
     #include <basics/declarations>
-    #include <basics/Event_Queue>
+    #include <basics/Event>
+    #include <basics/Spsc_Queue>
+    #include <basics/Touch_Event>
+    #include <basics/Touch_Surface>
     #include <basics/Graphics_Context>
     #include <basics/Graphics_Resource_Cache>
+    #include <basics/Input_Log>
+    #include <basics/Latency_Histogram>
+    #include <basics/Timer>
     #include <basics/Window>
 
     namespace basics
@@ -29,6 +38,39 @@
 
             typedef bool (* Graphics_Context_Factory) (Window::Accessor & window, Graphics_Resource_Cache * cache);
 
+            /**
+             * Evento que run_headless() entrega a la escena al comienzo del fotograma indicado. Las
+             * coordenadas de los eventos táctiles se expresan directamente en el espacio de la escena.
+             */
+            struct Scripted_Event
+            {
+                unsigned frame;
+                Event    event;
+            };
+
+            /**
+             * Resultados de una ejecución con run_headless().
+             */
+            struct Benchmark_Results
+            {
+                unsigned frames;                        ///< Número de fotogramas ejecutados.
+                double   update_ns_per_frame;           ///< Tiempo medio de Scene::update() en nanosegundos.
+                double   render_ns_per_frame;           ///< Tiempo medio de Scene::render() en nanosegundos.
+            };
+
+            /**
+             * Posición de un dedo en un instante dado, en coordenadas de la escena.
+             */
+            struct Touch_Sample
+            {
+                float   x;
+                float   y;
+                int64_t time;                           ///< Nanosegundos de CLOCK_MONOTONIC (0 si se desconoce).
+            };
+
+            static constexpr unsigned max_touch_pointers = 10;
+            static constexpr unsigned max_touch_samples  = 16;
+
         public:
 
             static Director & get_instance ()
@@ -62,7 +104,72 @@
             std::shared_ptr< Scene > current_scene;
             std::shared_ptr< Scene >  target_scene;
 
-            Event_Queue event_queue;
+            // Los eventos de entrada solo los produce el hilo de entrada y solo los consume el hilo
+            // del Director, por lo que basta una cola SPSC sin bloqueos. Se desencolan por lotes.
+            // Los eventos táctiles van por una cola aparte con elementos POD:
+
+            static constexpr size_t input_batch_size = 16;
+            static constexpr size_t touch_batch_size = 32;
+
+            Spsc_Queue< Event,       256 > event_queue;
+            Spsc_Queue< Touch_Event, 512 > touch_queue;
+            Event                          input_batch[input_batch_size];
+            Touch_Event                    touch_batch[touch_batch_size];
+
+            // Los eventos touch-moved de un mismo dedo que llegan en un fotograma se agrupan en uno
+            // solo (el último), pero todas sus posiciones se guardan como muestras de su trayectoria:
+
+            struct Touch_Trail
+            {
+                int32_t      pointer_id;
+                bool         move_pending;              ///< true si latest_move aún no se ha entregado.
+                Touch_Event  latest_move;
+                unsigned     sample_count;
+                Touch_Sample samples[max_touch_samples];
+            };
+
+            Touch_Trail touch_trails[max_touch_pointers];
+            unsigned    touch_trail_count;
+
+            Touch_Surface::State touch_state;
+
+            // En modo determinista (y en run_headless()) touch_state no se lee de touch_surface, que
+            // el hilo de entrada actualiza a su ritmo, sino de esta otra superficie, a la que el
+            // Director pasa los mismos toques que entrega a la escena (los que se graban). Así una
+            // reproducción obtiene el mismo estado en cada paso que la partida grabada:
+
+            struct Logged_Touch_Surface : public Touch_Surface
+            {
+            };
+
+            Logged_Touch_Surface logged_touch_surface;
+
+            // Modo determinista y grabación de la entrada. simulation_step cuenta las llamadas a
+            // update() de la escena actual y sirve para fechar los eventos grabados:
+
+            struct
+            {
+                bool     enabled   = false;
+                uint32_t seed      = 0;
+                float    time_step = 1.f / 60.f;
+            }
+            deterministic;
+
+            Input_Log input_log;
+            bool      recording;
+            uint32_t  simulation_step;
+
+            // Medida de la latencia de los toques. Las marcas de tiempo de los eventos táctiles
+            // consumidos en el fotograma se guardan hasta que este se envía a la pantalla:
+
+            static constexpr unsigned max_frame_timestamps = 64;
+
+            Latency_Histogram input_latency;
+            Latency_Histogram display_latency;
+            int64_t           frame_timestamps[max_frame_timestamps];
+            unsigned          frame_timestamp_count;
+            float             latency_log_period;
+            Timer             latency_log_timer;
 
             float surface_width;
             float surface_height;
@@ -70,10 +177,30 @@
             Graphics_Context_Factory graphics_context_factory;
             Graphics_Resource_Cache  graphics_resource_cache;
 
+            std::shared_ptr< Window > headless_window;
+
+            // Cada precarga guarda una referencia a su escena para que no se destruya (ni se reutilice
+            // su dirección como clave) mientras la entrada siga en el mapa:
+
+            struct Preload
+            {
+                std::shared_ptr< Scene > scene;
+                std::future< bool >      result;
+            };
+
+            std::map< Scene *, Preload > preloads;
+            std::map< Id, std::shared_ptr< Scene > > scene_cache;
+
         private:
 
             Director();
 
+            /**
+             * Fábrica del contexto gráfico de la plataforma. La define el adaptador de cada
+             * plataforma (OpenGL ES en Android, ninguna en los ejecutables de escritorio).
+             */
+            static Graphics_Context_Factory default_graphics_context_factory ();
+
         public:
 
             void set_graphics_context_factory (Graphics_Context_Factory factory)
@@ -83,24 +210,243 @@
 
             Graphics_Context::Accessor lock_graphics_context ();
 
+            size_t get_dropped_event_count () const
+            {
+                return event_queue.get_dropped_count () + touch_queue.get_dropped_count ();
+            }
+
+            /**
+             * Latencia desde que se produce un toque (según la marca de tiempo del sistema de entrada)
+             * hasta que Director lo entrega a la escena.
+             */
+            const Latency_Histogram & get_input_latency () const
+            {
+                return input_latency;
+            }
+
+            /**
+             * Latencia desde que se produce un toque hasta que el fotograma que lo ha procesado se
+             * entrega para su presentación (justo antes de flush_and_display()/eglSwapBuffers()).
+             */
+            const Latency_Histogram & get_display_latency () const
+            {
+                return display_latency;
+            }
+
+            void reset_latency_statistics ()
+            {
+                input_latency  .reset ();
+                display_latency.reset ();
+            }
+
+            /**
+             * Establece cada cuántos segundos se escriben en el log los histogramas de latencia
+             * (0 para no escribirlos nunca).
+             */
+            void set_latency_log_period (float seconds)
+            {
+                latency_log_period = seconds;
+            }
+
+            /**
+             * Retorna el estado de todos los dedos (en coordenadas de la escena) leído de
+             * touch_surface al comienzo del fotograma actual. Los flancos down/up se refieren a lo
+             * ocurrido desde el fotograma anterior.
+             * En modo determinista y en run_headless() el estado se obtiene en cambio de los toques
+             * entregados a la escena en el fotograma (los mismos que se graban), de modo que
+             * replay() lo reproduce paso a paso.
+             */
+            const Touch_Surface::State & get_touch_state () const
+            {
+                return touch_state;
+            }
+
+            /**
+             * Permite consultar la trayectoria que ha seguido un dedo durante el último fotograma
+             * (incluyendo las muestras intermedias que se agruparon en un único touch-moved), por
+             * ejemplo para predecir su posición. Si hay más de max_touch_samples se conservan las más
+             * recientes.
+             * @param pointer_id Valor de la propiedad ID(id) de los eventos táctiles del dedo.
+             * @param samples Recibe un puntero a las muestras, ordenadas de la más antigua a la más reciente.
+             * @return El número de muestras (0 si el dedo no se ha movido en el último fotograma).
+             */
+            unsigned get_touch_samples (int32_t pointer_id, const Touch_Sample * & samples) const;
+
+        public:
+
+            /**
+             * Activa el modo determinista: las escenas que se inicien a partir de ahora reciben
+             * siempre la misma semilla (ver Scene::get_random_seed()) y update() recibe siempre el
+             * mismo paso de tiempo en lugar del tiempo real transcurrido.
+             */
+            void set_deterministic (uint32_t seed, float time_step = 1.f / 60.f)
+            {
+                deterministic.enabled   = true;
+                deterministic.seed      = seed;
+                deterministic.time_step = time_step > 0.f ? time_step : 1.f / 60.f;
+            }
+
+            void disable_deterministic ()
+            {
+                deterministic.enabled = false;
+            }
+
+            bool is_deterministic () const
+            {
+                return deterministic.enabled;
+            }
+
+            /**
+             * Empieza a grabar los eventos táctiles que recibe la escena actual (en coordenadas de la
+             * escena) junto con el paso de simulación en que se entregan. Requiere el modo
+             * determinista. Si la escena cambia, la grabación se reinicia con la nueva escena.
+             * @return false si el modo determinista no está activo.
+             */
+            bool start_recording ();
+
+            /**
+             * Termina la grabación. El resultado se puede consultar con get_input_log() y guardar con
+             * Input_Log::save().
+             */
+            void stop_recording ();
+
+            bool is_recording () const
+            {
+                return recording;
+            }
+
+            const Input_Log & get_input_log () const
+            {
+                return input_log;
+            }
+
+            /**
+             * Reproduce una grabación con run_headless(): usa su semilla y su paso de tiempo, ejecuta
+             * su número de pasos e inyecta cada evento mediante handle() en el paso en que se grabó.
+             * Los ajustes deterministas previos se restablecen al terminar.
+             * @param scene Nueva instancia de la escena que se grabó.
+             */
+            Benchmark_Results replay (const std::shared_ptr< Scene > & scene, const Input_Log & log);
+
         public:
 
             void run_scene (const std::shared_ptr< Scene > & new_scene);
 
+            /**
+             * Ejecuta una escena sin ventana ni contexto gráfico real, con un paso de tiempo fijo y sin
+             * esperar entre fotogramas, y mide cuánto tardan update() y render() (este último dibuja
+             * sobre un Canvas nulo). Se detiene tras frame_count fotogramas, cuando se llama a stop()
+             * o cuando no queda escena activa.
+             * @param scene Escena inicial. Puede cambiarse durante la ejecución con run_scene().
+             * @param frame_count Número máximo de fotogramas a ejecutar.
+             * @param time_step Tiempo (en segundos) que se pasa a update() en cada fotograma.
+             * @param script Eventos que se inyectan mediante handle(), ordenados por fotograma.
+             * @return Los tiempos medios por fotograma de update() y de render().
+             */
+            Benchmark_Results run_headless
+            (
+                const std::shared_ptr< Scene > & scene,
+                unsigned frame_count,
+                float    time_step = 1.f / 60.f,
+                const std::vector< Scripted_Event > & script = {}
+            );
+
+            /**
+             * Inicia en un hilo secundario la precarga de una escena (ver Scene::preload()) sin
+             * detener la escena actual. run_scene() precarga automáticamente las escenas que no lo
+             * estén, pero llamar a este método antes permite solapar la carga con la escena actual.
+             * Mientras la precarga no termina, la escena actual se sigue ejecutando.
+             */
+            void preload_scene (const std::shared_ptr< Scene > & scene);
+
+            /**
+             * Guarda una escena para reutilizarla más tarde en lugar de crearla y cargarla de nuevo.
+             * Las escenas guardadas deben admitir que se llame a initialize() más de una vez.
+             */
+            void cache_scene (Id id, const std::shared_ptr< Scene > & scene)
+            {
+                scene_cache[id] = scene;
+            }
+
+            /**
+             * Retorna la escena guardada con el id indicado o un puntero nulo si no hay ninguna.
+             */
+            std::shared_ptr< Scene > get_cached_scene (Id id) const
+            {
+                auto cached_scene = scene_cache.find (id);
+
+                return cached_scene != scene_cache.end () ? cached_scene->second : std::shared_ptr< Scene >();
+            }
+
+            /**
+             * Descarta la escena guardada con el id indicado. Si aún se está precargando, la precarga
+             * no se puede cancelar: su resultado se descarta cuando termine.
+             */
+            void evict_scene (Id id);
+
             void stop ()
             {
                 kernel.exit = kernel.running;
             }
 
+            /**
+             * Encola un evento de entrada para la escena actual. Solo puede haber un hilo que llame
+             * a handle() (el hilo de entrada o, en modo headless, el propio Director). Si la cola está
+             * llena el evento se descarta (ver get_dropped_event_count()), salvo los toques que
+             * empiezan o terminan, que esperan a que haya hueco.
+             * Los Event táctiles se convierten en Touch_Event. No se garantiza el orden relativo
+             * entre los eventos táctiles y el resto.
+             */
             void handle (const Event & event)
             {
-                event_queue.push (event);
+                if (Touch_Event::is_touch (event.id))
+                {
+                    handle (Touch_Event::from (event));
+                }
+                else
+                {
+                    event_queue.push (event);
+                }
+            }
+
+            void handle (Event && event)
+            {
+                if (Touch_Event::is_touch (event.id))
+                {
+                    handle (Touch_Event::from (event));
+                }
+                else
+                {
+                    event_queue.push (std::move (event));
+                }
+            }
+
+            void handle (const Touch_Event & touch)
+            {
+                // Perder un touch-started o un touch-ended deja a la escena con un dedo que nunca
+                // empezó o que nunca se levanta. Un touch-moved perdido, en cambio, lo corrige el
+                // siguiente, así que solo se descartan movimientos:
+
+                touch_queue.push
+                (
+                    Touch_Event(touch),
+                    touch.id == ID(touch-moved) ? touch_queue.DISCARD : touch_queue.WAIT
+                );
             }
 
         private:
 
             void run_kernel ();
-            bool check_scene ();
+            bool check_scene (bool wait_for_preload);
+
+            bool touch_state_from_events () const
+            {
+                return deterministic.enabled || headless_window;
+            }
+            void collect_preloads ();
+            void dispatch_input_events (bool rescale, float h_ratio, float v_ratio);
+            void deliver_touch_move (Touch_Trail & trail);
+            void record_display_latency ();
             void reset_viewport (Window::Accessor & window);
 
         };
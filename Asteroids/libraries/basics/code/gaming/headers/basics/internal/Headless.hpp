@@ -0,0 +1,206 @@
+/*
+ * HEADLESS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181012
+ */
+
+#ifndef BASICS_HEADLESS_HEADER
+#define BASICS_HEADLESS_HEADER
+
+    #include <memory>
+    #include <basics/Canvas>
+    #include <basics/Graphics_Context>
+    #include <basics/Size>
+    #include <basics/Text_Prefab>
+    #include <basics/Texture_2D>
+    #include <basics/Window>
+
+    namespace basics
+    {
+
+        /**
+         * Etiqueta para enable< Headless > (), que registra las factorías de Canvas, Texture_2D y
+         * Text_Prefab del backend nulo. Este backend permite ejecutar escenas sin ventana ni contexto gráfico real
+         * (por ejemplo, para medir el rendimiento de la lógica del juego en un PC o en CI).
+         */
+        class Headless;
+
+        namespace headless
+        {
+
+            /**
+             * Ventana ficticia que siempre está disponible y tiene el foco. No se registra en el
+             * gestor de ventanas de la plataforma: es el Director quien la crea y la mantiene viva.
+             */
+            class Window : public basics::Window
+            {
+            private:
+
+                Size2u size;
+
+            public:
+
+                static std::shared_ptr< basics::Window > create (const Size2u & size);
+
+            private:
+
+                Window(const Size2u & size) : basics::Window(ID(headless-window)), size(size)
+                {
+                    available = true;
+                    focused   = true;
+                }
+
+            public:
+
+               ~Window() = default;
+
+            public:
+
+                Size2u   get_size   () override { return size;        }
+                unsigned get_width  () override { return size.width;  }
+                unsigned get_height () override { return size.height; }
+
+            };
+
+            /**
+             * Contexto gráfico nulo. No dibuja nada, pero permite que las escenas obtengan un Canvas
+             * y creen texturas igual que con un contexto real.
+             */
+            class Context : public basics::Graphics_Context
+            {
+            private:
+
+                Size2u surface_size;
+
+            public:
+
+                Context(basics::Window & window, const Size2u & surface_size)
+                :
+                    basics::Graphics_Context(window),
+                    surface_size(surface_size)
+                {
+                }
+
+               ~Context() = default;
+
+            public:
+
+                void invalidate () override { }
+                void suspend    () override { }
+                bool resume     () override { return true; }
+
+                bool is_available () const override { return true; }
+                bool is_current   () const override { return true; }
+
+                Id       get_id             () const override { return ID(headless); }
+                unsigned get_surface_width  ()       override { return surface_size.width;  }
+                unsigned get_surface_height ()       override { return surface_size.height; }
+
+                bool set_sync_swap  (bool activated) override { return false; }
+                void reset_viewport () override { }
+                void set_viewport   (const Point2u & bottom_left, const Size2u & size) override { }
+
+                bool make_current      () override { return true; }
+                bool flush_and_display () override { return true; }
+
+            };
+
+            /**
+             * Canvas que descarta todas las operaciones de dibujo. Las llamadas virtuales se siguen
+             * haciendo, por lo que el coste medido en render() es el de la propia escena.
+             */
+            class Canvas : public basics::Canvas
+            {
+            public:
+
+                static basics::Canvas * create (Id id, Graphics_Context::Accessor & context, const Options & options);
+
+                static void enable ()
+                {
+                    register_factory (ID(headless), Canvas::create);
+                }
+
+            public:
+
+               ~Canvas() = default;
+
+            };
+
+            /**
+             * Textura que solo conserva sus dimensiones. No guarda una copia de los píxeles.
+             */
+            class Texture_2D : public basics::Texture_2D
+            {
+            public:
+
+                static std::shared_ptr< basics::Texture_2D > create (Id id, Color_Buffer< Rgba8888 > & color_buffer, const Options & options = {});
+
+                static void enable ()
+                {
+                    register_factory (ID(headless), Texture_2D::create);
+                }
+
+            public:
+
+                Texture_2D(unsigned width, unsigned height) : basics::Texture_2D(width, height)
+                {
+                }
+
+            public:
+
+                bool initialize () override
+                {
+                    return initialized = true;
+                }
+
+                void finalize () override
+                {
+                    initialized = false;
+                }
+
+            };
+
+            /**
+             * Texto prefabricado que solo conserva su maquetación (Canvas lo dibuja con ella).
+             */
+            class Text_Prefab : public basics::Text_Prefab
+            {
+            public:
+
+                static std::shared_ptr< basics::Text_Prefab > create (const Text_Layout & layout);
+
+                static void enable ()
+                {
+                    register_factory (ID(headless), Text_Prefab::create);
+                }
+
+            public:
+
+                Text_Prefab(const Text_Layout & layout) : basics::Text_Prefab(layout)
+                {
+                }
+
+            public:
+
+                bool initialize () override
+                {
+                    return true;
+                }
+
+                void finalize () override
+                {
+                }
+
+            };
+
+        }
+
+    }
+
+#endif
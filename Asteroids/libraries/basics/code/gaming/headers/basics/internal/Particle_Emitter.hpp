@@ -0,0 +1,196 @@
+/*
+ * PARTICLE EMITTER
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181800
+ */
+
+#ifndef BASICS_PARTICLE_EMITTER_HEADER
+#define BASICS_PARTICLE_EMITTER_HEADER
+
+    #include <cstdint>
+    #include <vector>
+    #include <basics/Canvas>
+    #include <basics/Point>
+    #include <basics/Random>
+    #include <basics/Texture_2D>
+    #include <basics/Vector>
+
+    namespace basics
+    {
+
+        /**
+         * Emisor de partículas. Las partículas se guardan como estructura de arrays y se actualizan
+         * con NEON o SSE cuando están disponibles: posición, velocidad (con aceleración y
+         * rozamiento), edad, y tamaño y color interpolados entre sus valores inicial y final según
+         * la edad. Todas las partículas de un emisor se dibujan con una sola llamada a
+         * Canvas::fill_particles() usando el modo de mezcla indicado en su configuración.
+         * La capacidad es fija: cuando el emisor está lleno las nuevas partículas se descartan.
+         */
+        class Particle_Emitter
+        {
+        public:
+
+            struct Settings
+            {
+                const Texture_2D * texture        = nullptr;
+                Canvas::Blending   blending       = Canvas::ADD;
+
+                float              rate           = 0.f;        ///< Partículas por segundo que se emiten solas mientras is_emitting().
+                float              min_lifetime   = .5f;        ///< En segundos.
+                float              max_lifetime   = 1.f;
+                float              min_speed      = 50.f;       ///< En unidades por segundo.
+                float              max_speed      = 100.f;
+                float              direction      = 0.f;        ///< Ángulo central de salida en radianes.
+                float              spread         = 6.2831853f; ///< Apertura del abanico de salida en radianes.
+                float              acceleration_x = 0.f;
+                float              acceleration_y = 0.f;
+                float              drag           = 0.f;        ///< Fracción de velocidad que se pierde por segundo.
+                float              start_size     = 16.f;
+                float              end_size       = 4.f;
+                float              start_color[4] = { 1.f, 1.f, 1.f, 1.f };
+                float              end_color  [4] = { 1.f, 1.f, 1.f, 0.f };
+            };
+
+        private:
+
+            Settings             settings;
+
+            size_t               capacity;
+            size_t               count;
+
+            // Estado de cada partícula:
+
+            std::vector< float > positions_x;
+            std::vector< float > positions_y;
+            std::vector< float > speeds_x;
+            std::vector< float > speeds_y;
+            std::vector< float > ages;
+            std::vector< float > inverse_lifetimes;
+
+            // Valores derivados de la edad que se pasan directamente a Canvas::fill_particles():
+
+            std::vector< float > sizes;
+            std::vector< float > reds;
+            std::vector< float > greens;
+            std::vector< float > blues;
+            std::vector< float > alphas;
+
+            Point2f              position;
+            Vector2f             velocity;                  ///< Velocidad que heredan las partículas emitidas automáticamente.
+            bool                 emitting;
+            float                pending_emission;          ///< Parte fraccionaria de partículas pendientes de emitir.
+            Random_Batch         random;
+
+        public:
+
+            Particle_Emitter(size_t capacity);
+            Particle_Emitter(size_t capacity, const Settings & settings);
+
+        public:
+
+            const Settings & get_settings () const
+            {
+                return settings;
+            }
+
+            Settings & get_settings ()
+            {
+                return settings;
+            }
+
+            size_t size () const
+            {
+                return count;
+            }
+
+            size_t get_capacity () const
+            {
+                return capacity;
+            }
+
+            bool is_emitting () const
+            {
+                return emitting;
+            }
+
+        public:
+
+            void set_settings (const Settings & new_settings)
+            {
+                settings = new_settings;
+            }
+
+            void set_position (const Point2f & new_position)
+            {
+                position = new_position;
+            }
+
+            void set_velocity (const Vector2f & new_velocity)
+            {
+                velocity = new_velocity;
+            }
+
+            /**
+             * Activa o desactiva la emisión automática de settings.rate partículas por segundo.
+             */
+            void set_emitting (bool new_emitting)
+            {
+                emitting = new_emitting;
+            }
+
+            /**
+             * Establece la semilla del generador de números pseudoaleatorios del emisor.
+             */
+            void set_seed (uint32_t seed)
+            {
+                random = Random_Batch(seed);
+            }
+
+        public:
+
+            /**
+             * Emite de golpe varias partículas (por ejemplo, una explosión).
+             * @param where Punto desde el que salen.
+             * @param amount Número de partículas.
+             * @param base_velocity Velocidad que se suma a la de cada partícula.
+             */
+            void emit (const Point2f & where, unsigned amount, const Vector2f & base_velocity = { 0.f, 0.f });
+
+            /**
+             * Elimina todas las partículas.
+             */
+            void clear ()
+            {
+                count            = 0;
+                pending_emission = 0.f;
+            }
+
+            /**
+             * Emite las partículas automáticas, avanza la simulación y elimina las que han agotado su
+             * vida.
+             * @param time Fracción de tiempo que se debe avanzar.
+             */
+            void update (float time);
+
+            /**
+             * Dibuja todas las partículas con una sola llamada a Canvas::fill_particles(). Restablece
+             * la mezcla Canvas::TRANSPARENCY al terminar.
+             */
+            void render (Canvas & canvas);
+
+        private:
+
+            void integrate   (float time);
+            void remove_dead ();
+
+        };
+
+    }
+
+#endif
@@ -16,33 +16,62 @@
     #include <basics/Event>
     #include <basics/Graphics_Context>
     #include <basics/Size>
+    #include <basics/types>
+    #include <basics/Touch_Event>
 
     namespace basics
     {
 
         class Scene
         {
+            friend class Director;
+
         private:
 
-            float frame_duration;
+            float    frame_duration;
+            bool     preloaded;
+            uint32_t random_seed;
 
         public:
 
             Scene()
             {
                 frame_duration = -1.f;
+                preloaded      = false;
+                random_seed    = 0;
             }
 
             virtual ~Scene() = default;
 
         public:
 
+            /**
+             * Director invoca este método desde un hilo secundario antes de llamar a initialize() por
+             * primera vez, mientras la escena anterior sigue ejecutándose. Solo debe hacer trabajo que
+             * no requiera el contexto gráfico (leer y decodificar assets, construir tablas, etc.).
+             * @return false si la escena no se puede usar, en cuyo caso no se llega a iniciar.
+             */
+            virtual bool preload    () { return true; }
+
             virtual bool initialize () { return true; }
             virtual void suspend    () { }
             virtual void resume     () { }
             virtual void finalize   () { }
 
             virtual void handle     (Event & event) { }
+
+            /**
+             * Recibe los eventos táctiles (ya en coordenadas de la escena). Por defecto los convierte
+             * en Event y los pasa a handle(), pero las escenas que procesan muchos toques pueden
+             * sobrescribirlo para leer directamente los campos tipados.
+             */
+            virtual void handle_touch (Touch_Event & touch)
+            {
+                Event event = touch.to_event ();
+
+                handle (event);
+            }
+
             virtual void update     (float time) { }
             virtual void render     (Graphics_Context::Accessor & context) { }
 
@@ -60,6 +89,21 @@
                 return frame_duration;
             }
 
+            bool is_preloaded () const
+            {
+                return preloaded;
+            }
+
+            /**
+             * Semilla que Director asigna a la escena justo antes de llamar a initialize(). En modo
+             * determinista (ver Director::set_deterministic()) es siempre la misma, por lo que las
+             * escenas que generan sus números aleatorios a partir de ella se pueden reproducir.
+             */
+            uint32_t get_random_seed () const
+            {
+                return random_seed;
+            }
+
         };
 
     }
@@ -0,0 +1,372 @@
+/*
+ * SPRITE POOL
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181730
+ */
+
+#ifndef BASICS_SPRITE_POOL_HEADER
+#define BASICS_SPRITE_POOL_HEADER
+
+    #include <cstdint>
+    #include <vector>
+    #include <basics/Canvas>
+    #include <basics/Point>
+    #include <basics/Size>
+    #include <basics/Texture_2D>
+    #include <basics/Vector>
+
+    namespace basics
+    {
+
+        /**
+         * Almacena un conjunto de sprites en forma de estructura de arrays (posiciones, velocidades,
+         * tamaños, visibilidad...) para que se puedan actualizar de golpe con instrucciones SIMD y
+         * dibujar agrupando en un mismo lote los sprites consecutivos que comparten textura.
+         * Los sprites se dibujan en el orden en que se crearon. El acceso a cada sprite se hace a
+         * través de un Handle cuya interfaz imita a la de un sprite individual.
+         */
+        class Sprite_Pool
+        {
+        public:
+
+            typedef uint32_t Index;
+
+            static constexpr Index invalid_index = 0xFFFFFFFF;
+
+            /**
+             * Referencia ligera (puntero al pool, índice y generación) a uno de los sprites del pool.
+             * Se comporta como un puntero: se puede copiar libremente y se usa con -> y *.
+             * Deja de ser válida (is_valid() retorna false) cuando se destruye el sprite o se vacía
+             * el pool, aunque su hueco se reutilice para otro sprite.
+             */
+            class Handle
+            {
+
+                friend class Sprite_Pool;
+
+                Sprite_Pool * pool;
+                Index         index;
+                uint32_t      generation;
+
+                Handle(Sprite_Pool * pool, Index index) : pool(pool), index(index), generation(pool->generations[index])
+                {
+                }
+
+            public:
+
+                Handle() : pool(nullptr), index(invalid_index), generation(0)
+                {
+                }
+
+                Index get_index () const
+                {
+                    return index;
+                }
+
+                bool is_valid () const
+                {
+                    return pool != nullptr && index < pool->generations.size () && pool->generations[index] == generation;
+                }
+
+                explicit operator bool () const
+                {
+                    return is_valid ();
+                }
+
+                bool operator == (const Handle & other) const
+                {
+                    return pool == other.pool && index == other.index && generation == other.generation;
+                }
+
+                bool operator != (const Handle & other) const
+                {
+                    return !(*this == other);
+                }
+
+                const Handle * operator -> () const
+                {
+                    return this;
+                }
+
+                const Handle & operator * () const
+                {
+                    return *this;
+                }
+
+            public:
+
+                // Getters (con nombres autoexplicativos):
+
+                Size2f   get_size       () const { return { pool->widths[index], pool->heights[index] }; }
+                float    get_width      () const { return   pool->widths     [index]; }
+                float    get_height     () const { return   pool->heights    [index]; }
+                Point2f  get_position   () const { return { pool->positions_x[index], pool->positions_y[index] }; }
+                float    get_position_x () const { return   pool->positions_x[index]; }
+                float    get_position_y () const { return   pool->positions_y[index]; }
+                Vector2f get_speed      () const { return { pool->speeds_x   [index], pool->speeds_y   [index] }; }
+                float    get_speed_x    () const { return   pool->speeds_x   [index]; }
+                float    get_speed_y    () const { return   pool->speeds_y   [index]; }
+                float    get_scale      () const { return   pool->scales     [index]; }
+
+                float get_left_x () const
+                {
+                    return pool->get_left_x (index);
+                }
+
+                float get_right_x () const
+                {
+                    return pool->get_left_x (index) + pool->widths[index];
+                }
+
+                float get_bottom_y () const
+                {
+                    return pool->get_bottom_y (index);
+                }
+
+                float get_top_y () const
+                {
+                    return pool->get_bottom_y (index) + pool->heights[index];
+                }
+
+                bool is_visible () const
+                {
+                    return pool->visibilities[index] != 0.f;
+                }
+
+                bool is_not_visible () const
+                {
+                    return pool->visibilities[index] == 0.f;
+                }
+
+            public:
+
+                // Setters (con nombres autoexplicativos). Son const porque modifican el sprite al
+                // que apunta el handle, no el handle en sí:
+
+                void set_anchor (int new_anchor) const
+                {
+                    pool->anchors[index] = new_anchor;
+                }
+
+                void set_position (const Point2f & new_position) const
+                {
+                    pool->positions_x[index] = new_position[0];
+                    pool->positions_y[index] = new_position[1];
+                }
+
+                void set_position_x (float new_position_x) const
+                {
+                    pool->positions_x[index] = new_position_x;
+                }
+
+                void set_position_y (float new_position_y) const
+                {
+                    pool->positions_y[index] = new_position_y;
+                }
+
+                void set_size (const Size2f & new_size) const
+                {
+                    pool->widths [index] = new_size.width;
+                    pool->heights[index] = new_size.height;
+                }
+
+                void set_scale (float new_scale) const
+                {
+                    pool->scales[index] = new_scale;
+                }
+
+                void set_speed (const Vector2f & new_speed) const
+                {
+                    pool->speeds_x[index] = new_speed[0];
+                    pool->speeds_y[index] = new_speed[1];
+                }
+
+                void set_speed_x (float new_speed_x) const
+                {
+                    pool->speeds_x[index] = new_speed_x;
+                }
+
+                void set_speed_y (float new_speed_y) const
+                {
+                    pool->speeds_y[index] = new_speed_y;
+                }
+
+                void set_texture (const Texture_2D * new_texture) const
+                {
+                    pool->textures[index] = new_texture;
+                }
+
+                /**
+                 * Hace que el sprite no se actualice ni se dibuje.
+                 */
+                void hide () const
+                {
+                    pool->visibilities[index] = 0.f;
+                }
+
+                /**
+                 * Hace que el sprite se actualice y se dibuje.
+                 */
+                void show () const
+                {
+                    pool->visibilities[index] = 1.f;
+                }
+
+            public:
+
+                /**
+                 * Comprueba si el área envolvente rectangular de este sprite se solapa con la de otro.
+                 */
+                bool intersects (const Handle & other) const;
+
+                /**
+                 * Comprueba si un punto está dentro del sprite.
+                 */
+                bool contains (const Point2f & point) const;
+
+            };
+
+        private:
+
+            // Los arrays siempre tienen una longitud múltiplo de 4 para que los kernels SIMD no
+            // tengan que tratar por separado los últimos elementos. Los huecos sin usar tienen
+            // velocidad 0 y visibilidad 0:
+
+            std::vector< float >              positions_x;
+            std::vector< float >              positions_y;
+            std::vector< float >              speeds_x;
+            std::vector< float >              speeds_y;
+            std::vector< float >              widths;
+            std::vector< float >              heights;
+            std::vector< float >              scales;
+            std::vector< float >              visibilities;       ///< 1 si el sprite es visible o 0 si no.
+            std::vector< int   >              anchors;
+            std::vector< const Texture_2D * > textures;
+            std::vector< uint8_t >            used;
+            std::vector< uint32_t >           generations;        ///< Cambia cada vez que se destruye el sprite del hueco (no se vacía en clear()).
+            std::vector< Index >              free_slots;
+
+            Index                             slot_count;         ///< Número de huecos ocupados alguna vez (el resto son relleno).
+            Index                             live_count;
+            Index                             high_water_mark;
+
+            // Arrays reutilizados entre fotogramas para montar los lotes de render():
+
+            std::vector< float >              batch_lefts;
+            std::vector< float >              batch_bottoms;
+            std::vector< float >              batch_widths;
+            std::vector< float >              batch_heights;
+
+        public:
+
+            Sprite_Pool(size_t initial_capacity = 64);
+
+        public:
+
+            /**
+             * Crea un nuevo sprite con el tamaño de la textura, anclado por el centro en (0,0),
+             * parado y visible.
+             * @param texture Textura del sprite. No debe ser nullptr.
+             */
+            Handle create (const Texture_2D * texture)
+            {
+                return create (texture, { texture->get_width (), texture->get_height () });
+            }
+
+            /**
+             * Crea un nuevo sprite con el tamaño indicado, anclado por el centro en (0,0), parado y
+             * visible.
+             * @param texture Textura del sprite. Puede ser nullptr si el pool solo se usa para simular
+             *     (los sprites sin textura se actualizan y colisionan, pero no se dibujan).
+             */
+            Handle create (const Texture_2D * texture, const Size2f & size);
+
+            /**
+             * Destruye un sprite. Su hueco se reutilizará en la próxima llamada a create().
+             * No hace nada si el handle ya no es válido.
+             */
+            void destroy (const Handle & sprite);
+
+            /**
+             * Destruye todos los sprites (los handles existentes dejan de ser válidos).
+             */
+            void clear ();
+
+            size_t size () const
+            {
+                return live_count;
+            }
+
+            bool empty () const
+            {
+                return live_count == 0;
+            }
+
+            /**
+             * Número de huecos reservados (sin reservar más memoria caben hasta este número de sprites).
+             */
+            size_t get_capacity () const
+            {
+                return positions_x.capacity ();
+            }
+
+            /**
+             * Máximo número de sprites vivos a la vez desde que se creó el pool.
+             */
+            size_t get_high_water_mark () const
+            {
+                return high_water_mark;
+            }
+
+        public:
+
+            /**
+             * Avanza la posición de todos los sprites visibles en función de su velocidad usando
+             * NEON o SSE cuando están disponibles.
+             * @param time Fracción de tiempo que se debe avanzar.
+             */
+            void update (float time);
+
+            /**
+             * Dibuja todos los sprites visibles usando Canvas::fill_rectangles() con un lote por
+             * cada secuencia de sprites consecutivos que comparten textura.
+             */
+            void render (Canvas & canvas);
+
+        private:
+
+            void grow ();
+
+            float get_left_x (Index index) const
+            {
+                int anchor = anchors[index];
+
+                return
+                    (anchor & 0x3) == LEFT  ? positions_x[index] :
+                    (anchor & 0x3) == RIGHT ? positions_x[index] - widths[index] :
+                                              positions_x[index] - widths[index] * .5f;
+            }
+
+            float get_bottom_y (Index index) const
+            {
+                int anchor = anchors[index];
+
+                return
+                    (anchor & 0xC) == BOTTOM ? positions_y[index] :
+                    (anchor & 0xC) == TOP    ? positions_y[index] - heights[index] :
+                                               positions_y[index] - heights[index] * .5f;
+            }
+
+            void flush_batch (Canvas & canvas, const Texture_2D * texture, int handling);
+
+        };
+
+    }
+
+#endif
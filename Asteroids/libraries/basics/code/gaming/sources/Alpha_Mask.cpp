@@ -0,0 +1,238 @@
+/*
+ * ALPHA MASK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181921
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <basics/Alpha_Mask>
+
+namespace basics
+{
+
+    namespace
+    {
+
+        inline unsigned popcount (uint64_t value)
+        {
+            #if defined(__GNUC__) || defined(__clang__)
+                return unsigned(__builtin_popcountll (value));
+            #else
+                value = value - ((value >> 1) & 0x5555555555555555ull);
+                value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+                value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+                return unsigned((value * 0x0101010101010101ull) >> 56);
+            #endif
+        }
+
+        /**
+         * Bits de las columnas [first, last) de la palabra word de una fila.
+         */
+        inline uint64_t column_mask (unsigned word, unsigned first, unsigned last)
+        {
+            unsigned begin = std::max (first, word * 64) - word * 64;
+            unsigned end   = std::min (last,  word * 64 + 64) - word * 64;
+
+            uint64_t high  = end   == 64 ? ~uint64_t(0) : (uint64_t(1) << end) - 1;
+            uint64_t low   = (uint64_t(1) << begin) - 1;
+
+            return high & ~low;
+        }
+
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    Alpha_Mask::Alpha_Mask()
+    :
+        image_width  (0),
+        image_height (0),
+        reduction    (1),
+        width        (0),
+        height       (0),
+        words_per_row(0)
+    {
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    Alpha_Mask::Alpha_Mask(const Color_Buffer< Rgba8888 > & image, unsigned reduction, uint8_t threshold)
+    :
+        image_width  (image.get_width  ()),
+        image_height (image.get_height ()),
+        reduction    (std::max (reduction, 1u))
+    {
+        width         = (image_width  + this->reduction - 1) / this->reduction;
+        height        = (image_height + this->reduction - 1) / this->reduction;
+        words_per_row = (width + 63) / 64;
+
+        if (width == 0 || height == 0)
+        {
+            width = height = words_per_row = 0;
+            return;
+        }
+
+        bits.assign (size_t(words_per_row) * height, 0);
+
+        // Los píxeles están en orden R, G, B, A en memoria, por lo que el alfa se lee como byte para
+        // no depender del orden de bytes de la plataforma:
+
+        const uint8_t * pixels = reinterpret_cast< const uint8_t * >(image.buffer.data ());
+
+        for (unsigned image_y = 0; image_y < image_height; ++image_y)
+        {
+            const uint8_t * alpha = pixels + size_t(image_y) * image_width * 4 + 3;
+            uint64_t      * row   = &bits[size_t((image_height - 1 - image_y) / this->reduction) * words_per_row];
+
+            for (unsigned image_x = 0; image_x < image_width; ++image_x, alpha += 4)
+            {
+                if (*alpha >= threshold)
+                {
+                    unsigned x = image_x / this->reduction;
+
+                    row[x >> 6] |= uint64_t(1) << (x & 63);
+                }
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    unsigned Alpha_Mask::count () const
+    {
+        unsigned total = 0;
+
+        for (uint64_t word : bits) total += popcount (word);
+
+        return total;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    uint64_t Alpha_Mask::extract (unsigned row, int first) const
+    {
+        if (first >= int(width) || first <= -64) return 0;
+
+        const uint64_t * words = &bits[size_t(row) * words_per_row];
+
+        if (first < 0)
+        {
+            return words[0] << unsigned(-first);
+        }
+
+        unsigned word  = unsigned(first) >> 6;
+        unsigned shift = unsigned(first) & 63;
+        uint64_t value = words[word] >> shift;
+
+        if (shift != 0 && word + 1 < words_per_row)
+        {
+            value |= words[word + 1] << (64 - shift);
+        }
+
+        return value;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    unsigned Alpha_Mask::overlap_count
+    (
+        const Alpha_Mask & a, float a_left, float a_bottom, float a_width, float a_height,
+        const Alpha_Mask & b, float b_left, float b_bottom, float b_width, float b_height,
+        bool stop_at_first
+    )
+    {
+        if (a.empty () || b.empty ()) return 0;
+
+        // Intersección de los rectángulos:
+
+        float left   = std::max (a_left,   b_left  );
+        float bottom = std::max (a_bottom, b_bottom);
+        float right  = std::min (a_left   + a_width,  b_left   + b_width );
+        float top    = std::min (a_bottom + a_height, b_bottom + b_height);
+
+        if (left >= right || bottom >= top) return 0;
+
+        // Tamaño de cada bit en unidades de la escena:
+
+        float a_cell_width  = a_width  * a.reduction / a.image_width;
+        float a_cell_height = a_height * a.reduction / a.image_height;
+        float b_cell_width  = b_width  * b.reduction / b.image_width;
+        float b_cell_height = b_height * b.reduction / b.image_height;
+
+        // Columnas y filas de a que caen dentro de la intersección:
+
+        unsigned first_column = unsigned(std::max (0.f, std::floor ((left   - a_left  ) / a_cell_width )));
+        unsigned last_column  = unsigned(std::max (0.f, std::ceil  ((right  - a_left  ) / a_cell_width )));
+        unsigned first_row    = unsigned(std::max (0.f, std::floor ((bottom - a_bottom) / a_cell_height)));
+        unsigned last_row     = unsigned(std::max (0.f, std::ceil  ((top    - a_bottom) / a_cell_height)));
+
+        last_column = std::min (last_column, a.width );
+        last_row    = std::min (last_row,    a.height);
+
+        if (first_column >= last_column || first_row >= last_row) return 0;
+
+        // Si los bits de ambas máscaras tienen el mismo ancho en la escena (lo habitual cuando los
+        // sprites se dibujan al tamaño de su textura con la misma reducción), la columna x de a
+        // corresponde a la columna x - shift de b y cada fila se compara de 64 en 64 bits:
+
+        bool same_columns = std::fabs (a_cell_width - b_cell_width) <= a_cell_width * 1e-3f;
+        int  shift        = int(std::floor ((b_left - a_left) / a_cell_width + .5f));
+        unsigned total    = 0;
+
+        for (unsigned a_row = first_row; a_row < last_row; ++a_row)
+        {
+            float y     = a_bottom + (a_row + .5f) * a_cell_height;
+            int   b_row = int(std::floor ((y - b_bottom) / b_cell_height));
+
+            if (b_row < 0 || b_row >= int(b.height)) continue;
+
+            const uint64_t * a_words = &a.bits[size_t(a_row) * a.words_per_row];
+
+            if (same_columns)
+            {
+                for (unsigned word = first_column >> 6, last_word = (last_column - 1) >> 6; word <= last_word; ++word)
+                {
+                    uint64_t hits = a_words[word]
+                                  & b.extract (unsigned(b_row), int(word * 64) - shift)
+                                  & column_mask (word, first_column, last_column);
+
+                    if (hits)
+                    {
+                        if (stop_at_first) return 1;
+
+                        total += popcount (hits);
+                    }
+                }
+            }
+            else
+            {
+                // Con distinta escala se muestrea b en el centro de cada bit de a:
+
+                for (unsigned a_column = first_column; a_column < last_column; ++a_column)
+                {
+                    if ((a_words[a_column >> 6] >> (a_column & 63) & 1) == 0) continue;
+
+                    float x        = a_left + (a_column + .5f) * a_cell_width;
+                    int   b_column = int(std::floor ((x - b_left) / b_cell_width));
+
+                    if (b_column >= 0 && b.test (unsigned(b_column), unsigned(b_row)))
+                    {
+                        if (stop_at_first) return 1;
+
+                        total++;
+                    }
+                }
+            }
+        }
+
+        return total;
+    }
+
+}
@@ -0,0 +1,317 @@
+/*
+ * COLLISION WORLD
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181741
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <basics/Collision_World>
+
+namespace basics
+{
+
+    Collision_World::Collision_World(float cell_size)
+    :
+        cell_size        (cell_size),
+        inverse_cell_size(1.f / cell_size)
+    {
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    Collision_World::Body_Id Collision_World::add_body (uint32_t layer, uint32_t mask, uintptr_t user_data)
+    {
+        Body_Id id;
+
+        if (!free_bodies.empty ())
+        {
+            id = free_bodies.back ();
+            free_bodies.pop_back ();
+        }
+        else
+        {
+            id = Body_Id(bodies.size ());
+            bodies.emplace_back ();
+        }
+
+        Body & body = bodies[id];
+
+        body.left         = body.bottom = body.right = body.top = 0.f;
+        body.layer        = layer;
+        body.mask         = mask;
+        body.user_data    = user_data;
+        body.cells        = body.target_cells = compute_cells (0.f, 0.f, 0.f, 0.f);
+        body.used         = true;
+        body.enabled      = true;
+        body.inserted     = false;
+        body.dirty        = false;
+
+        mark_dirty (id);
+
+        return id;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Collision_World::remove_body (Body_Id id)
+    {
+        if (id < bodies.size () && bodies[id].used)
+        {
+            detach_body (id);
+
+            bodies[id].used    = false;
+            bodies[id].enabled = false;
+
+            free_bodies.push_back (id);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Collision_World::clear ()
+    {
+        bodies      .clear ();
+        free_bodies .clear ();
+        dirty_bodies.clear ();
+        cells       .clear ();
+        pairs       .clear ();
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Collision_World::set_bounds (Body_Id id, float left, float bottom, float right, float top)
+    {
+        Body & body = bodies[id];
+
+        body.left   = left;
+        body.bottom = bottom;
+        body.right  = right;
+        body.top    = top;
+
+        Cell_Range target_cells = compute_cells (left, bottom, right, top);
+
+        // Mientras el cuerpo no cambie de celdas no es necesario tocar la rejilla:
+
+        if (target_cells != body.target_cells)
+        {
+            body.target_cells = target_cells;
+
+            mark_dirty (id);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Collision_World::set_enabled (Body_Id id, bool enabled)
+    {
+        Body & body = bodies[id];
+
+        if (body.enabled != enabled)
+        {
+            body.enabled = enabled;
+
+            mark_dirty (id);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Collision_World::update ()
+    {
+        for (Body_Id id : dirty_bodies)
+        {
+            Body & body = bodies[id];
+
+            body.dirty = false;
+
+            if (!body.used) continue;
+
+            if (body.inserted && (!body.enabled || body.cells != body.target_cells))
+            {
+                detach_body (id);
+            }
+
+            if (body.enabled && !body.inserted)
+            {
+                insert_body (id);
+            }
+        }
+
+        dirty_bodies.clear ();
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    const std::vector< Collision_World::Pair > & Collision_World::find_pairs ()
+    {
+        update ();
+
+        pairs.clear ();
+
+        for (auto & entry : cells)
+        {
+            const Cell                   & cell = entry.second;
+            const std::vector< Body_Id > & ids  = cell.bodies;
+
+            for (size_t i = 0, count = ids.size (); i + 1 < count; ++i)
+            {
+                const Body & a = bodies[ids[i]];
+
+                for (size_t j = i + 1; j < count; ++j)
+                {
+                    const Body & b = bodies[ids[j]];
+
+                    if (!(a.mask & b.layer) || !(b.mask & a.layer)) continue;
+
+                    // Si ambos cuerpos comparten varias celdas, el par solo se cuenta en la primera
+                    // de ellas (la de menores coordenadas):
+
+                    if (cell.x != std::max (a.cells.min_x, b.cells.min_x)) continue;
+                    if (cell.y != std::max (a.cells.min_y, b.cells.min_y)) continue;
+
+                    if (overlap (a, b))
+                    {
+                        pairs.push_back (ids[i] < ids[j] ? Pair{ ids[i], ids[j] } : Pair{ ids[j], ids[i] });
+                    }
+                }
+            }
+        }
+
+        return pairs;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    size_t Collision_World::query (float left, float bottom, float right, float top, uint32_t mask, std::vector< Body_Id > & output)
+    {
+        update ();
+
+        Body       area;
+        Cell_Range range = compute_cells (left, bottom, right, top);
+        size_t     found = 0;
+
+        area.left   = left;
+        area.bottom = bottom;
+        area.right  = right;
+        area.top    = top;
+
+        for (int32_t y = range.min_y; y <= range.max_y; ++y)
+        {
+            for (int32_t x = range.min_x; x <= range.max_x; ++x)
+            {
+                auto cell = cells.find (cell_key (x, y));
+
+                if (cell == cells.end ()) continue;
+
+                for (Body_Id id : cell->second.bodies)
+                {
+                    const Body & body = bodies[id];
+
+                    if (!(body.layer & mask)) continue;
+
+                    if (x != std::max (body.cells.min_x, range.min_x)) continue;
+                    if (y != std::max (body.cells.min_y, range.min_y)) continue;
+
+                    if (overlap (body, area))
+                    {
+                        output.push_back (id);
+                        found++;
+                    }
+                }
+            }
+        }
+
+        return found;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    Collision_World::Cell_Range Collision_World::compute_cells (float left, float bottom, float right, float top) const
+    {
+        return Cell_Range
+        {
+            int32_t(std::floor (left   * inverse_cell_size)),
+            int32_t(std::floor (bottom * inverse_cell_size)),
+            int32_t(std::floor (right  * inverse_cell_size)),
+            int32_t(std::floor (top    * inverse_cell_size)),
+        };
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Collision_World::mark_dirty (Body_Id id)
+    {
+        if (!bodies[id].dirty)
+        {
+            bodies[id].dirty = true;
+
+            dirty_bodies.push_back (id);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Collision_World::insert_body (Body_Id id)
+    {
+        Body & body = bodies[id];
+
+        body.cells    = body.target_cells;
+        body.inserted = true;
+
+        for (int32_t y = body.cells.min_y; y <= body.cells.max_y; ++y)
+        {
+            for (int32_t x = body.cells.min_x; x <= body.cells.max_x; ++x)
+            {
+                Cell & cell = cells[cell_key (x, y)];
+
+                cell.x = x;
+                cell.y = y;
+                cell.bodies.push_back (id);
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Collision_World::detach_body (Body_Id id)
+    {
+        Body & body = bodies[id];
+
+        if (!body.inserted) return;
+
+        for (int32_t y = body.cells.min_y; y <= body.cells.max_y; ++y)
+        {
+            for (int32_t x = body.cells.min_x; x <= body.cells.max_x; ++x)
+            {
+                auto cell = cells.find (cell_key (x, y));
+
+                if (cell == cells.end ()) continue;
+
+                std::vector< Body_Id > & ids = cell->second.bodies;
+
+                auto position = std::find (ids.begin (), ids.end (), id);
+
+                if (position != ids.end ())
+                {
+                    *position = ids.back ();
+                    ids.pop_back ();
+                }
+
+                if (ids.empty ())
+                {
+                    cells.erase (cell);
+                }
+            }
+        }
+
+        body.inserted = false;
+    }
+
+}
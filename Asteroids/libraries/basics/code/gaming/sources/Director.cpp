@@ -10,32 +10,55 @@
  * C1801072305
  */
 
+#include <algorithm>
 #include <basics/Application>
 #include <basics/Director>
+#include <basics/enable>
+#include <basics/Headless>
 #include <basics/Log>
 #include <basics/Scene>
 #include <basics/Timer>
 #include <basics/Window>
-#include <basics/opengles/Canvas_ES2>
-#include <basics/opengles/Context>
 
 namespace basics
 {
 
     Director & director = Director::get_instance ();
 
+    // ---------------------------------------------------------------------------------------------
+    // The touch time stamps come from CLOCK_MONOTONIC, which is what steady_clock uses:
+
+    static int64_t monotonic_nanoseconds ()
+    {
+        return std::chrono::duration_cast< std::chrono::nanoseconds >
+        (
+            std::chrono::steady_clock::now ().time_since_epoch ()
+        )
+        .count ();
+    }
+
     // ---------------------------------------------------------------------------------------------
 
     Director::Director()
     {
         kernel.running           = false;
-        graphics_context_factory = opengles::Context::create;
+        graphics_context_factory = default_graphics_context_factory ();
+        touch_trail_count        = 0;
+        frame_timestamp_count    = 0;
+        latency_log_period       = 10.f;
+        recording                = false;
+        simulation_step          = 0;
     }
 
     // ---------------------------------------------------------------------------------------------
 
     Graphics_Context::Accessor Director::lock_graphics_context ()
     {
+        if (headless_window)
+        {
+            return headless_window->lock_graphics_context ();
+        }
+
         Window::Accessor window = Window::get_window (default_window_id).lock ();
 
         if (window)
@@ -67,6 +90,114 @@ namespace basics
 
     // ---------------------------------------------------------------------------------------------
 
+    void Director::preload_scene (const std::shared_ptr< Scene > & scene)
+    {
+        if (scene && !scene->preloaded && preloads.count (scene.get ()) == 0)
+        {
+            // The lambda keeps a reference to the scene so it can't be destroyed while loading:
+
+            preloads[scene.get ()] = Preload
+            {
+                scene,
+                std::async (std::launch::async, [scene] () { return scene->preload (); })
+            };
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Director::evict_scene (Id id)
+    {
+        scene_cache.erase (id);
+
+        collect_preloads ();
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Director::collect_preloads ()
+    {
+        // The finished preloads of scenes other than the target one (scenes preloaded in advance
+        // that may never run) are applied to their scenes and removed, so the map doesn't keep
+        // growing and doesn't keep those scenes alive. The target scene is handled by check_scene():
+
+        for (auto preload = preloads.begin (); preload != preloads.end (); )
+        {
+            if
+            (
+                preload->second.scene != target_scene &&
+                preload->second.result.wait_for (std::chrono::seconds(0)) == std::future_status::ready
+            )
+            {
+                preload->second.scene->preloaded = preload->second.result.get ();
+                preload = preloads.erase (preload);
+            }
+            else
+            {
+                ++preload;
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    bool Director::start_recording ()
+    {
+        if (!deterministic.enabled) return false;
+
+        input_log = Input_Log(deterministic.seed, deterministic.time_step);
+        recording = true;
+
+        return true;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Director::stop_recording ()
+    {
+        if (recording)
+        {
+            // Se incluyen los pasos finales en los que no llegó ningún evento:
+
+            if (simulation_step > input_log.get_step_count ()) input_log.set_step_count (simulation_step);
+
+            recording = false;
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    Director::Benchmark_Results Director::replay (const std::shared_ptr< Scene > & scene, const Input_Log & log)
+    {
+        // The logged touches are already in scene coordinates, which is what run_headless()
+        // expects. Their time stamps are dropped so they don't skew the latency histograms:
+
+        std::vector< Scripted_Event > script;
+
+        script.reserve (log.get_records ().size ());
+
+        for (const auto & record : log.get_records ())
+        {
+            Touch_Event touch = record.touch;
+
+            touch.timestamp = 0;
+
+            script.push_back (Scripted_Event{ record.step, touch.to_event () });
+        }
+
+        auto previous = deterministic;
+
+        set_deterministic (log.get_seed (), log.get_time_step ());
+
+        Benchmark_Results results = run_headless (scene, log.get_step_count (), log.get_time_step (), script);
+
+        deterministic = previous;
+
+        return results;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
     void Director::run_kernel ()
     {
         kernel.running = true;
@@ -89,40 +220,17 @@ namespace basics
 
             // Check if the current scene must be replaced:
 
-            if (target_scene)
+            if (check_scene (false))
             {
-                // If the current scene must be replaced, then it is first finalized:
-
-                if (current_scene) current_scene->finalize ();
-
-                // And then possibly destroyed:
-
-                current_scene.reset ();
-
-                // The new scene is then initialized:
-
-                if (target_scene->initialize ())
-                {
-                    // If the initialization succeeded, then it is made current:
-
-                    current_scene = target_scene;
-
-                    // The target pointer is cleared:
-
-                    target_scene.reset ();
-
-                    // Suspend of resume the scene depending on the current state:
+                // Initialize the frame time limit:
 
-                    if (state) current_scene->resume (); else current_scene->suspend ();
+                time = current_scene->get_frame_duration ();
 
-                    // Initialize the frame time limit:
+                if (time <= 0.f) time = 1.f / 60.f;
 
-                    time = current_scene->get_frame_duration ();
+                if (deterministic.enabled) time = deterministic.time_step;
 
-                    if (time <= 0.f) time = 1.f / 60.f;
-
-                    reset_canvas = true;
-                }
+                reset_canvas = true;
             }
 
             bool previously_active = state;
@@ -224,29 +332,16 @@ namespace basics
                             float  h_ratio = float(scene_view_size.width ) / surface_width;
                             float  v_ratio = float(scene_view_size.height) / surface_height;
 
-                            while (event_queue.poll (event))
-                            {
-                                switch (event.id)
-                                {
-                                    case ID(touch-started):
-                                    case ID(touch-moved):
-                                    case ID(touch-ended):
-                                    {
-                                        float x = *event.properties[ID(x)].as< var::Float > ();
-                                        float y = *event.properties[ID(y)].as< var::Float > ();
-
-                                        event.properties[ID(x)] = x * h_ratio;
-                                        event.properties[ID(y)] = (surface_height - y) * v_ratio;
-
-                                        break;
-                                    }
-                                }
+                            if (!touch_state_from_events ()) touch_surface->read (touch_state, h_ratio, v_ratio, surface_height);
 
-                                current_scene->handle (event);
-                            }
+                            dispatch_input_events (true, h_ratio, v_ratio);
+
+                            if ( touch_state_from_events ()) logged_touch_surface.read (touch_state);
 
                             current_scene->update (time);
 
+                            simulation_step++;
+
                             Graphics_Context::Accessor graphics_context = window->lock_graphics_context ();
 
                             if (graphics_context)
@@ -260,6 +355,8 @@ namespace basics
 
                                 current_scene->render (graphics_context);
 
+                                record_display_latency ();
+
                                 graphics_context->flush_and_display ();
                             }
                         }
@@ -267,9 +364,122 @@ namespace basics
                 }
             }
 
-            time = timer.get_elapsed_seconds ();
+            time = deterministic.enabled ? deterministic.time_step : timer.get_elapsed_seconds ();
+        }
+        while (!kernel.exit && (current_scene || target_scene));
+
+        if (current_scene)
+        {
+            current_scene->finalize ();
+
+            current_scene.reset ();
+        }
+
+        kernel.running = false;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    Director::Benchmark_Results Director::run_headless
+    (
+        const std::shared_ptr< Scene > & scene,
+        unsigned frame_count,
+        float    time_step,
+        const std::vector< Scripted_Event > & script
+    )
+    {
+        static const bool headless_enabled = enable< Headless > ();
+
+        Benchmark_Results results{ 0, 0.0, 0.0 };
+
+        if (!scene || kernel.running || !headless_enabled)
+        {
+            return results;
+        }
+
+        kernel.running = true;
+        kernel.exit    = false;
+        target_scene   = scene;
+
+        // The headless window is always available and focused and already has a context:
+
+        Size2u view_size = scene->get_view_size ();
+
+        headless_window  = headless::Window::create (view_size);
+        surface_width    = float(view_size.width );
+        surface_height   = float(view_size.height);
+
+        state.active     = true;
+        state.focused    = true;
+        state.graphics   = true;
+
+        double update_seconds = 0.0;
+        double render_seconds = 0.0;
+        size_t script_index   = 0;
+        bool   reset_canvas   = false;
+
+        for (unsigned frame = 0; frame < frame_count && !kernel.exit; ++frame)
+        {
+            if (check_scene (true)) reset_canvas = true;
+
+            if (!current_scene) break;
+
+            // The scripted events are already expressed in scene coordinates, so they are
+            // delivered without the rescaling applied to the events coming from the window:
+
+            while (script_index < script.size () && script[script_index].frame <= frame)
+            {
+                const Event & event = script[script_index++].event;
+
+                if (Touch_Event::is_touch (event.id))
+                {
+                    // Here the Director is also the consumer, so it can't wait for room in the queue
+                    // for touches that can't be discarded. The pending ones are delivered first:
+
+                    if (touch_queue.size () == touch_queue.capacity)
+                    {
+                        dispatch_input_events (false, 1.f, 1.f);
+                    }
+                }
+
+                handle (event);
+            }
+
+            dispatch_input_events (false, 1.f, 1.f);
+
+            logged_touch_surface.read (touch_state);
+
+            Timer timer;
+
+            current_scene->update (time_step);
+
+            simulation_step++;
+
+            update_seconds += timer.get_elapsed_seconds< double > ();
+
+            timer.reset ();
+
+            Graphics_Context::Accessor graphics_context = headless_window->lock_graphics_context ();
+
+            if (reset_canvas)
+            {
+                Canvas * canvas = graphics_context->get_renderer< Canvas > (ID(canvas));
+
+                if (canvas) canvas->reset_state ();
+
+                reset_canvas = false;
+            }
+
+            current_scene->render (graphics_context);
+
+            record_display_latency ();
+
+            graphics_context->flush_and_display ();
+
+            render_seconds += timer.get_elapsed_seconds< double > ();
+
+            results.frames++;
         }
-        while (!kernel.exit && current_scene);
 
         if (current_scene)
         {
@@ -278,7 +488,301 @@ namespace basics
             current_scene.reset ();
         }
 
+        target_scene.reset ();
+        headless_window.reset ();
+
+        state.active   = false;
+        state.focused  = false;
+        state.graphics = false;
+
+        if (results.frames > 0)
+        {
+            results.update_ns_per_frame = update_seconds * 1e9 / results.frames;
+            results.render_ns_per_frame = render_seconds * 1e9 / results.frames;
+        }
+
         kernel.running = false;
+
+        return results;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    bool Director::check_scene (bool wait_for_preload)
+    {
+        if (!preloads.empty ()) collect_preloads ();
+
+        if (target_scene)
+        {
+            // The target scene can't be initialized until its preload has finished. Meanwhile, the
+            // current scene keeps running:
+
+            if (!target_scene->preloaded)
+            {
+                preload_scene (target_scene);
+
+                auto preload = preloads.find (target_scene.get ());
+
+                if (!wait_for_preload && preload->second.result.wait_for (std::chrono::seconds(0)) != std::future_status::ready)
+                {
+                    return false;
+                }
+
+                target_scene->preloaded = preload->second.result.get ();
+
+                preloads.erase (preload);
+
+                if (!target_scene->preloaded)
+                {
+                    log.e ("ERROR: failed to preload the scene!");
+
+                    target_scene.reset ();
+
+                    return false;
+                }
+            }
+
+            // If the current scene must be replaced, then it is first finalized:
+
+            if (current_scene) current_scene->finalize ();
+
+            // And then possibly destroyed:
+
+            current_scene.reset ();
+
+            // The new scene is then initialized with either the fixed seed or a time based one:
+
+            int64_t now = monotonic_nanoseconds ();
+
+            target_scene->random_seed = deterministic.enabled ? deterministic.seed : uint32_t(now ^ (now >> 32));
+
+            if (target_scene->initialize ())
+            {
+                // If the initialization succeeded, then it is made current and its steps are
+                // counted from zero (a recording in progress restarts with it):
+
+                current_scene   = target_scene;
+                simulation_step = 0;
+
+                // The touch state derived from the delivered touches also starts from scratch, as it
+                // does when the scene is replayed:
+
+                if (touch_state_from_events ())
+                {
+                    logged_touch_surface.clear ();
+
+                    touch_state = Touch_Surface::State();
+                }
+
+                if (recording) input_log = Input_Log(deterministic.seed, deterministic.time_step);
+
+                // The target pointer is cleared:
+
+                target_scene.reset ();
+
+                // Suspend of resume the scene depending on the current state:
+
+                if (state) current_scene->resume (); else current_scene->suspend ();
+
+                return true;
+            }
+
+            // If the initialization failed, the kernel stops because there is no scene to run:
+
+            target_scene.reset ();
+        }
+
+        return false;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    unsigned Director::get_touch_samples (int32_t pointer_id, const Touch_Sample * & samples) const
+    {
+        for (unsigned index = 0; index < touch_trail_count; ++index)
+        {
+            if (touch_trails[index].pointer_id == pointer_id)
+            {
+                samples = touch_trails[index].samples;
+
+                return touch_trails[index].sample_count;
+            }
+        }
+
+        samples = nullptr;
+
+        return 0;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Director::dispatch_input_events (bool rescale, float h_ratio, float v_ratio)
+    {
+        size_t batch_count;
+
+        // Generic events are delivered as they come:
+
+        while ((batch_count = event_queue.poll (input_batch, input_batch_size)) > 0)
+        {
+            for (size_t index = 0; index < batch_count; ++index)
+            {
+                current_scene->handle (input_batch[index]);
+            }
+        }
+
+        // The trails only keep the samples received during the current frame:
+
+        touch_trail_count = 0;
+
+        int64_t now = monotonic_nanoseconds ();
+
+        while ((batch_count = touch_queue.poll (touch_batch, touch_batch_size)) > 0)
+        {
+            // The time stamps are kept to measure the latency when the frame is displayed:
+
+            for (size_t index = 0; index < batch_count; ++index)
+            {
+                int64_t timestamp = touch_batch[index].timestamp;
+
+                if (timestamp > 0)
+                {
+                    input_latency.record (now - timestamp);
+
+                    if (frame_timestamp_count < max_frame_timestamps)
+                    {
+                        frame_timestamps[frame_timestamp_count++] = timestamp;
+                    }
+                }
+            }
+
+            // The coordinates of the whole batch are converted to scene space at once:
+
+            if (rescale)
+            {
+                for (size_t index = 0; index < batch_count; ++index)
+                {
+                    touch_batch[index].x =                  touch_batch[index].x  * h_ratio;
+                    touch_batch[index].y = (surface_height - touch_batch[index].y) * v_ratio;
+                }
+            }
+
+            // They are recorded before the moves are coalesced so a replay gets the same trails:
+
+            if (recording)
+            {
+                for (size_t index = 0; index < batch_count; ++index)
+                {
+                    input_log.add (simulation_step, touch_batch[index]);
+                }
+            }
+
+            if (touch_state_from_events ())
+            {
+                for (size_t index = 0; index < batch_count; ++index)
+                {
+                    logged_touch_surface.record (touch_batch[index]);
+                }
+            }
+
+            for (size_t index = 0; index < batch_count; ++index)
+            {
+                Touch_Event & touch = touch_batch[index];
+
+                // Find the trail of the pointer or start a new one:
+
+                Touch_Trail * trail = nullptr;
+
+                for (unsigned t = 0; t < touch_trail_count && !trail; ++t)
+                {
+                    if (touch_trails[t].pointer_id == touch.pointer) trail = &touch_trails[t];
+                }
+
+                if (!trail && touch_trail_count < max_touch_pointers)
+                {
+                    trail = &touch_trails[touch_trail_count++];
+
+                    trail->pointer_id   = touch.pointer;
+                    trail->move_pending = false;
+                    trail->sample_count = 0;
+                }
+
+                if (trail)
+                {
+                    // Record the sample, dropping the oldest one when the trail is full:
+
+                    if (trail->sample_count == max_touch_samples)
+                    {
+                        std::copy (trail->samples + 1, trail->samples + max_touch_samples, trail->samples);
+
+                        trail->sample_count--;
+                    }
+
+                    trail->samples[trail->sample_count++] = Touch_Sample{ touch.x, touch.y, touch.timestamp };
+
+                    // Moves are held back so that only the latest one of each pointer is delivered.
+                    // Any other event of the pointer delivers its pending move first to keep order:
+
+                    if (touch.id == ID(touch-moved))
+                    {
+                        trail->latest_move  = touch;
+                        trail->move_pending = true;
+
+                        continue;
+                    }
+
+                    deliver_touch_move (*trail);
+                }
+
+                current_scene->handle_touch (touch);
+            }
+        }
+
+        for (unsigned index = 0; index < touch_trail_count; ++index)
+        {
+            deliver_touch_move (touch_trails[index]);
+        }
+
+        if (touch_state_from_events ()) logged_touch_surface.publish ();
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Director::deliver_touch_move (Touch_Trail & trail)
+    {
+        if (trail.move_pending)
+        {
+            trail.move_pending = false;
+
+            current_scene->handle_touch (trail.latest_move);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Director::record_display_latency ()
+    {
+        if (frame_timestamp_count > 0)
+        {
+            int64_t now = monotonic_nanoseconds ();
+
+            for (unsigned index = 0; index < frame_timestamp_count; ++index)
+            {
+                display_latency.record (now - frame_timestamps[index]);
+            }
+
+            frame_timestamp_count = 0;
+        }
+
+        if (latency_log_period > 0.f && latency_log_timer.get_elapsed_seconds () > latency_log_period)
+        {
+            if (display_latency.get_count () > 0)
+            {
+                log.i ("input latency: "   +   input_latency.summary ());
+                log.i ("display latency: " + display_latency.summary ());
+            }
+
+            latency_log_timer.reset ();
+        }
     }
 
     // ---------------------------------------------------------------------------------------------
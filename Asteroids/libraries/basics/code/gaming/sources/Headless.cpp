@@ -0,0 +1,64 @@
+/*
+ * HEADLESS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181018
+ */
+
+#include <basics/enable>
+#include <basics/Headless>
+
+namespace basics
+{
+
+    template< >
+    bool enable< Headless > ()
+    {
+        headless::Canvas     ::enable ();
+        headless::Texture_2D ::enable ();
+        headless::Text_Prefab::enable ();
+
+        return true;
+    }
+
+    namespace headless
+    {
+
+        std::shared_ptr< basics::Window > Window::create (const Size2u & size)
+        {
+            std::shared_ptr< Window > window(new Window(size));
+
+            std::shared_ptr< Graphics_Context > context(new Context(*window, size));
+
+            window->set_graphics_context (context);
+
+            return window;
+        }
+
+        basics::Canvas * Canvas::create (Id id, Graphics_Context::Accessor & context, const Options & options)
+        {
+            std::shared_ptr< basics::Canvas > canvas(new Canvas);
+
+            context->add (id, canvas);
+
+            return canvas.get ();
+        }
+
+        std::shared_ptr< basics::Texture_2D > Texture_2D::create (Id id, Color_Buffer< Rgba8888 > & color_buffer, const Options & options)
+        {
+            return std::make_shared< Texture_2D > (options.width, options.height);
+        }
+
+        std::shared_ptr< basics::Text_Prefab > Text_Prefab::create (const Text_Layout & layout)
+        {
+            return std::make_shared< Text_Prefab > (layout);
+        }
+
+    }
+
+}
@@ -0,0 +1,289 @@
+/*
+ * PARTICLE EMITTER
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181801
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <basics/Fast_Math>
+#include <basics/Particle_Emitter>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define BASICS_PARTICLE_EMITTER_NEON
+#elif defined(__SSE__) || defined(_M_X64) || defined(_M_IX86_FP)
+    #include <xmmintrin.h>
+    #define BASICS_PARTICLE_EMITTER_SSE
+#endif
+
+namespace basics
+{
+
+    Particle_Emitter::Particle_Emitter(size_t capacity)
+    :
+        Particle_Emitter(capacity, Settings())
+    {
+    }
+
+    Particle_Emitter::Particle_Emitter(size_t capacity, const Settings & settings)
+    :
+        settings        (settings),
+        capacity        (capacity),
+        count           (0),
+        position        ({ 0.f, 0.f }),
+        velocity        ({ 0.f, 0.f }),
+        emitting        (false),
+        pending_emission(0.f),
+        random          (0x9E3779B9)
+    {
+        // Los arrays se redondean a múltiplo de 4 para que los kernels SIMD no tengan que tratar
+        // por separado las últimas partículas:
+
+        size_t padded_capacity = (capacity + 3) & ~size_t(3);
+
+        positions_x      .resize (padded_capacity, 0.f);
+        positions_y      .resize (padded_capacity, 0.f);
+        speeds_x         .resize (padded_capacity, 0.f);
+        speeds_y         .resize (padded_capacity, 0.f);
+        ages             .resize (padded_capacity, 0.f);
+        inverse_lifetimes.resize (padded_capacity, 1.f);
+        sizes            .resize (padded_capacity, 0.f);
+        reds             .resize (padded_capacity, 0.f);
+        greens           .resize (padded_capacity, 0.f);
+        blues            .resize (padded_capacity, 0.f);
+        alphas           .resize (padded_capacity, 0.f);
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Particle_Emitter::emit (const Point2f & where, unsigned amount, const Vector2f & base_velocity)
+    {
+        const size_t first = count;
+        const size_t added = std::min< size_t > (amount, capacity - count);
+
+        if (added == 0) return;
+
+        // Los ángulos, velocidades y vidas se generan de golpe en los propios arrays de las
+        // partículas nuevas (speeds_x, speeds_y e inverse_lifetimes), y los senos se dejan
+        // temporalmente en ages:
+
+        float * angles  = speeds_x         .data () + first;
+        float * speeds  = speeds_y         .data () + first;
+        float * lives   = inverse_lifetimes.data () + first;
+        float * sines   = ages             .data () + first;
+
+        float half_spread = settings.spread * .5f;
+
+        random.fill (angles, added, settings.direction - half_spread, settings.direction + half_spread);
+        random.fill (speeds, added, settings.min_speed,    settings.max_speed   );
+        random.fill (lives,  added, settings.min_lifetime, settings.max_lifetime);
+
+        fast::sincos (angles, sines, angles, added);
+
+        for (size_t index = first; index < first + added; ++index)
+        {
+            float cosine = speeds_x         [index];
+            float sine   = ages             [index];
+            float speed  = speeds_y         [index];
+            float life   = inverse_lifetimes[index];
+
+            positions_x      [index] = where[0];
+            positions_y      [index] = where[1];
+            speeds_x         [index] = base_velocity[0] + cosine * speed;
+            speeds_y         [index] = base_velocity[1] + sine   * speed;
+            ages             [index] = 0.f;
+            inverse_lifetimes[index] = life > 0.f ? 1.f / life : 1e6f;
+            sizes            [index] = settings.start_size;
+            reds             [index] = settings.start_color[0];
+            greens           [index] = settings.start_color[1];
+            blues            [index] = settings.start_color[2];
+            alphas           [index] = settings.start_color[3];
+        }
+
+        count += added;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Particle_Emitter::update (float time)
+    {
+        if (emitting && settings.rate > 0.f)
+        {
+            pending_emission += settings.rate * time;
+
+            unsigned amount = unsigned(pending_emission);
+
+            pending_emission -= float(amount);
+
+            emit (position, amount, velocity);
+        }
+
+        if (count > 0)
+        {
+            integrate   (time);
+            remove_dead ();
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Particle_Emitter::integrate (float time)
+    {
+        const float damping     = std::max (0.f, 1.f - settings.drag * time);
+        const float step_x      = settings.acceleration_x * time;
+        const float step_y      = settings.acceleration_y * time;
+        const float size_delta  = settings.end_size     - settings.start_size;
+        const float red_delta   = settings.end_color[0] - settings.start_color[0];
+        const float green_delta = settings.end_color[1] - settings.start_color[1];
+        const float blue_delta  = settings.end_color[2] - settings.start_color[2];
+        const float alpha_delta = settings.end_color[3] - settings.start_color[3];
+
+        float * x     = positions_x      .data ();
+        float * y     = positions_y      .data ();
+        float * vx    = speeds_x         .data ();
+        float * vy    = speeds_y         .data ();
+        float * age   = ages             .data ();
+        float * inv   = inverse_lifetimes.data ();
+        float * size  = sizes            .data ();
+        float * red   = reds             .data ();
+        float * green = greens           .data ();
+        float * blue  = blues            .data ();
+        float * alpha = alphas           .data ();
+
+        size_t padded_count = (count + 3) & ~size_t(3);
+
+        #if defined(BASICS_PARTICLE_EMITTER_NEON)
+
+            const float32x4_t one = vdupq_n_f32 (1.f);
+
+            for (size_t i = 0; i < padded_count; i += 4)
+            {
+                float32x4_t new_vx  = vmulq_n_f32 (vaddq_f32 (vld1q_f32 (vx + i), vdupq_n_f32 (step_x)), damping);
+                float32x4_t new_vy  = vmulq_n_f32 (vaddq_f32 (vld1q_f32 (vy + i), vdupq_n_f32 (step_y)), damping);
+                float32x4_t new_age = vaddq_f32   (vld1q_f32 (age + i), vdupq_n_f32 (time));
+                float32x4_t k       = vminq_f32   (vmulq_f32 (new_age, vld1q_f32 (inv + i)), one);
+
+                vst1q_f32 (vx    + i, new_vx);
+                vst1q_f32 (vy    + i, new_vy);
+                vst1q_f32 (x     + i, vmlaq_n_f32 (vld1q_f32 (x + i), new_vx, time));
+                vst1q_f32 (y     + i, vmlaq_n_f32 (vld1q_f32 (y + i), new_vy, time));
+                vst1q_f32 (age   + i, new_age);
+                vst1q_f32 (size  + i, vmlaq_n_f32 (vdupq_n_f32 (settings.start_size    ), k, size_delta ));
+                vst1q_f32 (red   + i, vmlaq_n_f32 (vdupq_n_f32 (settings.start_color[0]), k, red_delta  ));
+                vst1q_f32 (green + i, vmlaq_n_f32 (vdupq_n_f32 (settings.start_color[1]), k, green_delta));
+                vst1q_f32 (blue  + i, vmlaq_n_f32 (vdupq_n_f32 (settings.start_color[2]), k, blue_delta ));
+                vst1q_f32 (alpha + i, vmlaq_n_f32 (vdupq_n_f32 (settings.start_color[3]), k, alpha_delta));
+            }
+
+        #elif defined(BASICS_PARTICLE_EMITTER_SSE)
+
+            const __m128 one       = _mm_set1_ps (1.f);
+            const __m128 time_4    = _mm_set1_ps (time);
+            const __m128 damping_4 = _mm_set1_ps (damping);
+            const __m128 step_x_4  = _mm_set1_ps (step_x);
+            const __m128 step_y_4  = _mm_set1_ps (step_y);
+
+            for (size_t i = 0; i < padded_count; i += 4)
+            {
+                __m128 new_vx  = _mm_mul_ps (_mm_add_ps (_mm_loadu_ps (vx + i), step_x_4), damping_4);
+                __m128 new_vy  = _mm_mul_ps (_mm_add_ps (_mm_loadu_ps (vy + i), step_y_4), damping_4);
+                __m128 new_age = _mm_add_ps (_mm_loadu_ps (age + i), time_4);
+                __m128 k       = _mm_min_ps (_mm_mul_ps (new_age, _mm_loadu_ps (inv + i)), one);
+
+                _mm_storeu_ps (vx    + i, new_vx);
+                _mm_storeu_ps (vy    + i, new_vy);
+                _mm_storeu_ps (x     + i, _mm_add_ps (_mm_loadu_ps (x + i), _mm_mul_ps (new_vx, time_4)));
+                _mm_storeu_ps (y     + i, _mm_add_ps (_mm_loadu_ps (y + i), _mm_mul_ps (new_vy, time_4)));
+                _mm_storeu_ps (age   + i, new_age);
+                _mm_storeu_ps (size  + i, _mm_add_ps (_mm_set1_ps (settings.start_size    ), _mm_mul_ps (k, _mm_set1_ps (size_delta ))));
+                _mm_storeu_ps (red   + i, _mm_add_ps (_mm_set1_ps (settings.start_color[0]), _mm_mul_ps (k, _mm_set1_ps (red_delta  ))));
+                _mm_storeu_ps (green + i, _mm_add_ps (_mm_set1_ps (settings.start_color[1]), _mm_mul_ps (k, _mm_set1_ps (green_delta))));
+                _mm_storeu_ps (blue  + i, _mm_add_ps (_mm_set1_ps (settings.start_color[2]), _mm_mul_ps (k, _mm_set1_ps (blue_delta ))));
+                _mm_storeu_ps (alpha + i, _mm_add_ps (_mm_set1_ps (settings.start_color[3]), _mm_mul_ps (k, _mm_set1_ps (alpha_delta))));
+            }
+
+        #else
+
+            for (size_t i = 0; i < padded_count; ++i)
+            {
+                vx [i] = (vx[i] + step_x) * damping;
+                vy [i] = (vy[i] + step_y) * damping;
+                x  [i] += vx[i] * time;
+                y  [i] += vy[i] * time;
+                age[i] += time;
+
+                float k = std::min (age[i] * inv[i], 1.f);
+
+                size [i] = settings.start_size     + k * size_delta;
+                red  [i] = settings.start_color[0] + k * red_delta;
+                green[i] = settings.start_color[1] + k * green_delta;
+                blue [i] = settings.start_color[2] + k * blue_delta;
+                alpha[i] = settings.start_color[3] + k * alpha_delta;
+            }
+
+        #endif
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Particle_Emitter::remove_dead ()
+    {
+        // Las partículas que han agotado su vida se sustituyen por la última para mantener los
+        // arrays compactos (el orden de las partículas no importa):
+
+        for (size_t i = 0; i < count; )
+        {
+            if (ages[i] * inverse_lifetimes[i] >= 1.f)
+            {
+                size_t last = --count;
+
+                positions_x      [i] = positions_x      [last];
+                positions_y      [i] = positions_y      [last];
+                speeds_x         [i] = speeds_x         [last];
+                speeds_y         [i] = speeds_y         [last];
+                ages             [i] = ages             [last];
+                inverse_lifetimes[i] = inverse_lifetimes[last];
+                sizes            [i] = sizes            [last];
+                reds             [i] = reds             [last];
+                greens           [i] = greens           [last];
+                blues            [i] = blues            [last];
+                alphas           [i] = alphas           [last];
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Particle_Emitter::render (Canvas & canvas)
+    {
+        if (count > 0 && settings.texture)
+        {
+            canvas.set_blending   (settings.blending);
+            canvas.fill_particles
+            (
+                settings.texture,
+                positions_x.data (),
+                positions_y.data (),
+                sizes      .data (),
+                reds       .data (),
+                greens     .data (),
+                blues      .data (),
+                alphas     .data (),
+                count
+            );
+            canvas.set_blending   (Canvas::TRANSPARENCY);
+        }
+    }
+
+}
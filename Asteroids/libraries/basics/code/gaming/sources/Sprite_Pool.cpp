@@ -0,0 +1,313 @@
+/*
+ * SPRITE POOL
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181731
+ */
+
+#include <basics/Sprite_Pool>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define BASICS_SPRITE_POOL_NEON
+#elif defined(__SSE__) || defined(_M_X64) || defined(_M_IX86_FP)
+    #include <xmmintrin.h>
+    #define BASICS_SPRITE_POOL_SSE
+#endif
+
+namespace basics
+{
+
+    bool Sprite_Pool::Handle::intersects (const Handle & other) const
+    {
+        float this_left    = this->get_left_x   ();
+        float this_bottom  = this->get_bottom_y ();
+        float this_right   = this_left   + this->get_width  ();
+        float this_top     = this_bottom + this->get_height ();
+
+        float other_left   = other.get_left_x   ();
+        float other_bottom = other.get_bottom_y ();
+        float other_right  = other_left   + other.get_width  ();
+        float other_top    = other_bottom + other.get_height ();
+
+        return !(other_left >= this_right || other_right <= this_left || other_bottom >= this_top || other_top <= this_bottom);
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    bool Sprite_Pool::Handle::contains (const Point2f & point) const
+    {
+        float left   = get_left_x   ();
+        float bottom = get_bottom_y ();
+
+        return
+            point[0] > left   && point[0] < left   + get_width  () &&
+            point[1] > bottom && point[1] < bottom + get_height ();
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    Sprite_Pool::Sprite_Pool(size_t initial_capacity)
+    :
+        slot_count     (0),
+        live_count     (0),
+        high_water_mark(0)
+    {
+        initial_capacity = (initial_capacity + 3) & ~size_t(3);
+
+        positions_x .reserve (initial_capacity);
+        positions_y .reserve (initial_capacity);
+        speeds_x    .reserve (initial_capacity);
+        speeds_y    .reserve (initial_capacity);
+        widths      .reserve (initial_capacity);
+        heights     .reserve (initial_capacity);
+        scales      .reserve (initial_capacity);
+        visibilities.reserve (initial_capacity);
+        anchors     .reserve (initial_capacity);
+        textures    .reserve (initial_capacity);
+        used        .reserve (initial_capacity);
+        generations .reserve (initial_capacity);
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    Sprite_Pool::Handle Sprite_Pool::create (const Texture_2D * texture, const Size2f & size)
+    {
+        Index index;
+
+        if (!free_slots.empty ())
+        {
+            index = free_slots.back ();
+            free_slots.pop_back ();
+        }
+        else
+        {
+            if (slot_count == positions_x.size ())
+            {
+                grow ();
+            }
+
+            index = slot_count++;
+        }
+
+        positions_x [index] = 0.f;
+        positions_y [index] = 0.f;
+        speeds_x    [index] = 0.f;
+        speeds_y    [index] = 0.f;
+        widths      [index] = size.width;
+        heights     [index] = size.height;
+        scales      [index] = 1.f;
+        visibilities[index] = 1.f;
+        anchors     [index] = CENTER;
+        textures    [index] = texture;
+        used        [index] = 1;
+
+        if (++live_count > high_water_mark) high_water_mark = live_count;
+
+        return Handle(this, index);
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Sprite_Pool::destroy (const Handle & sprite)
+    {
+        if (sprite.pool == this && sprite.is_valid () && used[sprite.index])
+        {
+            // El hueco se deja parado e invisible para que los kernels lo puedan recorrer igual
+            // que al resto:
+
+            speeds_x    [sprite.index] = 0.f;
+            speeds_y    [sprite.index] = 0.f;
+            visibilities[sprite.index] = 0.f;
+            textures    [sprite.index] = nullptr;
+            used        [sprite.index] = 0;
+            generations [sprite.index]++;
+
+            free_slots.push_back (sprite.index);
+
+            live_count--;
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Sprite_Pool::clear ()
+    {
+        positions_x .clear ();
+        positions_y .clear ();
+        speeds_x    .clear ();
+        speeds_y    .clear ();
+        widths      .clear ();
+        heights     .clear ();
+        scales      .clear ();
+        visibilities.clear ();
+        anchors     .clear ();
+        textures    .clear ();
+        used        .clear ();
+        free_slots  .clear ();
+
+        // Las generaciones se conservan para que los handles anteriores no den por válidos los
+        // sprites que se creen después en los mismos huecos:
+
+        for (auto & generation : generations) generation++;
+
+        slot_count = 0;
+        live_count = 0;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Sprite_Pool::grow ()
+    {
+        // Se añaden 4 huecos vacíos para mantener la longitud de los arrays múltiplo de 4:
+
+        size_t new_size = positions_x.size () + 4;
+
+        positions_x .resize (new_size, 0.f);
+        positions_y .resize (new_size, 0.f);
+        speeds_x    .resize (new_size, 0.f);
+        speeds_y    .resize (new_size, 0.f);
+        widths      .resize (new_size, 0.f);
+        heights     .resize (new_size, 0.f);
+        scales      .resize (new_size, 1.f);
+        visibilities.resize (new_size, 0.f);
+        anchors     .resize (new_size, CENTER);
+        textures    .resize (new_size, nullptr);
+        used        .resize (new_size, 0);
+
+        if (generations.size () < new_size)
+        {
+            generations.resize (new_size, 0);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Sprite_Pool::update (float time)
+    {
+        // position += speed * time * visible, de 4 en 4 sprites:
+
+              float * x       = positions_x .data ();
+              float * y       = positions_y .data ();
+        const float * vx      = speeds_x    .data ();
+        const float * vy      = speeds_y    .data ();
+        const float * visible = visibilities.data ();
+              size_t  count   = positions_x .size ();
+
+        #if defined(BASICS_SPRITE_POOL_NEON)
+
+            for (size_t index = 0; index < count; index += 4)
+            {
+                float32x4_t step = vmulq_n_f32 (vld1q_f32 (visible + index), time);
+
+                vst1q_f32 (x + index, vmlaq_f32 (vld1q_f32 (x + index), vld1q_f32 (vx + index), step));
+                vst1q_f32 (y + index, vmlaq_f32 (vld1q_f32 (y + index), vld1q_f32 (vy + index), step));
+            }
+
+        #elif defined(BASICS_SPRITE_POOL_SSE)
+
+            __m128 time_4 = _mm_set1_ps (time);
+
+            for (size_t index = 0; index < count; index += 4)
+            {
+                __m128 step = _mm_mul_ps (_mm_loadu_ps (visible + index), time_4);
+
+                _mm_storeu_ps (x + index, _mm_add_ps (_mm_loadu_ps (x + index), _mm_mul_ps (_mm_loadu_ps (vx + index), step)));
+                _mm_storeu_ps (y + index, _mm_add_ps (_mm_loadu_ps (y + index), _mm_mul_ps (_mm_loadu_ps (vy + index), step)));
+            }
+
+        #else
+
+            for (size_t index = 0; index < count; ++index)
+            {
+                float step = visible[index] * time;
+
+                x[index] += vx[index] * step;
+                y[index] += vy[index] * step;
+            }
+
+        #endif
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Sprite_Pool::render (Canvas & canvas)
+    {
+        const Texture_2D * batch_texture  = nullptr;
+        int                batch_handling = 0;
+
+        for (Index index = 0; index < slot_count; ++index)
+        {
+            if (visibilities[index] == 0.f || !textures[index]) continue;
+
+            const Texture_2D * texture  = textures[index];
+            int                handling = anchors [index] & 0xF0;
+
+            // Se cierra el lote en curso cuando cambia la textura o el volteo, lo que conserva el
+            // orden de dibujado:
+
+            if (texture != batch_texture || handling != batch_handling)
+            {
+                flush_batch (canvas, batch_texture, batch_handling);
+
+                batch_texture  = texture;
+                batch_handling = handling;
+            }
+
+            // El ancla se aplica sobre el tamaño escalado igual que hace Canvas::fill_rectangle():
+
+            float width  = widths [index] * scales[index];
+            float height = heights[index] * scales[index];
+            int   anchor = anchors[index];
+
+            batch_lefts.push_back
+            (
+                (anchor & 0x3) == LEFT  ? positions_x[index] :
+                (anchor & 0x3) == RIGHT ? positions_x[index] - width :
+                                          positions_x[index] - width * .5f
+            );
+
+            batch_bottoms.push_back
+            (
+                (anchor & 0xC) == BOTTOM ? positions_y[index] :
+                (anchor & 0xC) == TOP    ? positions_y[index] - height :
+                                           positions_y[index] - height * .5f
+            );
+
+            batch_widths .push_back (width );
+            batch_heights.push_back (height);
+        }
+
+        flush_batch (canvas, batch_texture, batch_handling);
+    }
+
+    // ---------------------------------------------------------------------------------------------
+
+    void Sprite_Pool::flush_batch (Canvas & canvas, const Texture_2D * texture, int handling)
+    {
+        if (!batch_lefts.empty ())
+        {
+            canvas.fill_rectangles
+            (
+                texture,
+                batch_lefts  .data (),
+                batch_bottoms.data (),
+                batch_widths .data (),
+                batch_heights.data (),
+                batch_lefts  .size (),
+                handling
+            );
+
+            batch_lefts  .clear ();
+            batch_bottoms.clear ();
+            batch_widths .clear ();
+            batch_heights.clear ();
+        }
+    }
+
+}
@@ -0,0 +1,264 @@
+/*
+ *  AFFINE
+ *  Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ *  Distributed under the Boost Software License, version  1.0
+ *  See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ *  angel.rodriguez@esne.edu
+ *
+ *  C2610181950
+ */
+
+#ifndef BASICS_AFFINE_HEADER
+#define BASICS_AFFINE_HEADER
+
+    #include <algorithm>
+    #include <cmath>
+    #include <cstddef>
+    #include "Point.hpp"
+    #include "Point_Transform.hpp"
+    #include "Transformation.hpp"
+    #include "Vector.hpp"
+
+    namespace basics
+    {
+
+        /**
+         * Transformación afín 2D guardada como las dos primeras filas (por filas) de la matriz 3x3
+         * equivalente, cuya última fila siempre es (0, 0, 1):
+         *
+         *   x' = values[0] * x + values[1] * y + values[2]
+         *   y' = values[3] * x + values[4] * y + values[5]
+         *
+         * Componer dos transformaciones cuesta 12 multiplicaciones en lugar de las 27 de
+         * Transformation2f, y transformar un punto 4 en lugar de 9.
+         */
+        class Affine2f
+        {
+        public:
+
+            float values[6];
+
+        public:
+
+            constexpr Affine2f() : values{ 1.f, 0.f, 0.f, 0.f, 1.f, 0.f }
+            {
+            }
+
+            constexpr Affine2f(float m00, float m01, float m02, float m10, float m11, float m12)
+            :
+                values{ m00, m01, m02, m10, m11, m12 }
+            {
+            }
+
+            /**
+             * Toma las dos primeras filas de la matriz. La tercera se descarta, por lo que solo se
+             * conserva el resultado si la transformación ya era afín.
+             */
+            explicit constexpr Affine2f(const Transformation2f & transformation)
+            :
+                values
+                {
+                    transformation.matrix.values[0], transformation.matrix.values[1], transformation.matrix.values[2],
+                    transformation.matrix.values[3], transformation.matrix.values[4], transformation.matrix.values[5]
+                }
+            {
+            }
+
+        public:
+
+            static constexpr Affine2f translation (const Vector2f & displacement)
+            {
+                return Affine2f(1.f, 0.f, displacement[0], 0.f, 1.f, displacement[1]);
+            }
+
+            static constexpr Affine2f scaling (float scale_x, float scale_y)
+            {
+                return Affine2f(scale_x, 0.f, 0.f, 0.f, scale_y, 0.f);
+            }
+
+            static Affine2f rotation (float angle)
+            {
+                return rotate_then_translate (angle, { 0.f, 0.f });
+            }
+
+            static Affine2f rotate_then_translate (float angle, const Vector2f & displacement)
+            {
+                float sin = std::sin (angle);
+                float cos = std::cos (angle);
+
+                return Affine2f(cos, -sin, displacement[0], sin, cos, displacement[1]);
+            }
+
+            static constexpr Affine2f scale_then_translate (float scale_x, float scale_y, const Vector2f & displacement)
+            {
+                return Affine2f(scale_x, 0.f, displacement[0], 0.f, scale_y, displacement[1]);
+            }
+
+            static constexpr Affine2f scale_then_translate (float scale, const Vector2f & displacement)
+            {
+                return scale_then_translate (scale, scale, displacement);
+            }
+
+            /**
+             * Escala, gira y traslada (en ese orden), que es lo que necesita un sprite.
+             */
+            static Affine2f scale_rotate_then_translate (float scale_x, float scale_y, float angle, const Vector2f & displacement)
+            {
+                float sin = std::sin (angle);
+                float cos = std::cos (angle);
+
+                return Affine2f(cos * scale_x, -sin * scale_y, displacement[0], sin * scale_x, cos * scale_y, displacement[1]);
+            }
+
+        public:
+
+            /**
+             * Composición: (a * b) aplica primero b y después a, igual que con Transformation2f.
+             */
+            constexpr Affine2f operator * (const Affine2f & other) const
+            {
+                return Affine2f
+                (
+                    values[0] * other.values[0] + values[1] * other.values[3],
+                    values[0] * other.values[1] + values[1] * other.values[4],
+                    values[0] * other.values[2] + values[1] * other.values[5] + values[2],
+                    values[3] * other.values[0] + values[4] * other.values[3],
+                    values[3] * other.values[1] + values[4] * other.values[4],
+                    values[3] * other.values[2] + values[4] * other.values[5] + values[5]
+                );
+            }
+
+            Affine2f & operator *= (const Affine2f & other)
+            {
+                return *this = *this * other;
+            }
+
+            constexpr float determinant () const
+            {
+                return values[0] * values[4] - values[1] * values[3];
+            }
+
+            /**
+             * Devuelve la transformación inversa. Si la transformación no es invertible (determinante
+             * 0) devuelve la identidad.
+             */
+            Affine2f inverse () const
+            {
+                float determinant = this->determinant ();
+
+                if (determinant == 0.f) return Affine2f();
+
+                float inverse_determinant = 1.f / determinant;
+
+                float m00 =  values[4] * inverse_determinant;
+                float m01 = -values[1] * inverse_determinant;
+                float m10 = -values[3] * inverse_determinant;
+                float m11 =  values[0] * inverse_determinant;
+
+                return Affine2f
+                (
+                    m00, m01, -(m00 * values[2] + m01 * values[5]),
+                    m10, m11, -(m10 * values[2] + m11 * values[5])
+                );
+            }
+
+        public:
+
+            constexpr Point2f transform (const Point2f & point) const
+            {
+                return Point2f
+                {
+                    values[0] * point[0] + values[1] * point[1] + values[2],
+                    values[3] * point[0] + values[4] * point[1] + values[5]
+                };
+            }
+
+            /**
+             * Transforma una dirección: se aplica la parte lineal pero no la traslación.
+             */
+            constexpr Vector2f transform (const Vector2f & vector) const
+            {
+                return Vector2f
+                {
+                    values[0] * vector[0] + values[1] * vector[1],
+                    values[3] * vector[0] + values[4] * vector[1]
+                };
+            }
+
+            /**
+             * Transforma count puntos (ver internal::transform_points). input y output pueden ser el
+             * mismo array.
+             */
+            void transform (const Point2f * input, Point2f * output, size_t count) const
+            {
+                internal::transform_points
+                (
+                    values,
+                    reinterpret_cast< const float * >(input),
+                    reinterpret_cast<       float * >(output),
+                    count
+                );
+            }
+
+            /**
+             * Igual que la anterior pero con las coordenadas en arrays separados.
+             */
+            void transform (const float * xs, const float * ys, float * out_xs, float * out_ys, size_t count) const
+            {
+                internal::transform_points (values, xs, ys, out_xs, out_ys, count);
+            }
+
+        public:
+
+            operator Transformation2f () const
+            {
+                Transformation2f transformation;
+
+                std::copy_n (values, 6, transformation.matrix.values);
+
+                return transformation;
+            }
+
+            bool operator == (const Affine2f & other) const
+            {
+                return std::equal (values, values + 6, other.values);
+            }
+
+            bool operator != (const Affine2f & other) const
+            {
+                return !(*this == other);
+            }
+
+        };
+
+        // -----------------------------------------------------------------------------------------
+
+        inline void transform_points (const Affine2f & transform, const Point2f * input, Point2f * output, size_t count)
+        {
+            transform.transform (input, output, count);
+        }
+
+        inline void transform_points (const Affine2f & transform, const float * xs, const float * ys, float * out_xs, float * out_ys, size_t count)
+        {
+            transform.transform (xs, ys, out_xs, out_ys, count);
+        }
+
+        /**
+         * Con Transformation2f se usan solo las dos primeras filas, igual que hacen los shaders de
+         * Canvas_ES2.
+         */
+        inline void transform_points (const Transformation2f & transform, const Point2f * input, Point2f * output, size_t count)
+        {
+            Affine2f(transform).transform (input, output, count);
+        }
+
+        inline void transform_points (const Transformation2f & transform, const float * xs, const float * ys, float * out_xs, float * out_ys, size_t count)
+        {
+            Affine2f(transform).transform (xs, ys, out_xs, out_ys, count);
+        }
+
+    }
+
+#endif
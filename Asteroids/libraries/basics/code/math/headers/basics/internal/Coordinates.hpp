@@ -82,33 +82,23 @@
                 }
 
                 ENABLE_IF(value_count == 1)
-                Coordinates(const Number & a)
+                constexpr Coordinates(const Number & a) : values{ a }
                 {
-                    values[0] = a;
                 }
 
                 ENABLE_IF(value_count == 2)
-                Coordinates(const Number & a, const Number & b)
+                constexpr Coordinates(const Number & a, const Number & b) : values{ a, b }
                 {
-                    values[0] = a;
-                    values[1] = b;
                 }
 
                 ENABLE_IF(value_count == 3)
-                Coordinates(const Number & a, const Number & b, const Number & c)
+                constexpr Coordinates(const Number & a, const Number & b, const Number & c) : values{ a, b, c }
                 {
-                    values[0] = a;
-                    values[1] = b;
-                    values[2] = c;
                 }
 
                 ENABLE_IF(value_count == 4)
-                Coordinates(const Number & a, const Number & b, const Number & c, const Number & d)
+                constexpr Coordinates(const Number & a, const Number & b, const Number & c, const Number & d) : values{ a, b, c, d }
                 {
-                    values[0] = a;
-                    values[1] = b;
-                    values[2] = c;
-                    values[4] = d;
                 }
 
             public:
@@ -118,7 +108,7 @@
                     return values[index];
                 }
 
-                const Number & operator [] (const unsigned index) const
+                constexpr const Number & operator [] (const unsigned index) const
                 {
                     return values[index];
                 }
@@ -165,20 +155,20 @@
             Coordinates(const Coordinates & ) = default;
 
             template< typename... PARAMETERS >
-            Coordinates(const PARAMETERS &... parameters) : Base(parameters...)
+            constexpr Coordinates(const PARAMETERS &... parameters) : Base(parameters...)
             {
             }
 
         public:
 
-            ENABLE_IF(dimension >= 1)       Number & x ()       { return values[0]; }
-            ENABLE_IF(dimension >= 1) const Number & x () const { return values[0]; }
-            ENABLE_IF(dimension >= 2)       Number & y ()       { return values[1]; }
-            ENABLE_IF(dimension >= 2) const Number & y () const { return values[1]; }
-            ENABLE_IF(dimension >= 3)       Number & z ()       { return values[2]; }
-            ENABLE_IF(dimension >= 3) const Number & z () const { return values[2]; }
-            ENABLE_IF(dimension >= 4)       Number & t ()       { return values[3]; }
-            ENABLE_IF(dimension >= 4) const Number & t () const { return values[3]; }
+            ENABLE_IF(dimension >= 1)                 Number & x ()       { return values[0]; }
+            ENABLE_IF(dimension >= 1) constexpr const Number & x () const { return values[0]; }
+            ENABLE_IF(dimension >= 2)                 Number & y ()       { return values[1]; }
+            ENABLE_IF(dimension >= 2) constexpr const Number & y () const { return values[1]; }
+            ENABLE_IF(dimension >= 3)                 Number & z ()       { return values[2]; }
+            ENABLE_IF(dimension >= 3) constexpr const Number & z () const { return values[2]; }
+            ENABLE_IF(dimension >= 4)                 Number & t ()       { return values[3]; }
+            ENABLE_IF(dimension >= 4) constexpr const Number & t () const { return values[3]; }
 
         };
 
@@ -218,20 +208,20 @@
             Coordinates(const Coordinates & ) = default;
 
             template< typename... PARAMETERS >
-            Coordinates(const PARAMETERS &... parameters) : Base(parameters...)
+            constexpr Coordinates(const PARAMETERS &... parameters) : Base(parameters...)
             {
             }
 
         public:
 
-            ENABLE_IF(dimension >= 1)       Number & x ()       { return values[0]; }
-            ENABLE_IF(dimension >= 1) const Number & x () const { return values[0]; }
-            ENABLE_IF(dimension >= 2)       Number & y ()       { return values[1]; }
-            ENABLE_IF(dimension >= 2) const Number & y () const { return values[1]; }
-            ENABLE_IF(dimension >= 3)       Number & z ()       { return values[2]; }
-            ENABLE_IF(dimension >= 3) const Number & z () const { return values[2]; }
-            ENABLE_IF(dimension >= 1)       Number & w ()       { return values[dimension]; }
-            ENABLE_IF(dimension >= 1) const Number & w () const { return values[dimension]; }
+            ENABLE_IF(dimension >= 1)                 Number & x ()       { return values[0]; }
+            ENABLE_IF(dimension >= 1) constexpr const Number & x () const { return values[0]; }
+            ENABLE_IF(dimension >= 2)                 Number & y ()       { return values[1]; }
+            ENABLE_IF(dimension >= 2) constexpr const Number & y () const { return values[1]; }
+            ENABLE_IF(dimension >= 3)                 Number & z ()       { return values[2]; }
+            ENABLE_IF(dimension >= 3) constexpr const Number & z () const { return values[2]; }
+            ENABLE_IF(dimension >= 1)                 Number & w ()       { return values[dimension]; }
+            ENABLE_IF(dimension >= 1) constexpr const Number & w () const { return values[dimension]; }
 
         };
 
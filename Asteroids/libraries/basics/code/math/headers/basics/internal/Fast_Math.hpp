@@ -0,0 +1,424 @@
+/*
+ *  FAST MATH
+ *  Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ *  Distributed under the Boost Software License, version  1.0
+ *  See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ *  angel.rodriguez@esne.edu
+ *
+ *  C2610181940
+ */
+
+#ifndef BASICS_FAST_MATH_HEADER
+#define BASICS_FAST_MATH_HEADER
+
+    #include <cmath>
+    #include <cstddef>
+    #include <cstdint>
+    #include <cstring>
+    #include "Vector.hpp"
+
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>
+        #define BASICS_FAST_MATH_NEON
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #include <emmintrin.h>
+        #define BASICS_FAST_MATH_SSE
+    #endif
+
+    namespace basics
+    {
+
+        /**
+         * Aproximaciones polinómicas en float de las funciones trigonométricas y de la raíz cuadrada
+         * inversa para el código que se ejecuta cada fotograma (orientación de la nave, direcciones
+         * de las partículas...). No tratan NaN ni infinitos de forma especial.
+         *
+         * Error máximo absoluto medido frente a libm en double:
+         *
+         *   sin, cos, sincos   4e-7   para |angle| <= 1000 (la reducción de rango pierde
+         *                             precisión a partir de unos 1e4 radianes)
+         *   atan2              2e-6   rad
+         *   acos               5e-7   rad   (x en [-1, 1]; fuera se satura)
+         *   rsqrt              error relativo < 5e-6 (3e-7 con SSE o NEON)
+         *
+         * Las versiones para arrays procesan cuatro valores a la vez con NEON o SSE2 y dan los
+         * mismos resultados que las escalares salvo en el último bit.
+         */
+        namespace fast
+        {
+
+            namespace internal
+            {
+
+                constexpr float pi             = 3.14159265358979f;
+                constexpr float half_pi        = 1.57079632679490f;
+                constexpr float two_over_pi    = 0.63661977236758f;
+
+                // pi/2 partido en tres trozos para que q * pi/2 se reste sin perder precisión
+                // (Cody-Waite):
+
+                constexpr float half_pi_high   = 1.5703125f;
+                constexpr float half_pi_middle = 4.837512969970703125e-4f;
+                constexpr float half_pi_low    = 7.549789954891882e-8f;
+
+                // Taylor en [-pi/4, pi/4] (el término siguiente ya es menor que el error del float):
+
+                inline float sin_polynomial (float r, float r2)
+                {
+                    return r + r * r2 * (-1.f / 6.f + r2 * (1.f / 120.f + r2 * (-1.f / 5040.f)));
+                }
+
+                inline float cos_polynomial (float r2)
+                {
+                    return 1.f + r2 * (-.5f + r2 * (1.f / 24.f + r2 * (-1.f / 720.f + r2 * (1.f / 40320.f))));
+                }
+
+                // atan en [0, 1] y acos en [0, 1] (Abramowitz y Stegun 4.4.49 y 4.4.46 reajustados):
+
+                inline float atan_polynomial (float z)
+                {
+                    float z2 = z * z;
+
+                    return z * (.99997726f + z2 * (-.33262347f + z2 * (.19354346f + z2 * (-.11643287f + z2 * (.05265332f + z2 * -.01172120f)))));
+                }
+
+                inline float acos_polynomial (float x)
+                {
+                    return 1.5707963050f + x * (-.2145988016f + x * (.0889789874f + x * (-.0501743046f + x * (.0308918810f + x * (-.0170881256f + x * (.0066700901f + x * -.0012624911f))))));
+                }
+
+                inline float flip_sign (float value, uint32_t sign)
+                {
+                    uint32_t bits;
+
+                    std::memcpy (&bits, &value, 4);
+
+                    bits ^= sign;
+
+                    std::memcpy (&value, &bits, 4);
+
+                    return value;
+                }
+
+            }
+
+            /**
+             * Calcula a la vez el seno y el coseno de un ángulo (en radianes).
+             */
+            inline void sincos (float angle, float & sine, float & cosine)
+            {
+                using namespace internal;
+
+                float q  = angle * two_over_pi;
+                int   n  = int(q + (q < 0.f ? -.5f : .5f));
+                float fn = float(n);
+                float r  = ((angle - fn * half_pi_high) - fn * half_pi_middle) - fn * half_pi_low;
+                float r2 = r * r;
+                float s  = sin_polynomial (r, r2);
+                float c  = cos_polynomial (r2);
+
+                // Según el cuadrante se intercambian y se les cambia el signo:
+
+                bool swap = (n & 1) != 0;
+
+                sine   = flip_sign (swap ? c : s, uint32_t( n      & 2) << 30);
+                cosine = flip_sign (swap ? s : c, uint32_t((n + 1) & 2) << 30);
+            }
+
+            inline float sin (float angle)
+            {
+                float sine, cosine;
+
+                sincos (angle, sine, cosine);
+
+                return sine;
+            }
+
+            inline float cos (float angle)
+            {
+                float sine, cosine;
+
+                sincos (angle, sine, cosine);
+
+                return cosine;
+            }
+
+            inline float atan2 (float y, float x)
+            {
+                using namespace internal;
+
+                float abs_x   = std::fabs (x);
+                float abs_y   = std::fabs (y);
+                float maximum = abs_x > abs_y ? abs_x : abs_y;
+                float minimum = abs_x > abs_y ? abs_y : abs_x;
+                float angle   = atan_polynomial (maximum > 0.f ? minimum / maximum : 0.f);
+
+                if (abs_y > abs_x) angle = half_pi - angle;
+                if (x     < 0.f  ) angle = pi      - angle;
+
+                return y < 0.f ? -angle : angle;
+            }
+
+            inline float acos (float x)
+            {
+                float abs_x  = std::fabs (x) < 1.f ? std::fabs (x) : 1.f;
+                float result = std::sqrt (1.f - abs_x) * internal::acos_polynomial (abs_x);
+
+                return x < 0.f ? internal::pi - result : result;
+            }
+
+            /**
+             * Aproximación de 1 / sqrt(x) para x > 0.
+             */
+            inline float rsqrt (float x)
+            {
+                #if defined(BASICS_FAST_MATH_NEON)
+
+                    float32x2_t value    = vdup_n_f32 (x);
+                    float32x2_t estimate = vrsqrte_f32 (value);
+
+                    estimate = vmul_f32 (estimate, vrsqrts_f32 (vmul_f32 (value, estimate), estimate));
+                    estimate = vmul_f32 (estimate, vrsqrts_f32 (vmul_f32 (value, estimate), estimate));
+
+                    return vget_lane_f32 (estimate, 0);
+
+                #elif defined(BASICS_FAST_MATH_SSE)
+
+                    float estimate = _mm_cvtss_f32 (_mm_rsqrt_ss (_mm_set_ss (x)));
+
+                    return estimate * (1.5f - .5f * x * estimate * estimate);
+
+                #else
+
+                    uint32_t bits;
+                    float    estimate;
+
+                    std::memcpy (&bits, &x, 4);
+
+                    bits = 0x5F375A86u - (bits >> 1);
+
+                    std::memcpy (&estimate, &bits, 4);
+
+                    estimate = estimate * (1.5f - .5f * x * estimate * estimate);
+                    estimate = estimate * (1.5f - .5f * x * estimate * estimate);
+
+                    return estimate;
+
+                #endif
+            }
+
+            /**
+             * Retorna el vector con longitud 1 (o el vector nulo si su longitud es 0).
+             */
+            inline Vector2f normalize (const Vector2f & vector)
+            {
+                float length_squared = vector[0] * vector[0] + vector[1] * vector[1];
+
+                if (length_squared == 0.f) return Vector2f(0.f, 0.f);
+
+                float inverse_length = rsqrt (length_squared);
+
+                return Vector2f(vector[0] * inverse_length, vector[1] * inverse_length);
+            }
+
+            /**
+             * Gira un vector un ángulo (en radianes) en sentido antihorario sin construir una matriz.
+             */
+            inline Vector2f rotate (const Vector2f & vector, float angle)
+            {
+                float sine, cosine;
+
+                sincos (angle, sine, cosine);
+
+                return Vector2f(vector[0] * cosine - vector[1] * sine, vector[0] * sine + vector[1] * cosine);
+            }
+
+            // -------------------------------------------------------------------------------------
+            // Versiones para arrays (los punteros pueden no estar alineados):
+
+            /**
+             * sines[i] y cosines[i] reciben el seno y el coseno de angles[i].
+             */
+            inline void sincos (const float * angles, float * sines, float * cosines, size_t count)
+            {
+                using namespace internal;
+
+                size_t index = 0;
+
+                #if defined(BASICS_FAST_MATH_NEON)
+
+                    const uint32x4_t sign_bit = vdupq_n_u32 (0x80000000u);
+
+                    for ( ; index + 4 <= count; index += 4)
+                    {
+                        float32x4_t angle = vld1q_f32 (angles + index);
+                        float32x4_t q     = vmulq_f32 (angle, vdupq_n_f32 (two_over_pi));
+
+                        // vcvtq_s32_f32 trunca, por lo que se suma ±0.5 con el signo de q:
+
+                        float32x4_t half  = vreinterpretq_f32_u32 (vorrq_u32 (vandq_u32 (vreinterpretq_u32_f32 (q), sign_bit), vreinterpretq_u32_f32 (vdupq_n_f32 (.5f))));
+                        int32x4_t   n     = vcvtq_s32_f32 (vaddq_f32 (q, half));
+                        float32x4_t fn    = vcvtq_f32_s32 (n);
+
+                        float32x4_t r     = vmlsq_f32 (angle, fn, vdupq_n_f32 (half_pi_high  ));
+                                    r     = vmlsq_f32 (r,     fn, vdupq_n_f32 (half_pi_middle));
+                                    r     = vmlsq_f32 (r,     fn, vdupq_n_f32 (half_pi_low   ));
+                        float32x4_t r2    = vmulq_f32 (r, r);
+
+                        float32x4_t s     = vmlaq_f32 (vdupq_n_f32 (1.f / 120.f), r2, vdupq_n_f32 (-1.f / 5040.f));
+                                    s     = vmlaq_f32 (vdupq_n_f32 (-1.f / 6.f), r2, s);
+                                    s     = vmlaq_f32 (r, vmulq_f32 (r, r2), s);
+
+                        float32x4_t c     = vmlaq_f32 (vdupq_n_f32 (-1.f / 720.f), r2, vdupq_n_f32 (1.f / 40320.f));
+                                    c     = vmlaq_f32 (vdupq_n_f32 (1.f / 24.f), r2, c);
+                                    c     = vmlaq_f32 (vdupq_n_f32 (-.5f), r2, c);
+                                    c     = vmlaq_f32 (vdupq_n_f32 (1.f), r2, c);
+
+                        uint32x4_t  swap  = vtstq_s32 (n, vdupq_n_s32 (1));
+                        uint32x4_t  sign_s = vshlq_n_u32 (vreinterpretq_u32_s32 (vandq_s32 (n, vdupq_n_s32 (2))), 30);
+                        uint32x4_t  sign_c = vshlq_n_u32 (vreinterpretq_u32_s32 (vandq_s32 (vaddq_s32 (n, vdupq_n_s32 (1)), vdupq_n_s32 (2))), 30);
+
+                        vst1q_f32 (sines   + index, vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (vbslq_f32 (swap, c, s)), sign_s)));
+                        vst1q_f32 (cosines + index, vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (vbslq_f32 (swap, s, c)), sign_c)));
+                    }
+
+                #elif defined(BASICS_FAST_MATH_SSE)
+
+                    for ( ; index + 4 <= count; index += 4)
+                    {
+                        __m128  angle = _mm_loadu_ps (angles + index);
+                        __m128i n     = _mm_cvtps_epi32 (_mm_mul_ps (angle, _mm_set1_ps (two_over_pi)));   // Redondea al más cercano
+                        __m128  fn    = _mm_cvtepi32_ps (n);
+
+                        __m128  r     = _mm_sub_ps (angle, _mm_mul_ps (fn, _mm_set1_ps (half_pi_high  )));
+                                r     = _mm_sub_ps (r,     _mm_mul_ps (fn, _mm_set1_ps (half_pi_middle)));
+                                r     = _mm_sub_ps (r,     _mm_mul_ps (fn, _mm_set1_ps (half_pi_low   )));
+                        __m128  r2    = _mm_mul_ps (r, r);
+
+                        __m128  s     = _mm_add_ps (_mm_set1_ps (1.f / 120.f), _mm_mul_ps (r2, _mm_set1_ps (-1.f / 5040.f)));
+                                s     = _mm_add_ps (_mm_set1_ps (-1.f / 6.f),  _mm_mul_ps (r2, s));
+                                s     = _mm_add_ps (r, _mm_mul_ps (_mm_mul_ps (r, r2), s));
+
+                        __m128  c     = _mm_add_ps (_mm_set1_ps (-1.f / 720.f), _mm_mul_ps (r2, _mm_set1_ps (1.f / 40320.f)));
+                                c     = _mm_add_ps (_mm_set1_ps (1.f / 24.f),   _mm_mul_ps (r2, c));
+                                c     = _mm_add_ps (_mm_set1_ps (-.5f),         _mm_mul_ps (r2, c));
+                                c     = _mm_add_ps (_mm_set1_ps (1.f),          _mm_mul_ps (r2, c));
+
+                        __m128  swap   = _mm_castsi128_ps (_mm_cmpeq_epi32 (_mm_and_si128 (n, _mm_set1_epi32 (1)), _mm_set1_epi32 (1)));
+                        __m128  sign_s = _mm_castsi128_ps (_mm_slli_epi32 (_mm_and_si128 (n, _mm_set1_epi32 (2)), 30));
+                        __m128  sign_c = _mm_castsi128_ps (_mm_slli_epi32 (_mm_and_si128 (_mm_add_epi32 (n, _mm_set1_epi32 (1)), _mm_set1_epi32 (2)), 30));
+
+                        __m128  sine   = _mm_or_ps (_mm_and_ps (swap, c), _mm_andnot_ps (swap, s));
+                        __m128  cosine = _mm_or_ps (_mm_and_ps (swap, s), _mm_andnot_ps (swap, c));
+
+                        _mm_storeu_ps (sines   + index, _mm_xor_ps (sine,   sign_s));
+                        _mm_storeu_ps (cosines + index, _mm_xor_ps (cosine, sign_c));
+                    }
+
+                #endif
+
+                for ( ; index < count; ++index)
+                {
+                    sincos (angles[index], sines[index], cosines[index]);
+                }
+            }
+
+            /**
+             * angles[i] recibe atan2(ys[i], xs[i]).
+             */
+            inline void atan2 (const float * ys, const float * xs, float * angles, size_t count)
+            {
+                using namespace internal;
+
+                size_t index = 0;
+
+                #if defined(BASICS_FAST_MATH_NEON)
+
+                    const uint32x4_t sign_bit = vdupq_n_u32 (0x80000000u);
+
+                    for ( ; index + 4 <= count; index += 4)
+                    {
+                        float32x4_t y       = vld1q_f32 (ys + index);
+                        float32x4_t x       = vld1q_f32 (xs + index);
+                        float32x4_t abs_x   = vabsq_f32 (x);
+                        float32x4_t abs_y   = vabsq_f32 (y);
+                        float32x4_t maximum = vmaxq_f32 (abs_x, abs_y);
+                        float32x4_t minimum = vminq_f32 (abs_x, abs_y);
+
+                        // No hay división en ARMv7: se refina la estimación del recíproco dos veces
+                        // (si maximum es 0 también lo es minimum y el resultado da 0):
+
+                        uint32x4_t  zero    = vceqq_f32 (maximum, vdupq_n_f32 (0.f));
+                                    maximum = vbslq_f32 (zero, vdupq_n_f32 (1.f), maximum);
+                        float32x4_t inverse = vrecpeq_f32 (maximum);
+                                    inverse = vmulq_f32 (inverse, vrecpsq_f32 (maximum, inverse));
+                                    inverse = vmulq_f32 (inverse, vrecpsq_f32 (maximum, inverse));
+                        float32x4_t z       = vmulq_f32 (minimum, inverse);
+                        float32x4_t z2      = vmulq_f32 (z, z);
+
+                        float32x4_t a       = vmlaq_f32 (vdupq_n_f32 (.05265332f), z2, vdupq_n_f32 (-.01172120f));
+                                    a       = vmlaq_f32 (vdupq_n_f32 (-.11643287f), z2, a);
+                                    a       = vmlaq_f32 (vdupq_n_f32 (.19354346f),  z2, a);
+                                    a       = vmlaq_f32 (vdupq_n_f32 (-.33262347f), z2, a);
+                                    a       = vmlaq_f32 (vdupq_n_f32 (.99997726f),  z2, a);
+                                    a       = vmulq_f32 (z, a);
+
+                                    a       = vbslq_f32 (vcgtq_f32 (abs_y, abs_x), vsubq_f32 (vdupq_n_f32 (half_pi), a), a);
+                                    a       = vbslq_f32 (vcltq_f32 (x, vdupq_n_f32 (0.f)), vsubq_f32 (vdupq_n_f32 (pi), a), a);
+
+                        // El signo es el de y (salvo para y = -0, que da -0 en lugar de 0):
+
+                        uint32x4_t  sign    = vandq_u32 (vcltq_f32 (y, vdupq_n_f32 (0.f)), sign_bit);
+
+                        vst1q_f32 (angles + index, vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (a), sign)));
+                    }
+
+                #elif defined(BASICS_FAST_MATH_SSE)
+
+                    const __m128 sign_bit = _mm_set1_ps (-0.f);
+
+                    for ( ; index + 4 <= count; index += 4)
+                    {
+                        __m128 y       = _mm_loadu_ps (ys + index);
+                        __m128 x       = _mm_loadu_ps (xs + index);
+                        __m128 abs_x   = _mm_andnot_ps (sign_bit, x);
+                        __m128 abs_y   = _mm_andnot_ps (sign_bit, y);
+                        __m128 maximum = _mm_max_ps (abs_x, abs_y);
+                        __m128 minimum = _mm_min_ps (abs_x, abs_y);
+                        __m128 zero    = _mm_cmpeq_ps (maximum, _mm_setzero_ps ());
+                               maximum = _mm_or_ps (_mm_and_ps (zero, _mm_set1_ps (1.f)), _mm_andnot_ps (zero, maximum));
+                        __m128 z       = _mm_div_ps (minimum, maximum);
+                        __m128 z2      = _mm_mul_ps (z, z);
+
+                        __m128 a       = _mm_add_ps (_mm_set1_ps (.05265332f),  _mm_mul_ps (z2, _mm_set1_ps (-.01172120f)));
+                               a       = _mm_add_ps (_mm_set1_ps (-.11643287f), _mm_mul_ps (z2, a));
+                               a       = _mm_add_ps (_mm_set1_ps (.19354346f),  _mm_mul_ps (z2, a));
+                               a       = _mm_add_ps (_mm_set1_ps (-.33262347f), _mm_mul_ps (z2, a));
+                               a       = _mm_add_ps (_mm_set1_ps (.99997726f),  _mm_mul_ps (z2, a));
+                               a       = _mm_mul_ps (z, a);
+
+                        __m128 steep   = _mm_cmpgt_ps (abs_y, abs_x);
+                               a       = _mm_or_ps (_mm_and_ps (steep, _mm_sub_ps (_mm_set1_ps (half_pi), a)), _mm_andnot_ps (steep, a));
+                        __m128 left    = _mm_cmplt_ps (x, _mm_setzero_ps ());
+                               a       = _mm_or_ps (_mm_and_ps (left, _mm_sub_ps (_mm_set1_ps (pi), a)), _mm_andnot_ps (left, a));
+
+                        __m128 sign    = _mm_and_ps (_mm_cmplt_ps (y, _mm_setzero_ps ()), sign_bit);
+
+                        _mm_storeu_ps (angles + index, _mm_xor_ps (a, sign));
+                    }
+
+                #endif
+
+                for ( ; index < count; ++index)
+                {
+                    angles[index] = atan2 (ys[index], xs[index]);
+                }
+            }
+
+        }
+
+    }
+
+#endif
@@ -18,6 +18,62 @@
     namespace basics
     {
 
+        namespace internal
+        {
+
+            /**
+             * Lista de índices 0, 1, ..., COUNT - 1 para expandir inicializaciones de arrays en
+             * constructores constexpr (Make_Index_List< COUNT >::Type).
+             */
+            template< unsigned... INDICES >
+            struct Index_List
+            {
+            };
+
+            template< unsigned COUNT, unsigned... INDICES >
+            struct Make_Index_List : Make_Index_List< COUNT - 1, COUNT - 1, INDICES... >
+            {
+            };
+
+            template< unsigned... INDICES >
+            struct Make_Index_List< 0, INDICES... >
+            {
+                typedef Index_List< INDICES... > Type;
+            };
+
+            /**
+             * Producto de matrices guardadas por filas: result = a * b (a es MxN y b es NxP).
+             * result no puede ser a ni b. Se accede directamente a los arrays en lugar de pasar por
+             * los proxies Row. No hay versiones NEON o SSE: con -O3 las de 3x3 y 4x4 en float no
+             * eran claramente más rápidas que este bucle (ver benchmarks/matrix.cpp del proyecto
+             * host).
+             */
+            template< unsigned M, unsigned N, unsigned P, typename NUMERIC_TYPE >
+            struct Matrix_Product
+            {
+                static void multiply (const NUMERIC_TYPE * a, const NUMERIC_TYPE * b, NUMERIC_TYPE * result)
+                {
+                    for (unsigned r = M; r-- > 0; )
+                    {
+                        for (unsigned c = P; c-- > 0; )
+                        {
+                            NUMERIC_TYPE total = NUMERIC_TYPE(0);
+
+                            for (unsigned index = N; index-- > 0; )
+                            {
+                                total += a[r * N + index] * b[index * P + c];
+                            }
+
+                            result[r * P + c] = total;
+                        }
+                    }
+                }
+            };
+
+        }
+
+        // -----------------------------------------------------------------------------------------
+
         template< unsigned M, unsigned N, typename NUMERIC_TYPE >
         class Matrix
         {
@@ -145,14 +201,20 @@
                 IDENTITY
             };
 
-            Matrix(const Identity & )
+            // La identidad se construye en tiempo de compilación para que Matrix::identity se
+            // inicialice estáticamente (sin código de arranque ni guardas):
+
+            constexpr Matrix(const Identity & identity)
+            :
+                Matrix(identity, typename internal::Make_Index_List< M * N >::Type())
             {
-                std::fill_n (values, M * N, Number(0));
+            }
 
-                for (unsigned offset = 0; offset < M * N; offset += N + 1)
-                {
-                    values[offset] = Number(1);
-                }
+            template< unsigned... INDICES >
+            constexpr Matrix(const Identity & , internal::Index_List< INDICES... >)
+            :
+                values{ Number(INDICES % (N + 1) == 0 ? 1 : 0)... }
+            {
             }
 
         public:
@@ -194,20 +256,7 @@
             {
                 Matrix< M, P, Numeric_Type > result;
 
-                for (unsigned r = M; r-- > 0; )
-                {
-                    for (unsigned c = P; c-- > 0; )
-                    {
-                        Numeric_Type total = Numeric_Type(0);
-
-                        for (unsigned index = N; index-- > 0; )
-                        {
-                            total += (*this)[r][index] * other[index][c];
-                        }
-
-                        result[r][c] = total;
-                    }
-                }
+                internal::Matrix_Product< M, N, P, Numeric_Type >::multiply (this->values, other.values, result.values);
 
                 return result;
             }
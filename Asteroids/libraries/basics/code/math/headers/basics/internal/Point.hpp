@@ -26,7 +26,7 @@
             typedef NUMERIC_TYPE Numeric_Type;
             typedef Numeric_Type Number;
 
-            typedef Coordinates< DIMENSION, NUMERIC_TYPE, COORDINATE_SYSTEM > Coordinates;
+            typedef basics::Coordinates< DIMENSION, NUMERIC_TYPE, COORDINATE_SYSTEM > Coordinates;
 
         public:
 
@@ -38,7 +38,7 @@
             Point(const Point & other) = default;
 
             template< typename... PARAMETERS >
-            Point(const PARAMETERS &... parameters) : coordinates(parameters...)
+            constexpr Point(const PARAMETERS &... parameters) : coordinates(parameters...)
             {
             }
 
@@ -49,7 +49,7 @@
                 return coordinates[index];
             }
 
-            const Number & operator [] (const unsigned index) const
+            constexpr const Number & operator [] (const unsigned index) const
             {
                 return coordinates[index];
             }
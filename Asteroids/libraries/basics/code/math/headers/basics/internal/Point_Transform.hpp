@@ -0,0 +1,66 @@
+/*
+ *  POINT TRANSFORM
+ *  Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ *  Distributed under the Boost Software License, version  1.0
+ *  See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ *  angel.rodriguez@esne.edu
+ *
+ *  C2610181960
+ */
+
+#ifndef BASICS_POINT_TRANSFORM_HEADER
+#define BASICS_POINT_TRANSFORM_HEADER
+
+    #include <cstddef>
+    #include "Point.hpp"
+
+    namespace basics
+    {
+
+        namespace internal
+        {
+
+            static_assert(sizeof(Point2f) == 2 * sizeof(float), "Point2f must be two packed floats.");
+
+            /**
+             * Transformación de puntos con una matriz afín m de 2x3 guardada por filas (ver
+             * Affine2f). Los bucles son escalares a propósito: el compilador los vectoriza, y unos
+             * núcleos NEON/SSE escritos a mano no resultaron más rápidos con -O3. Si el compilador
+             * usa FMA, el resultado puede diferir en el último bit del de Affine2f::transform
+             * (Point2f). La salida puede ser la misma que la entrada.
+             */
+            inline void transform_point (const float * m, float x, float y, float & out_x, float & out_y)
+            {
+                out_x = m[0] * x + m[1] * y + m[2];
+                out_y = m[3] * x + m[4] * y + m[5];
+            }
+
+            /**
+             * Puntos intercalados (x0, y0, x1, y1...), como en un array de Point2f.
+             */
+            inline void transform_points (const float * m, const float * input, float * output, size_t count)
+            {
+                for (size_t index = 0; index < count; ++index)
+                {
+                    transform_point (m, input[index * 2], input[index * 2 + 1], output[index * 2], output[index * 2 + 1]);
+                }
+            }
+
+            /**
+             * Coordenadas en arrays separados (xs e ys).
+             */
+            inline void transform_points (const float * m, const float * xs, const float * ys, float * out_xs, float * out_ys, size_t count)
+            {
+                for (size_t index = 0; index < count; ++index)
+                {
+                    transform_point (m, xs[index], ys[index], out_xs[index], out_ys[index]);
+                }
+            }
+
+        }
+
+    }
+
+#endif
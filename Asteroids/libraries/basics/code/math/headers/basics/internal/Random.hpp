@@ -0,0 +1,439 @@
+/*
+ *  RANDOM
+ *  Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ *  Distributed under the Boost Software License, version  1.0
+ *  See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ *  angel.rodriguez@esne.edu
+ *
+ *  C2610181970
+ */
+
+#ifndef BASICS_RANDOM_HEADER
+#define BASICS_RANDOM_HEADER
+
+    #include <algorithm>
+    #include <cstddef>
+    #include <cstdint>
+    #include "Fast_Math.hpp"
+    #include "Vector.hpp"
+
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>
+        #define BASICS_RANDOM_NEON
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #include <emmintrin.h>
+        #define BASICS_RANDOM_SSE
+    #endif
+
+    namespace basics
+    {
+
+        /**
+         * Generador de números pseudoaleatorios xoshiro128** (Blackman y Vigna). Su estado son 16
+         * bytes, no usa memoria compartida ni bloqueos (cada hilo o escena debe tener el suyo) y
+         * da la misma secuencia en todas las plataformas, por lo que sirve para las partidas que se
+         * graban y reproducen. Cumple los requisitos de UniformRandomBitGenerator, así que también
+         * se puede usar con las distribuciones de <random>.
+         */
+        class Random
+        {
+        public:
+
+            typedef uint32_t result_type;
+
+            static constexpr result_type min () { return 0;          }
+            static constexpr result_type max () { return 0xFFFFFFFF; }
+
+        private:
+
+            uint32_t state[4];
+
+        public:
+
+            explicit Random(uint64_t seed = 0x9E3779B97F4A7C15ull)
+            {
+                this->seed (seed);
+            }
+
+            /**
+             * Reinicia el estado a partir de una semilla cualquiera (se expande con splitmix64 para
+             * que semillas parecidas den secuencias independientes).
+             */
+            void seed (uint64_t seed)
+            {
+                for (unsigned index = 0; index < 4; index += 2)
+                {
+                    uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+
+                    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                    z =  z ^ (z >> 31);
+
+                    state[index    ] = uint32_t(z      );
+                    state[index + 1] = uint32_t(z >> 32);
+                }
+            }
+
+            /**
+             * Avanza el estado 2^64 pasos. Sirve para sacar de un mismo generador varias
+             * secuencias que no se solapan (por ejemplo, una por hilo).
+             */
+            void jump ()
+            {
+                static const uint32_t jump_polynomial[4] = { 0x8764000B, 0xF542D2D3, 0x6FA035C3, 0x77F2DB5B };
+
+                uint32_t jumped[4] = { 0, 0, 0, 0 };
+
+                for (uint32_t word : jump_polynomial)
+                {
+                    for (unsigned bit = 0; bit < 32; ++bit)
+                    {
+                        if (word & (uint32_t(1) << bit))
+                        {
+                            for (unsigned index = 0; index < 4; ++index) jumped[index] ^= state[index];
+                        }
+
+                        next ();
+                    }
+                }
+
+                std::copy_n (jumped, 4, state);
+            }
+
+            const uint32_t * get_state () const
+            {
+                return state;
+            }
+
+        public:
+
+            uint32_t next ()
+            {
+                uint32_t result = rotate (state[1] * 5, 7) * 9;
+                uint32_t t      = state[1] << 9;
+
+                state[2] ^= state[0];
+                state[3] ^= state[1];
+                state[1] ^= state[2];
+                state[0] ^= state[3];
+                state[2] ^= t;
+                state[3]  = rotate (state[3], 11);
+
+                return result;
+            }
+
+            result_type operator () ()
+            {
+                return next ();
+            }
+
+            /**
+             * Entero uniforme en [0, bound) sin sesgo (método de Lemire: una multiplicación y, muy
+             * de vez en cuando, un nuevo intento). bound debe ser mayor que 0.
+             */
+            uint32_t below (uint32_t bound)
+            {
+                uint64_t product = uint64_t(next ()) * bound;
+                uint32_t low     = uint32_t(product);
+
+                if (low < bound)
+                {
+                    uint32_t threshold = (0u - bound) % bound;
+
+                    while (low < threshold)
+                    {
+                        product = uint64_t(next ()) * bound;
+                        low     = uint32_t(product);
+                    }
+                }
+
+                return uint32_t(product >> 32);
+            }
+
+            /**
+             * Entero uniforme en [min, max] (ambos incluidos).
+             */
+            int32_t between (int32_t min, int32_t max)
+            {
+                uint32_t range = uint32_t(max) - uint32_t(min) + 1;
+
+                return int32_t(uint32_t(min) + (range == 0 ? next () : below (range)));
+            }
+
+            /**
+             * Float uniforme en [0, 1) con 24 bits aleatorios.
+             */
+            float unit ()
+            {
+                return float(next () >> 8) * (1.f / 16777216.f);
+            }
+
+            /**
+             * Float uniforme en [min, max).
+             */
+            float between (float min, float max)
+            {
+                return min + (max - min) * unit ();
+            }
+
+            bool chance (float probability)
+            {
+                return unit () < probability;
+            }
+
+            /**
+             * Vector de longitud 1 con dirección uniforme.
+             */
+            Vector2f unit_vector ()
+            {
+                float sine, cosine;
+
+                fast::sincos (unit () * 6.28318530717959f, sine, cosine);
+
+                return Vector2f{ cosine, sine };
+            }
+
+        private:
+
+            static uint32_t rotate (uint32_t value, unsigned bits)
+            {
+                return (value << bits) | (value >> (32 - bits));
+            }
+
+        };
+
+        // -----------------------------------------------------------------------------------------
+
+        /**
+         * Cuatro generadores xoshiro128** que avanzan a la vez con NEON o SSE2 para llenar arrays
+         * grandes (por ejemplo, al crear miles de partículas o entidades). Las cuatro secuencias
+         * salen de un mismo Random separadas con Random::jump(), por lo que no se solapan. Los
+         * valores se reparten entre los cuatro generadores en orden (el primero da los índices
+         * 0, 4, 8..., el segundo 1, 5, 9...).
+         */
+        class Random_Batch
+        {
+        public:
+
+            static constexpr unsigned lane_count = 4;
+
+        private:
+
+            uint32_t state[4][lane_count];                      ///< state[i][lane] es la palabra i del generador lane.
+
+        public:
+
+            explicit Random_Batch(uint64_t seed = 0x9E3779B97F4A7C15ull) : Random_Batch(Random(seed))
+            {
+            }
+
+            explicit Random_Batch(Random generator)
+            {
+                for (unsigned lane = 0; lane < lane_count; ++lane, generator.jump ())
+                {
+                    for (unsigned index = 0; index < 4; ++index)
+                    {
+                        state[index][lane] = generator.get_state ()[index];
+                    }
+                }
+            }
+
+        public:
+
+            /**
+             * Llena output con count enteros de 32 bits.
+             */
+            void fill (uint32_t * output, size_t count)
+            {
+                size_t index = 0;
+
+                #if defined(BASICS_RANDOM_NEON)
+
+                    uint32x4_t s0 = vld1q_u32 (state[0]), s1 = vld1q_u32 (state[1]);
+                    uint32x4_t s2 = vld1q_u32 (state[2]), s3 = vld1q_u32 (state[3]);
+
+                    for ( ; index + 4 <= count; index += 4)
+                    {
+                        vst1q_u32 (output + index, step (s0, s1, s2, s3));
+                    }
+
+                    vst1q_u32 (state[0], s0); vst1q_u32 (state[1], s1);
+                    vst1q_u32 (state[2], s2); vst1q_u32 (state[3], s3);
+
+                #elif defined(BASICS_RANDOM_SSE)
+
+                    __m128i s0 = load (state[0]), s1 = load (state[1]);
+                    __m128i s2 = load (state[2]), s3 = load (state[3]);
+
+                    for ( ; index + 4 <= count; index += 4)
+                    {
+                        store (output + index, step (s0, s1, s2, s3));
+                    }
+
+                    store (state[0], s0); store (state[1], s1);
+                    store (state[2], s2); store (state[3], s3);
+
+                #endif
+
+                generate (output + index, count - index, [] (const uint32_t * block, uint32_t * values, size_t block_count)
+                {
+                    std::copy_n (block, block_count, values);
+                });
+            }
+
+            /**
+             * Llena output con count floats uniformes en [min, max).
+             */
+            void fill (float * output, size_t count, float min, float max)
+            {
+                const float step_size = (max - min) * (1.f / 16777216.f);
+
+                size_t index = 0;
+
+                #if defined(BASICS_RANDOM_NEON)
+
+                    uint32x4_t s0 = vld1q_u32 (state[0]), s1 = vld1q_u32 (state[1]);
+                    uint32x4_t s2 = vld1q_u32 (state[2]), s3 = vld1q_u32 (state[3]);
+
+                    float32x4_t scale  = vdupq_n_f32 (step_size);
+                    float32x4_t offset = vdupq_n_f32 (min);
+
+                    for ( ; index + 4 <= count; index += 4)
+                    {
+                        uint32x4_t bits = step (s0, s1, s2, s3);
+
+                        vst1q_f32 (output + index, vmlaq_f32 (offset, vcvtq_f32_u32 (vshrq_n_u32 (bits, 8)), scale));
+                    }
+
+                    vst1q_u32 (state[0], s0); vst1q_u32 (state[1], s1);
+                    vst1q_u32 (state[2], s2); vst1q_u32 (state[3], s3);
+
+                #elif defined(BASICS_RANDOM_SSE)
+
+                    __m128i s0 = load (state[0]), s1 = load (state[1]);
+                    __m128i s2 = load (state[2]), s3 = load (state[3]);
+
+                    __m128 scale  = _mm_set1_ps (step_size);
+                    __m128 offset = _mm_set1_ps (min);
+
+                    for ( ; index + 4 <= count; index += 4)
+                    {
+                        __m128i bits = step (s0, s1, s2, s3);
+
+                        _mm_storeu_ps (output + index, _mm_add_ps (offset, _mm_mul_ps (_mm_cvtepi32_ps (_mm_srli_epi32 (bits, 8)), scale)));
+                    }
+
+                    store (state[0], s0); store (state[1], s1);
+                    store (state[2], s2); store (state[3], s3);
+
+                #endif
+
+                generate (output + index, count - index, [min, step_size] (const uint32_t * block, float * values, size_t block_count)
+                {
+                    for (size_t lane = 0; lane < block_count; ++lane)
+                    {
+                        values[lane] = min + float(block[lane] >> 8) * step_size;
+                    }
+                });
+            }
+
+            /**
+             * Llena xs e ys con count vectores unitarios de dirección uniforme.
+             */
+            void fill_unit_vectors (float * xs, float * ys, size_t count)
+            {
+                fill (xs, count, 0.f, 6.28318530717959f);
+
+                fast::sincos (xs, ys, xs, count);
+            }
+
+        private:
+
+            /**
+             * Genera los valores de cuatro en cuatro con el código escalar y los pasa a convert.
+             */
+            template< typename TYPE, typename CONVERT >
+            void generate (TYPE * output, size_t count, CONVERT convert)
+            {
+                uint32_t block[lane_count];
+
+                for (size_t index = 0; index < count; index += lane_count)
+                {
+                    for (unsigned lane = 0; lane < lane_count; ++lane)
+                    {
+                        uint32_t & s0 = state[0][lane], & s1 = state[1][lane];
+                        uint32_t & s2 = state[2][lane], & s3 = state[3][lane];
+
+                        uint32_t a = s1 * 5;
+                        uint32_t t = s1 << 9;
+
+                        block[lane] = ((a << 7) | (a >> 25)) * 9;
+
+                        s2 ^= s0; s3 ^= s1; s1 ^= s2; s0 ^= s3; s2 ^= t;
+                        s3  = (s3 << 11) | (s3 >> 21);
+                    }
+
+                    convert (block, output + index, std::min< size_t > (lane_count, count - index));
+                }
+            }
+
+            #if defined(BASICS_RANDOM_NEON)
+
+                static uint32x4_t step (uint32x4_t & s0, uint32x4_t & s1, uint32x4_t & s2, uint32x4_t & s3)
+                {
+                    uint32x4_t a      = vaddq_u32 (s1, vshlq_n_u32 (s1, 2));
+                    uint32x4_t r      = vsriq_n_u32 (vshlq_n_u32 (a, 7), a, 25);
+                    uint32x4_t result = vaddq_u32 (r, vshlq_n_u32 (r, 3));
+                    uint32x4_t t      = vshlq_n_u32 (s1, 9);
+
+                    s2 = veorq_u32 (s2, s0);
+                    s3 = veorq_u32 (s3, s1);
+                    s1 = veorq_u32 (s1, s2);
+                    s0 = veorq_u32 (s0, s3);
+                    s2 = veorq_u32 (s2, t );
+                    s3 = vsriq_n_u32 (vshlq_n_u32 (s3, 11), s3, 21);
+
+                    return result;
+                }
+
+            #elif defined(BASICS_RANDOM_SSE)
+
+                static __m128i load (const uint32_t * values)
+                {
+                    return _mm_loadu_si128 (reinterpret_cast< const __m128i * >(values));
+                }
+
+                static void store (uint32_t * values, __m128i vector)
+                {
+                    _mm_storeu_si128 (reinterpret_cast< __m128i * >(values), vector);
+                }
+
+                // SSE2 no tiene multiplicación de enteros de 32 bits: x * 5 y x * 9 se hacen con
+                // desplazamientos y sumas.
+
+                static __m128i step (__m128i & s0, __m128i & s1, __m128i & s2, __m128i & s3)
+                {
+                    __m128i a      = _mm_add_epi32 (s1, _mm_slli_epi32 (s1, 2));
+                    __m128i r      = _mm_or_si128  (_mm_slli_epi32 (a, 7), _mm_srli_epi32 (a, 25));
+                    __m128i result = _mm_add_epi32 (r, _mm_slli_epi32 (r, 3));
+                    __m128i t      = _mm_slli_epi32 (s1, 9);
+
+                    s2 = _mm_xor_si128 (s2, s0);
+                    s3 = _mm_xor_si128 (s3, s1);
+                    s1 = _mm_xor_si128 (s1, s2);
+                    s0 = _mm_xor_si128 (s0, s3);
+                    s2 = _mm_xor_si128 (s2, t );
+                    s3 = _mm_or_si128  (_mm_slli_epi32 (s3, 11), _mm_srli_epi32 (s3, 21));
+
+                    return result;
+                }
+
+            #endif
+
+        };
+
+    }
+
+#endif
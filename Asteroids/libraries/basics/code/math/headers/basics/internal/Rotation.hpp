@@ -55,9 +55,14 @@
 
             void set (const Numeric_Type & angle)
             {
-                Numeric_Type sin = Numeric_Type(std::sin (angle));
-                Numeric_Type cos = Numeric_Type(std::cos (angle));
+                set (Numeric_Type(std::sin (angle)), Numeric_Type(std::cos (angle)));
+            }
 
+            /**
+             * Permite reutilizar un seno y un coseno ya calculados (por ejemplo, con fast::sincos()).
+             */
+            void set (const Numeric_Type & sin, const Numeric_Type & cos)
+            {
                 matrix[0][0] = cos; matrix[0][1] = -sin;
                 matrix[1][0] = sin; matrix[1][1] =  cos;
             }
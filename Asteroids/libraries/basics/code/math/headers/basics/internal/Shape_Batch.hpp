@@ -0,0 +1,601 @@
+/*
+ *  SHAPE BATCH
+ *  Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ *  Distributed under the Boost Software License, version  1.0
+ *  See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ *  angel.rodriguez@esne.edu
+ *
+ *  C2610181931
+ */
+
+#ifndef BASICS_SHAPE_BATCH_HEADER
+#define BASICS_SHAPE_BATCH_HEADER
+
+    #include <cstdint>
+    #include <vector>
+    #include "Shapes.hpp"
+
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>
+        #define BASICS_SHAPE_BATCH_NEON
+    #elif defined(__SSE__) || defined(_M_X64) || defined(_M_IX86_FP)
+        #include <xmmintrin.h>
+        #define BASICS_SHAPE_BATCH_SSE
+    #endif
+
+    namespace basics
+    {
+
+        namespace shapes_internal
+        {
+
+            /**
+             * Cuatro floats que se procesan a la vez con NEON, con SSE o, si no hay ninguno de los
+             * dos, con un bucle escalar. Los kernels de los lotes se escriben una sola vez sobre
+             * este tipo.
+             */
+            struct Float4
+            {
+                #if defined(BASICS_SHAPE_BATCH_NEON)
+
+                    float32x4_t value;
+
+                    static Float4 load  (const float * data) { return { vld1q_f32   (data ) }; }
+                    static Float4 splat (float number      ) { return { vdupq_n_f32 (number) }; }
+
+                    friend Float4 operator + (Float4 a, Float4 b) { return { vaddq_f32 (a.value, b.value) }; }
+                    friend Float4 operator - (Float4 a, Float4 b) { return { vsubq_f32 (a.value, b.value) }; }
+                    friend Float4 operator * (Float4 a, Float4 b) { return { vmulq_f32 (a.value, b.value) }; }
+
+                    friend Float4 min (Float4 a, Float4 b) { return { vminq_f32 (a.value, b.value) }; }
+                    friend Float4 max (Float4 a, Float4 b) { return { vmaxq_f32 (a.value, b.value) }; }
+                    friend Float4 abs (Float4 a)           { return { vabsq_f32 (a.value) }; }
+
+                    /**
+                     * Bit i del resultado a 1 si a[i] <= b[i].
+                     */
+                    friend unsigned less_equal (Float4 a, Float4 b)
+                    {
+                        static const uint32_t weights[4] = { 1, 2, 4, 8 };
+
+                        uint32x4_t bits = vandq_u32 (vcleq_f32 (a.value, b.value), vld1q_u32 (weights));
+                        uint32x2_t sum  = vpadd_u32 (vget_low_u32 (bits), vget_high_u32 (bits));
+
+                        return vget_lane_u32 (vpadd_u32 (sum, sum), 0);
+                    }
+
+                #elif defined(BASICS_SHAPE_BATCH_SSE)
+
+                    __m128 value;
+
+                    static Float4 load  (const float * data) { return { _mm_loadu_ps (data  ) }; }
+                    static Float4 splat (float number      ) { return { _mm_set1_ps  (number) }; }
+
+                    friend Float4 operator + (Float4 a, Float4 b) { return { _mm_add_ps (a.value, b.value) }; }
+                    friend Float4 operator - (Float4 a, Float4 b) { return { _mm_sub_ps (a.value, b.value) }; }
+                    friend Float4 operator * (Float4 a, Float4 b) { return { _mm_mul_ps (a.value, b.value) }; }
+
+                    friend Float4 min (Float4 a, Float4 b) { return { _mm_min_ps (a.value, b.value) }; }
+                    friend Float4 max (Float4 a, Float4 b) { return { _mm_max_ps (a.value, b.value) }; }
+                    friend Float4 abs (Float4 a)           { return { _mm_andnot_ps (_mm_set1_ps (-0.f), a.value) }; }
+
+                    friend unsigned less_equal (Float4 a, Float4 b)
+                    {
+                        return unsigned(_mm_movemask_ps (_mm_cmple_ps (a.value, b.value)));
+                    }
+
+                #else
+
+                    float value[4];
+
+                    static Float4 load  (const float * data) { return { { data[0], data[1], data[2], data[3] } }; }
+                    static Float4 splat (float number      ) { return { { number,  number,  number,  number  } }; }
+
+                    template< typename OPERATION >
+                    static Float4 apply (Float4 a, Float4 b, OPERATION operation)
+                    {
+                        return { { operation (a.value[0], b.value[0]), operation (a.value[1], b.value[1]), operation (a.value[2], b.value[2]), operation (a.value[3], b.value[3]) } };
+                    }
+
+                    friend Float4 operator + (Float4 a, Float4 b) { return apply (a, b, [] (float x, float y) { return x + y; }); }
+                    friend Float4 operator - (Float4 a, Float4 b) { return apply (a, b, [] (float x, float y) { return x - y; }); }
+                    friend Float4 operator * (Float4 a, Float4 b) { return apply (a, b, [] (float x, float y) { return x * y; }); }
+
+                    friend Float4 min (Float4 a, Float4 b) { return apply (a, b, [] (float x, float y) { return std::min (x, y); }); }
+                    friend Float4 max (Float4 a, Float4 b) { return apply (a, b, [] (float x, float y) { return std::max (x, y); }); }
+                    friend Float4 abs (Float4 a)           { return apply (a, a, [] (float x, float  ) { return std::fabs (x); }); }
+
+                    friend unsigned less_equal (Float4 a, Float4 b)
+                    {
+                        return (a.value[0] <= b.value[0] ? 1u : 0u) | (a.value[1] <= b.value[1] ? 2u : 0u)
+                             | (a.value[2] <= b.value[2] ? 4u : 0u) | (a.value[3] <= b.value[3] ? 8u : 0u);
+                    }
+
+                #endif
+
+                friend Float4 clamp (Float4 a, Float4 low, Float4 high)
+                {
+                    return min (max (a, low), high);
+                }
+            };
+
+            /**
+             * Valor con el que se rellenan los huecos del final de los lotes. Está tan lejos que
+             * nunca se toca con nada, pero al elevarlo al cuadrado da infinito y no NaN.
+             */
+            static constexpr float far_away = 1e30f;
+
+            /**
+             * Añade a output los índices (desplazados first) de los bits a 1 de hits que son menores
+             * que count.
+             */
+            inline size_t append_hits (unsigned hits, size_t first, size_t count, std::vector< uint32_t > & output)
+            {
+                size_t appended = 0;
+
+                for (unsigned lane = 0; hits != 0; ++lane, hits >>= 1)
+                {
+                    if ((hits & 1) && first + lane < count)
+                    {
+                        output.push_back (uint32_t(first + lane));
+                        appended++;
+                    }
+                }
+
+                return appended;
+            }
+
+            /**
+             * Longitud de los arrays de un lote de count formas (múltiplo de 4).
+             */
+            inline size_t padded (size_t count)
+            {
+                return (count + 3) & ~size_t(3);
+            }
+
+        }
+
+        /**
+         * Lote de círculos en forma de estructura de arrays para probarlos de cuatro en cuatro con
+         * una misma forma (ver los métodos query()).
+         * Como el resto de lotes, los arrays tienen una longitud múltiplo de 4 rellenada con formas
+         * muy alejadas que nunca colisionan, de modo que los kernels no tratan el final aparte.
+         */
+        class Circle_Batch
+        {
+        public:
+
+            std::vector< float > xs;
+            std::vector< float > ys;
+            std::vector< float > radii;
+
+        private:
+
+            size_t count = 0;
+
+        public:
+
+            size_t size  () const { return count;      }
+            bool   empty () const { return count == 0; }
+
+            void clear ()
+            {
+                xs.clear (); ys.clear (); radii.clear ();
+                count = 0;
+            }
+
+            void reserve (size_t capacity)
+            {
+                size_t length = shapes_internal::padded (capacity);
+
+                xs.reserve (length); ys.reserve (length); radii.reserve (length);
+            }
+
+            void push_back (const Circle2f & circle)
+            {
+                xs   .resize (count); xs   .push_back (circle.center[0]);
+                ys   .resize (count); ys   .push_back (circle.center[1]);
+                radii.resize (count); radii.push_back (circle.radius   );
+
+                size_t length = shapes_internal::padded (++count);
+
+                xs   .resize (length, shapes_internal::far_away);
+                ys   .resize (length, shapes_internal::far_away);
+                radii.resize (length, 0.f);
+            }
+
+            Circle2f operator [] (size_t index) const
+            {
+                return Circle2f({ xs[index], ys[index] }, radii[index]);
+            }
+
+        };
+
+        /**
+         * Lote de rectángulos alineados con los ejes (ver Circle_Batch).
+         */
+        class Aabb_Batch
+        {
+        public:
+
+            std::vector< float > min_xs;
+            std::vector< float > min_ys;
+            std::vector< float > max_xs;
+            std::vector< float > max_ys;
+
+        private:
+
+            size_t count = 0;
+
+        public:
+
+            size_t size  () const { return count;      }
+            bool   empty () const { return count == 0; }
+
+            void clear ()
+            {
+                min_xs.clear (); min_ys.clear (); max_xs.clear (); max_ys.clear ();
+                count = 0;
+            }
+
+            void reserve (size_t capacity)
+            {
+                size_t length = shapes_internal::padded (capacity);
+
+                min_xs.reserve (length); min_ys.reserve (length); max_xs.reserve (length); max_ys.reserve (length);
+            }
+
+            void push_back (const Aabb2f & aabb)
+            {
+                min_xs.resize (count); min_xs.push_back (aabb.min[0]);
+                min_ys.resize (count); min_ys.push_back (aabb.min[1]);
+                max_xs.resize (count); max_xs.push_back (aabb.max[0]);
+                max_ys.resize (count); max_ys.push_back (aabb.max[1]);
+
+                size_t length = shapes_internal::padded (++count);
+
+                min_xs.resize (length, shapes_internal::far_away);
+                min_ys.resize (length, shapes_internal::far_away);
+                max_xs.resize (length, shapes_internal::far_away);
+                max_ys.resize (length, shapes_internal::far_away);
+            }
+
+            Aabb2f operator [] (size_t index) const
+            {
+                return Aabb2f({ min_xs[index], min_ys[index] }, { max_xs[index], max_ys[index] });
+            }
+
+        };
+
+        /**
+         * Lote de rectángulos orientados (ver Circle_Batch).
+         */
+        class Obb_Batch
+        {
+        public:
+
+            std::vector< float > center_xs;
+            std::vector< float > center_ys;
+            std::vector< float > axis_xs;
+            std::vector< float > axis_ys;
+            std::vector< float > half_widths;
+            std::vector< float > half_heights;
+
+        private:
+
+            size_t count = 0;
+
+        public:
+
+            size_t size  () const { return count;      }
+            bool   empty () const { return count == 0; }
+
+            void clear ()
+            {
+                center_xs.clear (); center_ys.clear (); axis_xs.clear (); axis_ys.clear (); half_widths.clear (); half_heights.clear ();
+                count = 0;
+            }
+
+            void reserve (size_t capacity)
+            {
+                size_t length = shapes_internal::padded (capacity);
+
+                center_xs  .reserve (length); center_ys   .reserve (length); axis_xs.reserve (length); axis_ys.reserve (length);
+                half_widths.reserve (length); half_heights.reserve (length);
+            }
+
+            void push_back (const Obb2f & obb)
+            {
+                center_xs   .resize (count); center_xs   .push_back (obb.center[0]  );
+                center_ys   .resize (count); center_ys   .push_back (obb.center[1]  );
+                axis_xs     .resize (count); axis_xs     .push_back (obb.axis[0]    );
+                axis_ys     .resize (count); axis_ys     .push_back (obb.axis[1]    );
+                half_widths .resize (count); half_widths .push_back (obb.half_width );
+                half_heights.resize (count); half_heights.push_back (obb.half_height);
+
+                size_t length = shapes_internal::padded (++count);
+
+                center_xs   .resize (length, shapes_internal::far_away);
+                center_ys   .resize (length, shapes_internal::far_away);
+                axis_xs     .resize (length, 1.f);
+                axis_ys     .resize (length, 0.f);
+                half_widths .resize (length, 0.f);
+                half_heights.resize (length, 0.f);
+            }
+
+            Obb2f operator [] (size_t index) const
+            {
+                Obb2f obb;
+
+                obb.center      = Point2f (center_xs[index], center_ys[index]);
+                obb.axis        = Vector2f(axis_xs  [index], axis_ys  [index]);
+                obb.half_width  = half_widths [index];
+                obb.half_height = half_heights[index];
+
+                return obb;
+            }
+
+        };
+
+        // -----------------------------------------------------------------------------------------
+        // Pruebas de una forma contra todas las de un lote. Cada una añade a output los índices de
+        // las formas del lote que intersectan con la primera (con el mismo criterio que la versión
+        // de intersects() correspondiente) y retorna cuántos ha añadido.
+
+        inline size_t query (const Circle2f & circle, const Circle_Batch & batch, std::vector< uint32_t > & output)
+        {
+            using shapes_internal::Float4;
+
+            const Float4 x = Float4::splat (circle.center[0]);
+            const Float4 y = Float4::splat (circle.center[1]);
+            const Float4 r = Float4::splat (circle.radius   );
+
+            size_t hits = 0;
+
+            for (size_t first = 0, length = batch.xs.size (); first < length; first += 4)
+            {
+                Float4 dx = Float4::load (&batch.xs[first]) - x;
+                Float4 dy = Float4::load (&batch.ys[first]) - y;
+                Float4 rr = Float4::load (&batch.radii[first]) + r;
+
+                hits += shapes_internal::append_hits (less_equal (dx * dx + dy * dy, rr * rr), first, batch.size (), output);
+            }
+
+            return hits;
+        }
+
+        inline size_t query (const Circle2f & circle, const Aabb_Batch & batch, std::vector< uint32_t > & output)
+        {
+            using shapes_internal::Float4;
+
+            const Float4 x  = Float4::splat (circle.center[0]);
+            const Float4 y  = Float4::splat (circle.center[1]);
+            const Float4 rr = Float4::splat (circle.radius * circle.radius);
+
+            size_t hits = 0;
+
+            for (size_t first = 0, length = batch.min_xs.size (); first < length; first += 4)
+            {
+                Float4 dx = x - clamp (x, Float4::load (&batch.min_xs[first]), Float4::load (&batch.max_xs[first]));
+                Float4 dy = y - clamp (y, Float4::load (&batch.min_ys[first]), Float4::load (&batch.max_ys[first]));
+
+                hits += shapes_internal::append_hits (less_equal (dx * dx + dy * dy, rr), first, batch.size (), output);
+            }
+
+            return hits;
+        }
+
+        inline size_t query (const Circle2f & circle, const Obb_Batch & batch, std::vector< uint32_t > & output)
+        {
+            using shapes_internal::Float4;
+
+            const Float4 x    = Float4::splat (circle.center[0]);
+            const Float4 y    = Float4::splat (circle.center[1]);
+            const Float4 rr   = Float4::splat (circle.radius * circle.radius);
+            const Float4 zero = Float4::splat (0.f);
+
+            size_t hits = 0;
+
+            for (size_t first = 0, length = batch.center_xs.size (); first < length; first += 4)
+            {
+                // El centro del círculo se pasa al espacio local de cada rectángulo:
+
+                Float4 dx = x - Float4::load (&batch.center_xs[first]);
+                Float4 dy = y - Float4::load (&batch.center_ys[first]);
+                Float4 ux = Float4::load (&batch.axis_xs[first]);
+                Float4 uy = Float4::load (&batch.axis_ys[first]);
+                Float4 hw = Float4::load (&batch.half_widths [first]);
+                Float4 hh = Float4::load (&batch.half_heights[first]);
+
+                Float4 local_x = dx * ux + dy * uy;
+                Float4 local_y = dy * ux - dx * uy;
+                Float4 ex      = local_x - clamp (local_x, zero - hw, hw);
+                Float4 ey      = local_y - clamp (local_y, zero - hh, hh);
+
+                hits += shapes_internal::append_hits (less_equal (ex * ex + ey * ey, rr), first, batch.size (), output);
+            }
+
+            return hits;
+        }
+
+        inline size_t query (const Aabb2f & aabb, const Circle_Batch & batch, std::vector< uint32_t > & output)
+        {
+            using shapes_internal::Float4;
+
+            const Float4 min_x = Float4::splat (aabb.min[0]);
+            const Float4 min_y = Float4::splat (aabb.min[1]);
+            const Float4 max_x = Float4::splat (aabb.max[0]);
+            const Float4 max_y = Float4::splat (aabb.max[1]);
+
+            size_t hits = 0;
+
+            for (size_t first = 0, length = batch.xs.size (); first < length; first += 4)
+            {
+                Float4 x  = Float4::load (&batch.xs[first]);
+                Float4 y  = Float4::load (&batch.ys[first]);
+                Float4 r  = Float4::load (&batch.radii[first]);
+                Float4 dx = x - clamp (x, min_x, max_x);
+                Float4 dy = y - clamp (y, min_y, max_y);
+
+                hits += shapes_internal::append_hits (less_equal (dx * dx + dy * dy, r * r), first, batch.size (), output);
+            }
+
+            return hits;
+        }
+
+        inline size_t query (const Aabb2f & aabb, const Aabb_Batch & batch, std::vector< uint32_t > & output)
+        {
+            using shapes_internal::Float4;
+
+            const Float4 min_x = Float4::splat (aabb.min[0]);
+            const Float4 min_y = Float4::splat (aabb.min[1]);
+            const Float4 max_x = Float4::splat (aabb.max[0]);
+            const Float4 max_y = Float4::splat (aabb.max[1]);
+
+            size_t hits = 0;
+
+            for (size_t first = 0, length = batch.min_xs.size (); first < length; first += 4)
+            {
+                unsigned overlap = less_equal (min_x, Float4::load (&batch.max_xs[first]))
+                                 & less_equal (Float4::load (&batch.min_xs[first]), max_x)
+                                 & less_equal (min_y, Float4::load (&batch.max_ys[first]))
+                                 & less_equal (Float4::load (&batch.min_ys[first]), max_y);
+
+                hits += shapes_internal::append_hits (overlap, first, batch.size (), output);
+            }
+
+            return hits;
+        }
+
+        inline size_t query (const Obb2f & obb, const Circle_Batch & batch, std::vector< uint32_t > & output)
+        {
+            using shapes_internal::Float4;
+
+            const Float4 cx = Float4::splat (obb.center[0]);
+            const Float4 cy = Float4::splat (obb.center[1]);
+            const Float4 ux = Float4::splat (obb.axis[0]);
+            const Float4 uy = Float4::splat (obb.axis[1]);
+            const Float4 hw = Float4::splat (obb.half_width );
+            const Float4 hh = Float4::splat (obb.half_height);
+            const Float4 zero = Float4::splat (0.f);
+
+            size_t hits = 0;
+
+            for (size_t first = 0, length = batch.xs.size (); first < length; first += 4)
+            {
+                Float4 dx = Float4::load (&batch.xs[first]) - cx;
+                Float4 dy = Float4::load (&batch.ys[first]) - cy;
+                Float4 r  = Float4::load (&batch.radii[first]);
+
+                Float4 local_x = dx * ux + dy * uy;
+                Float4 local_y = dy * ux - dx * uy;
+                Float4 ex      = local_x - clamp (local_x, zero - hw, hw);
+                Float4 ey      = local_y - clamp (local_y, zero - hh, hh);
+
+                hits += shapes_internal::append_hits (less_equal (ex * ex + ey * ey, r * r), first, batch.size (), output);
+            }
+
+            return hits;
+        }
+
+        inline size_t query (const Obb2f & obb, const Aabb_Batch & batch, std::vector< uint32_t > & output)
+        {
+            using shapes_internal::Float4;
+
+            // Ejes candidatos: X e Y (los de los rectángulos del lote) y los dos del rectángulo
+            // orientado. Sus proyecciones sobre X e Y son constantes para todo el lote:
+
+            const float ux = obb.axis[0], uy = obb.axis[1];
+
+            const Float4 cx       = Float4::splat (obb.center[0]);
+            const Float4 cy       = Float4::splat (obb.center[1]);
+            const Float4 radius_x = Float4::splat (obb.half_width * std::fabs (ux) + obb.half_height * std::fabs (uy));
+            const Float4 radius_y = Float4::splat (obb.half_width * std::fabs (uy) + obb.half_height * std::fabs (ux));
+            const Float4 hw       = Float4::splat (obb.half_width );
+            const Float4 hh       = Float4::splat (obb.half_height);
+            const Float4 abs_ux   = Float4::splat (std::fabs (ux));
+            const Float4 abs_uy   = Float4::splat (std::fabs (uy));
+            const Float4 axis_x   = Float4::splat (ux);
+            const Float4 axis_y   = Float4::splat (uy);
+            const Float4 half     = Float4::splat (.5f);
+
+            size_t hits = 0;
+
+            for (size_t first = 0, length = batch.min_xs.size (); first < length; first += 4)
+            {
+                Float4 min_x = Float4::load (&batch.min_xs[first]), max_x = Float4::load (&batch.max_xs[first]);
+                Float4 min_y = Float4::load (&batch.min_ys[first]), max_y = Float4::load (&batch.max_ys[first]);
+
+                Float4 bw = (max_x - min_x) * half;
+                Float4 bh = (max_y - min_y) * half;
+                Float4 dx = (min_x + max_x) * half - cx;
+                Float4 dy = (min_y + max_y) * half - cy;
+
+                unsigned overlap = less_equal (abs (dx), bw + radius_x) & less_equal (abs (dy), bh + radius_y);
+
+                // Sobre los ejes del rectángulo orientado el del lote se proyecta con |u| y |v|:
+
+                Float4 projection_u = abs (dx * axis_x + dy * axis_y);
+                Float4 projection_v = abs (dy * axis_x - dx * axis_y);
+
+                overlap &= less_equal (projection_u, hw + bw * abs_ux + bh * abs_uy);
+                overlap &= less_equal (projection_v, hh + bw * abs_uy + bh * abs_ux);
+
+                hits += shapes_internal::append_hits (overlap, first, batch.size (), output);
+            }
+
+            return hits;
+        }
+
+        inline size_t query (const Obb2f & obb, const Obb_Batch & batch, std::vector< uint32_t > & output)
+        {
+            using shapes_internal::Float4;
+
+            const float ux = obb.axis[0], uy = obb.axis[1];
+
+            const Float4 cx     = Float4::splat (obb.center[0]);
+            const Float4 cy     = Float4::splat (obb.center[1]);
+            const Float4 axis_x = Float4::splat (ux);
+            const Float4 axis_y = Float4::splat (uy);
+            const Float4 hw     = Float4::splat (obb.half_width );
+            const Float4 hh     = Float4::splat (obb.half_height);
+
+            size_t hits = 0;
+
+            for (size_t first = 0, length = batch.center_xs.size (); first < length; first += 4)
+            {
+                Float4 dx  = Float4::load (&batch.center_xs[first]) - cx;
+                Float4 dy  = Float4::load (&batch.center_ys[first]) - cy;
+                Float4 bux = Float4::load (&batch.axis_xs[first]);
+                Float4 buy = Float4::load (&batch.axis_ys[first]);
+                Float4 bhw = Float4::load (&batch.half_widths [first]);
+                Float4 bhh = Float4::load (&batch.half_heights[first]);
+
+                // |u_a · u_b| y |u_a · v_b| bastan para los cuatro ejes (los otros dos productos son
+                // los mismos con el signo cambiado):
+
+                Float4 c = abs (axis_x * bux + axis_y * buy);       // |u_a · u_b| = |v_a · v_b|
+                Float4 s = abs (axis_x * buy - axis_y * bux);       // |u_a · v_b| = |v_a · u_b|
+
+                unsigned overlap =
+                      less_equal (abs (dx * axis_x + dy * axis_y), hw + bhw * c + bhh * s)  // u_a
+                    & less_equal (abs (dy * axis_x - dx * axis_y), hh + bhw * s + bhh * c)  // v_a
+                    & less_equal (abs (dx * bux   + dy * buy  ), bhw + hw * c + hh * s)     // u_b
+                    & less_equal (abs (dy * bux   - dx * buy  ), bhh + hw * s + hh * c);    // v_b
+
+                hits += shapes_internal::append_hits (overlap, first, batch.size (), output);
+            }
+
+            return hits;
+        }
+
+        inline size_t query (const Aabb2f & aabb, const Obb_Batch & batch, std::vector< uint32_t > & output)
+        {
+            return query (Obb2f(aabb), batch, output);
+        }
+
+    }
+
+#endif
@@ -0,0 +1,398 @@
+/*
+ *  SHAPES
+ *  Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ *  Distributed under the Boost Software License, version  1.0
+ *  See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ *  angel.rodriguez@esne.edu
+ *
+ *  C2610181930
+ */
+
+#ifndef BASICS_SHAPES_HEADER
+#define BASICS_SHAPES_HEADER
+
+    #include <algorithm>
+    #include <cmath>
+    #include "Point.hpp"
+    #include "Vector.hpp"
+
+    namespace basics
+    {
+
+        /**
+         * Círculo (o volumen envolvente esférico en 2D).
+         */
+        class Circle2f
+        {
+        public:
+
+            Point2f center;
+            float   radius;
+
+        public:
+
+            Circle2f() = default;
+
+            Circle2f(const Point2f & center, float radius) : center(center), radius(radius)
+            {
+            }
+
+        };
+
+        /**
+         * Rectángulo alineado con los ejes.
+         */
+        class Aabb2f
+        {
+        public:
+
+            Point2f min;                                ///< Esquina inferior izquierda.
+            Point2f max;                                ///< Esquina superior derecha.
+
+        public:
+
+            Aabb2f() = default;
+
+            Aabb2f(const Point2f & min, const Point2f & max) : min(min), max(max)
+            {
+            }
+
+            static Aabb2f from_center (const Point2f & center, float half_width, float half_height)
+            {
+                return Aabb2f({ center[0] - half_width, center[1] - half_height }, { center[0] + half_width, center[1] + half_height });
+            }
+
+        public:
+
+            Point2f get_center      () const { return { (min[0] + max[0]) * .5f, (min[1] + max[1]) * .5f }; }
+            float   get_half_width  () const { return (max[0] - min[0]) * .5f; }
+            float   get_half_height () const { return (max[1] - min[1]) * .5f; }
+
+        };
+
+        /**
+         * Rectángulo orientado: centro, eje X local (unitario) y semiejes. El eje Y local es el X
+         * girado 90º en sentido antihorario.
+         */
+        class Obb2f
+        {
+        public:
+
+            Point2f  center;
+            Vector2f axis;                              ///< Eje X local del rectángulo (debe ser unitario).
+            float    half_width;                        ///< Semieje a lo largo de axis.
+            float    half_height;                       ///< Semieje a lo largo de la perpendicular a axis.
+
+        public:
+
+            Obb2f() = default;
+
+            Obb2f(const Point2f & center, float half_width, float half_height, float angle)
+            :
+                center     (center),
+                axis       (std::cos (angle), std::sin (angle)),
+                half_width (half_width ),
+                half_height(half_height)
+            {
+            }
+
+            Obb2f(const Aabb2f & aabb)
+            :
+                center     (aabb.get_center ()),
+                axis       (1.f, 0.f),
+                half_width (aabb.get_half_width  ()),
+                half_height(aabb.get_half_height ())
+            {
+            }
+
+        public:
+
+            Vector2f get_perpendicular () const
+            {
+                return Vector2f(-axis[1], axis[0]);
+            }
+
+        };
+
+        /**
+         * Polígono convexo de hasta max_vertices vértices en sentido antihorario.
+         */
+        class Convex_Polygon2f
+        {
+        public:
+
+            static constexpr unsigned max_vertices = 8;
+
+            Point2f  vertices[max_vertices];
+            unsigned count;
+
+        public:
+
+            Convex_Polygon2f() : count(0)
+            {
+            }
+
+            Convex_Polygon2f(const Obb2f & obb);
+
+            bool add (const Point2f & vertex)
+            {
+                if (count == max_vertices) return false;
+
+                vertices[count++] = vertex;
+
+                return true;
+            }
+
+        };
+
+        // -----------------------------------------------------------------------------------------
+        // Pruebas de intersección entre pares de formas. Los contactos en el borde cuentan como
+        // intersección. Las que involucran rectángulos orientados o polígonos usan el teorema del
+        // eje separador (SAT).
+
+        namespace shapes_internal
+        {
+
+            inline float dot (float ax, float ay, float bx, float by)
+            {
+                return ax * bx + ay * by;
+            }
+
+            inline float clamp (float value, float min, float max)
+            {
+                return std::min (std::max (value, min), max);
+            }
+
+            /**
+             * Proyecta el polígono sobre un eje y retorna su intervalo.
+             */
+            inline void project (const Convex_Polygon2f & polygon, float axis_x, float axis_y, float & min, float & max)
+            {
+                min = max = dot (polygon.vertices[0][0], polygon.vertices[0][1], axis_x, axis_y);
+
+                for (unsigned index = 1; index < polygon.count; ++index)
+                {
+                    float projection = dot (polygon.vertices[index][0], polygon.vertices[index][1], axis_x, axis_y);
+
+                    min = std::min (min, projection);
+                    max = std::max (max, projection);
+                }
+            }
+
+            /**
+             * Comprueba si alguna normal de las aristas de a separa ambos polígonos.
+             */
+            inline bool has_separating_edge (const Convex_Polygon2f & a, const Convex_Polygon2f & b)
+            {
+                for (unsigned index = 0; index < a.count; ++index)
+                {
+                    const Point2f & from = a.vertices[index];
+                    const Point2f & to   = a.vertices[(index + 1) % a.count];
+
+                    float normal_x = to[1] - from[1];
+                    float normal_y = from[0] - to[0];
+                    float a_min, a_max, b_min, b_max;
+
+                    project (a, normal_x, normal_y, a_min, a_max);
+                    project (b, normal_x, normal_y, b_min, b_max);
+
+                    if (a_max < b_min || b_max < a_min) return true;
+                }
+
+                return false;
+            }
+
+        }
+
+        inline Convex_Polygon2f::Convex_Polygon2f(const Obb2f & obb) : count(4)
+        {
+            float ux = obb.axis[0] * obb.half_width,  uy = obb.axis[1] * obb.half_width;
+            float vx = -obb.axis[1] * obb.half_height, vy = obb.axis[0] * obb.half_height;
+            float cx = obb.center[0], cy = obb.center[1];
+
+            vertices[0] = Point2f(cx - ux - vx, cy - uy - vy);
+            vertices[1] = Point2f(cx + ux - vx, cy + uy - vy);
+            vertices[2] = Point2f(cx + ux + vx, cy + uy + vy);
+            vertices[3] = Point2f(cx - ux + vx, cy - uy + vy);
+        }
+
+        inline bool intersects (const Circle2f & a, const Circle2f & b)
+        {
+            float dx = b.center[0] - a.center[0];
+            float dy = b.center[1] - a.center[1];
+            float r  = a.radius + b.radius;
+
+            return dx * dx + dy * dy <= r * r;
+        }
+
+        inline bool intersects (const Circle2f & circle, const Aabb2f & aabb)
+        {
+            using shapes_internal::clamp;
+
+            float dx = circle.center[0] - clamp (circle.center[0], aabb.min[0], aabb.max[0]);
+            float dy = circle.center[1] - clamp (circle.center[1], aabb.min[1], aabb.max[1]);
+
+            return dx * dx + dy * dy <= circle.radius * circle.radius;
+        }
+
+        inline bool intersects (const Aabb2f & aabb, const Circle2f & circle)
+        {
+            return intersects (circle, aabb);
+        }
+
+        inline bool intersects (const Circle2f & circle, const Obb2f & obb)
+        {
+            using shapes_internal::clamp;
+            using shapes_internal::dot;
+
+            // Se pasa el centro del círculo al espacio local del rectángulo:
+
+            float dx = circle.center[0] - obb.center[0];
+            float dy = circle.center[1] - obb.center[1];
+            float x  = dot (dx, dy,  obb.axis[0], obb.axis[1]);
+            float y  = dot (dx, dy, -obb.axis[1], obb.axis[0]);
+
+            float ex = x - clamp (x, -obb.half_width,  obb.half_width );
+            float ey = y - clamp (y, -obb.half_height, obb.half_height);
+
+            return ex * ex + ey * ey <= circle.radius * circle.radius;
+        }
+
+        inline bool intersects (const Obb2f & obb, const Circle2f & circle)
+        {
+            return intersects (circle, obb);
+        }
+
+        inline bool intersects (const Aabb2f & a, const Aabb2f & b)
+        {
+            return a.min[0] <= b.max[0] && b.min[0] <= a.max[0] && a.min[1] <= b.max[1] && b.min[1] <= a.max[1];
+        }
+
+        inline bool intersects (const Obb2f & a, const Obb2f & b)
+        {
+            using shapes_internal::dot;
+
+            // Los ejes candidatos son los dos de cada rectángulo. Sobre cada eje se compara la
+            // distancia entre los centros con la suma de los radios proyectados:
+
+            float dx = b.center[0] - a.center[0];
+            float dy = b.center[1] - a.center[1];
+
+            const float axes[4][2] =
+            {
+                {  a.axis[0], a.axis[1] }, { -a.axis[1], a.axis[0] },
+                {  b.axis[0], b.axis[1] }, { -b.axis[1], b.axis[0] },
+            };
+
+            for (auto & axis : axes)
+            {
+                float a_radius = a.half_width  * std::fabs (dot (a.axis[0], a.axis[1], axis[0], axis[1]))
+                               + a.half_height * std::fabs (dot (-a.axis[1], a.axis[0], axis[0], axis[1]));
+                float b_radius = b.half_width  * std::fabs (dot (b.axis[0], b.axis[1], axis[0], axis[1]))
+                               + b.half_height * std::fabs (dot (-b.axis[1], b.axis[0], axis[0], axis[1]));
+
+                if (std::fabs (dot (dx, dy, axis[0], axis[1])) > a_radius + b_radius) return false;
+            }
+
+            return true;
+        }
+
+        inline bool intersects (const Obb2f & obb, const Aabb2f & aabb)
+        {
+            return intersects (obb, Obb2f(aabb));
+        }
+
+        inline bool intersects (const Aabb2f & aabb, const Obb2f & obb)
+        {
+            return intersects (Obb2f(aabb), obb);
+        }
+
+        inline bool intersects (const Convex_Polygon2f & a, const Convex_Polygon2f & b)
+        {
+            if (a.count == 0 || b.count == 0) return false;
+
+            return !shapes_internal::has_separating_edge (a, b) && !shapes_internal::has_separating_edge (b, a);
+        }
+
+        inline bool intersects (const Convex_Polygon2f & polygon, const Circle2f & circle)
+        {
+            using shapes_internal::dot;
+
+            if (polygon.count == 0) return false;
+
+            // Además de las normales de las aristas hay que probar el eje que va del vértice más
+            // cercano al centro del círculo:
+
+            float closest_distance = 0.f;
+            float closest_x = 0.f, closest_y = 0.f;
+
+            for (unsigned index = 0; index < polygon.count; ++index)
+            {
+                float dx = circle.center[0] - polygon.vertices[index][0];
+                float dy = circle.center[1] - polygon.vertices[index][1];
+                float distance = dx * dx + dy * dy;
+
+                if (index == 0 || distance < closest_distance)
+                {
+                    closest_distance = distance;
+                    closest_x        = dx;
+                    closest_y        = dy;
+                }
+            }
+
+            float axes_x[Convex_Polygon2f::max_vertices + 1];
+            float axes_y[Convex_Polygon2f::max_vertices + 1];
+            unsigned axis_count = 0;
+
+            for (unsigned index = 0; index < polygon.count; ++index, ++axis_count)
+            {
+                const Point2f & from = polygon.vertices[index];
+                const Point2f & to   = polygon.vertices[(index + 1) % polygon.count];
+
+                axes_x[axis_count] = to[1] - from[1];
+                axes_y[axis_count] = from[0] - to[0];
+            }
+
+            axes_x[axis_count  ] = closest_x;
+            axes_y[axis_count++] = closest_y;
+
+            for (unsigned index = 0; index < axis_count; ++index)
+            {
+                float length = std::sqrt (dot (axes_x[index], axes_y[index], axes_x[index], axes_y[index]));
+
+                if (length == 0.f) continue;            // El centro coincide con un vértice
+
+                float axis_x = axes_x[index] / length;
+                float axis_y = axes_y[index] / length;
+                float min, max;
+
+                shapes_internal::project (polygon, axis_x, axis_y, min, max);
+
+                float center = dot (circle.center[0], circle.center[1], axis_x, axis_y);
+
+                if (center + circle.radius < min || center - circle.radius > max) return false;
+            }
+
+            return true;
+        }
+
+        inline bool intersects (const Circle2f & circle, const Convex_Polygon2f & polygon)
+        {
+            return intersects (polygon, circle);
+        }
+
+        inline bool intersects (const Convex_Polygon2f & polygon, const Obb2f & obb)
+        {
+            return intersects (polygon, Convex_Polygon2f(obb));
+        }
+
+        inline bool intersects (const Obb2f & obb, const Convex_Polygon2f & polygon)
+        {
+            return intersects (Convex_Polygon2f(obb), polygon);
+        }
+
+    }
+
+#endif
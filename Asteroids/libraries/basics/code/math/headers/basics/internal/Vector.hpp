@@ -27,7 +27,7 @@
             typedef NUMERIC_TYPE Numeric_Type;
             typedef Numeric_Type Number;
 
-            typedef Coordinates< DIMENSION, NUMERIC_TYPE, COORDINATE_SYSTEM > Coordinates;
+            typedef basics::Coordinates< DIMENSION, NUMERIC_TYPE, COORDINATE_SYSTEM > Coordinates;
 
         public:
 
@@ -38,7 +38,7 @@
             Vector() = default;
             Vector(const Vector & other) = default;
 
-            Vector(const Coordinates & given_coordinates) : coordinates(given_coordinates)
+            constexpr Vector(const Coordinates & given_coordinates) : coordinates(given_coordinates)
             {
             }
 
@@ -47,7 +47,7 @@
             }
 
             template< typename... PARAMETERS >
-            Vector(const PARAMETERS &... parameters) : coordinates(parameters...)
+            constexpr Vector(const PARAMETERS &... parameters) : coordinates(parameters...)
             {
             }
 
@@ -94,7 +94,7 @@
                 return coordinates[index];
             }
 
-            const Number & operator [] (const unsigned index) const
+            constexpr const Number & operator [] (const unsigned index) const
             {
                 return coordinates[index];
             }
@@ -128,7 +128,7 @@
 
             Vector operator - (const Vector & other) const
             {
-                return Vector(*this) += other;
+                return Vector(*this) -= other;
             }
 
             const Vector & operator + () const
@@ -142,10 +142,10 @@
 
                 for (unsigned i = 0; i < Coordinates::value_count; ++i)
                 {
-                    coordinates[i] = -coordinates[i];
+                    result.coordinates[i] = -result.coordinates[i];
                 }
 
-                return *this;
+                return result;
             }
 
         public:
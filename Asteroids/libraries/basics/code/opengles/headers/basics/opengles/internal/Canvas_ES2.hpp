@@ -14,6 +14,8 @@
 #define BASICS_OPENGLES_CANVAS_ES2_HEADER
 
     #include <memory>
+    #include <vector>
+    #include <basics/Affine>
     #include <basics/Canvas>
     #include <basics/Transformation>
 
@@ -30,6 +32,18 @@
             static const char * internal_vertex_shader_t;
             static const char * internal_fragment_shader_f;
             static const char * internal_fragment_shader_t;
+            static const char * internal_vertex_shader_c;
+            static const char * internal_fragment_shader_c;
+
+            /**
+             * Vértice de fill_particles(): posición, coordenadas de textura y color (RGBA8 normalizado).
+             */
+            struct Particle_Vertex
+            {
+                float   x, y;
+                float   u, v;
+                uint8_t r, g, b, a;
+            };
 
         public:
 
@@ -47,11 +61,12 @@
             Size2f size;
             Size2f half_size;
 
-            Transformation2f transform;
+            Affine2f         transform;                 ///< El shader descarta la tercera fila, así que basta con la parte afín.
             Transformation2f projection;
 
             std::shared_ptr< Shader_Program > shader_program_f;
             std::shared_ptr< Shader_Program > shader_program_t;
+            std::shared_ptr< Shader_Program > shader_program_c;
 
             int  transform_f_id;
             int projection_f_id;
@@ -61,10 +76,20 @@
             int projection_t_id;
             int    sampler_t_id;
             int    opacity_t_id;
+            int  transform_c_id;
+            int projection_c_id;
+            int    sampler_c_id;
+            int    opacity_c_id;
 
             unsigned   vertex_position_location_f;
             unsigned   vertex_position_location_t;
             unsigned vertex_texture_uv_location_t;
+            unsigned   vertex_position_location_c;
+            unsigned vertex_texture_uv_location_c;
+            unsigned      vertex_color_location_c;
+
+            std::vector< float >           batch_vertices;      ///< Posición y uv intercalados de los rectángulos de fill_rectangles() y de los glifos de draw_text().
+            std::vector< Particle_Vertex > particle_vertices;   ///< Vértices de las partículas de fill_particles().
 
         public:
 
@@ -83,8 +108,11 @@
             void set_clear_color (float r, float g, float b) override;
             void set_color       (float r, float g, float b) override;
             void set_opacity     (float opacity) override;
+            void set_blending    (Blending blending) override;
             void set_transform   (const Transformation2f & transform) override;
             void apply_transform (const Transformation2f & transform) override;
+            void set_transform   (const Affine2f & transform) override;
+            void apply_transform (const Affine2f & transform) override;
 
         public:
 
@@ -97,6 +125,14 @@
             void fill_rectangle  (const Point2f & bottom_left, const Size2f & size) override;
             void fill_rectangle  (const Point2f & where, const Size2f & size, const basics::Texture_2D * texture, int handling = CENTER) override;
             void fill_rectangle  (const Point2f & where, const Size2f & size, const Atlas::Slice * slice, int handling = CENTER) override;
+            void draw_text       (const Point2f & where, const Text_Layout & text_layout, int handling = TOP | LEFT) override;
+            void draw_text       (const Point2f & where, const basics::Text_Prefab & text_prefab, int handling = TOP | LEFT) override;
+            void fill_rectangles (const basics::Texture_2D * texture, const float * lefts, const float * bottoms, const float * widths, const float * heights, size_t count, int handling = 0) override;
+            void fill_particles  (const basics::Texture_2D * texture, const float * xs, const float * ys, const float * sizes, const float * reds, const float * greens, const float * blues, const float * alphas, size_t count) override;
+
+        private:
+
+            void upload_transform ();
 
         };
 
@@ -13,20 +13,118 @@
 #ifndef BASICS_OPENGLES_TEXT_PREFAB_HEADER
 #define BASICS_OPENGLES_TEXT_PREFAB_HEADER
 
+    #include <memory>
+    #include <vector>
+    #include <basics/opengles/OpenGL_ES2>
     #include <basics/Text_Layout>
+    #include <basics/Text_Prefab>
 
-    namespace basics
+    namespace basics { namespace opengles
     {
 
-        class Text_Prefab
+        class Texture_2D;
+
+        /**
+         * Los glifos se convierten en dos triángulos cada uno con la posición y las coordenadas de
+         * textura intercaladas (como en Canvas_ES2::fill_rectangles()) y se suben a un vertex
+         * buffer object. Las posiciones son relativas a la esquina superior izquierda del texto,
+         * por lo que Canvas_ES2 solo tiene que trasladarlo al dibujarlo.
+         */
+        class Text_Prefab : public basics::Text_Prefab
         {
         public:
 
-            Text_Prefab() = default;
-            virtual ~Text_Prefab() = default;
+            static const size_t floats_per_vertex  = 4;
+            static const size_t vertices_per_glyph = 6;
+
+        public:
+
+            static std::shared_ptr< basics::Text_Prefab > create (const Text_Layout & layout);
+
+            /**
+             * Añade a vertices los vértices de los glifos de layout desplazados a (left, top) y
+             * devuelve su textura, o nullptr si no hay nada que dibujar. Se supone que todos los
+             * glifos están en el mismo atlas, como ocurre con los de un Raster_Font, y se omiten
+             * los que no lo estén.
+             */
+            static const Texture_2D * build_vertices (const Text_Layout & layout, float left, float top, std::vector< float > & vertices);
+
+        public:
+
+            static void enable ()
+            {
+                register_factory (ID(opengles2), basics::opengles::Text_Prefab::create);
+            }
+
+            static void unuse ()
+            {
+                glBindBuffer (GL_ARRAY_BUFFER, 0);
+            }
+
+        private:
+
+            const Texture_2D * texture;
+            GLuint             vertex_buffer_id;
+            GLsizei            vertex_count;
+
+        public:
+
+            Text_Prefab(const Text_Layout & layout)
+            :
+                basics::Text_Prefab(layout),
+                texture            (nullptr),
+                vertex_buffer_id   (0),
+                vertex_count       (0)
+            {
+            }
+
+            Text_Prefab(const Text_Prefab & ) = delete;
+
+           ~Text_Prefab()
+            {
+                finalize ();
+            }
+
+        public:
+
+            bool initialize () override;
+
+            void finalize () override
+            {
+                if (initialized)
+                {
+                    glDeleteBuffers (1, &vertex_buffer_id);
+
+                    initialized = false;
+                }
+            }
+
+        public:
+
+            bool is_usable () const
+            {
+                return initialized;
+            }
+
+            const Texture_2D * get_texture () const
+            {
+                return texture;
+            }
+
+            GLsizei get_vertex_count () const
+            {
+                return vertex_count;
+            }
+
+        public:
+
+            void use () const
+            {
+                glBindBuffer (GL_ARRAY_BUFFER, vertex_buffer_id);
+            }
 
         };
 
-    }
+    }}
 
 #endif
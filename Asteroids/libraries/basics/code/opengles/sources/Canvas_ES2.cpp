@@ -10,10 +10,13 @@
  * C1801091703
  */
 
+#include <algorithm>
+#include <cstddef>
 #include <basics/Transformation>
 #include <basics/opengles/OpenGL_ES2>
 #include <basics/opengles/Canvas_ES2>
 #include <basics/opengles/Shader_Program>
+#include <basics/opengles/Text_Prefab>
 #include <basics/opengles/Texture_2D>
 
 // glTexCoordPointer (2, GL_FLOAT, 0, tex_coords);
@@ -64,6 +67,34 @@ namespace basics { namespace opengles
             "gl_FragColor = vec4(texel.rgb, texel.a * opacity);"
         "}";
 
+    const char * Canvas_ES2::internal_vertex_shader_c =
+        "precision mediump float;"
+        "uniform   mat3 transform;"
+        "uniform   mat3 projection;"
+        "attribute vec2 vertex_position;"
+        "attribute vec2 vertex_texture_uv;"
+        "attribute vec4 vertex_color;"
+        "varying   vec2 varying_uv;"
+        "varying   vec4 varying_color;"
+        "void main()"
+        "{"
+            "varying_uv    = vertex_texture_uv;"
+            "varying_color = vertex_color;"
+            "gl_Position   = vec4((vec3(vertex_position, 1.0) * transform * projection).xy, 0.0, 1.0);"
+        "}";
+
+    const char * Canvas_ES2::internal_fragment_shader_c =
+        "precision mediump   float;"
+        "uniform   sampler2D sampler;"
+        "uniform   float     opacity;"
+        "varying   vec2      varying_uv;"
+        "varying   vec4      varying_color;"
+        "void main()"
+        "{"
+            "vec4 texel   = texture2D (sampler, varying_uv) * varying_color;"
+            "gl_FragColor = vec4(texel.rgb, texel.a * opacity);"
+        "}";
+
     static const Point2f normal_texture_uvs[] =
     {
         { 0.f, 1.f },
@@ -148,6 +179,29 @@ namespace basics { namespace opengles
             shader_program_t->set_uniform_value (sampler_t_id, 0);
         }
 
+        shader_program_c.reset (new Shader_Program);
+
+        shader_program_c->add (Shader::Source_Code::from_string (internal_vertex_shader_c,   Shader::Source_Code::VERTEX  ));
+        shader_program_c->add (Shader::Source_Code::from_string (internal_fragment_shader_c, Shader::Source_Code::FRAGMENT));
+
+        context->add (shader_program_c);
+
+        if (shader_program_c->is_usable ())
+        {
+            shader_program_c->use ();
+
+             transform_c_id = shader_program_c->get_uniform_id ("transform" );
+            projection_c_id = shader_program_c->get_uniform_id ("projection");
+               sampler_c_id = shader_program_c->get_uniform_id ("sampler"   );
+               opacity_c_id = shader_program_c->get_uniform_id ("opacity"   );
+
+              vertex_position_location_c = shader_program_c->get_vertex_attribute_id ("vertex_position"  );
+            vertex_texture_uv_location_c = shader_program_c->get_vertex_attribute_id ("vertex_texture_uv");
+                 vertex_color_location_c = shader_program_c->get_vertex_attribute_id ("vertex_color"     );
+
+            shader_program_c->set_uniform_value (sampler_c_id, 0);
+        }
+
         reset_state ();
     }
 
@@ -175,6 +229,9 @@ namespace basics { namespace opengles
 
         shader_program_t->use ();
         shader_program_t->set_uniform_value (projection_t_id, projection.matrix);
+
+        shader_program_c->use ();
+        shader_program_c->set_uniform_value (projection_c_id, projection.matrix);
     }
 
     void Canvas_ES2::set_clear_color (float r, float g, float b)
@@ -188,6 +245,41 @@ namespace basics { namespace opengles
         shader_program_f->set_uniform_value (opacity_f_id, opacity);
         shader_program_t->use ();
         shader_program_t->set_uniform_value (opacity_t_id, opacity);
+        shader_program_c->use ();
+        shader_program_c->set_uniform_value (opacity_c_id, opacity);
+    }
+
+    void Canvas_ES2::set_blending (Blending blending)
+    {
+        switch (blending)
+        {
+            case NONE:
+            {
+                glDisable   (GL_BLEND);
+                break;
+            }
+            case TRANSPARENCY:
+            {
+                glEnable    (GL_BLEND);
+                glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                break;
+            }
+            case MULTIPLY:
+            {
+                // Los shaders generan alfa no premultiplicado, por lo que el destino solo se
+                // multiplica por el color de origen (el alfa no interviene):
+
+                glEnable    (GL_BLEND);
+                glBlendFunc (GL_DST_COLOR, GL_ZERO);
+                break;
+            }
+            case ADD:
+            {
+                glEnable    (GL_BLEND);
+                glBlendFunc (GL_SRC_ALPHA, GL_ONE);
+                break;
+            }
+        }
     }
 
     void Canvas_ES2::set_color (float r, float g, float b)
@@ -198,24 +290,42 @@ namespace basics { namespace opengles
 
     void Canvas_ES2::set_transform (const Transformation2f & new_transform)
     {
-        transform = new_transform;
+        set_transform (Affine2f(new_transform));
+    }
 
-        shader_program_f->use ();
-        shader_program_f->set_uniform_value (transform_f_id, transform.matrix);
+    void Canvas_ES2::apply_transform (const Transformation2f & t)
+    {
+        apply_transform (Affine2f(t));
+    }
 
-        shader_program_t->use ();
-        shader_program_t->set_uniform_value (transform_t_id, transform.matrix);
+    void Canvas_ES2::set_transform (const Affine2f & new_transform)
+    {
+        transform = new_transform;
+
+        upload_transform ();
     }
 
-    void Canvas_ES2::apply_transform (const Transformation2f & t)
+    void Canvas_ES2::apply_transform (const Affine2f & t)
     {
         transform = t * transform;
 
+        upload_transform ();
+    }
+
+    void Canvas_ES2::upload_transform ()
+    {
+        // Los shaders esperan una mat3, que se construye una sola vez para los tres programas:
+
+        const Transformation2f matrix = transform;
+
         shader_program_f->use ();
-        shader_program_f->set_uniform_value (transform_f_id, transform.matrix);
+        shader_program_f->set_uniform_value (transform_f_id, matrix.matrix);
 
         shader_program_t->use ();
-        shader_program_t->set_uniform_value (transform_t_id, transform.matrix);
+        shader_program_t->set_uniform_value (transform_t_id, matrix.matrix);
+
+        shader_program_c->use ();
+        shader_program_c->set_uniform_value (transform_c_id, matrix.matrix);
     }
 
     void Canvas_ES2::clear ()
@@ -445,4 +555,225 @@ namespace basics { namespace opengles
         }
     }
 
+    void Canvas_ES2::draw_text (const Point2f & where, const Text_Layout & text_layout, int handling)
+    {
+        // Todos los glifos se dibujan con una sola llamada a glDrawArrays() en lugar de llamar a
+        // fill_rectangle() por cada uno:
+
+        Point2f origin = text_origin (where, text_layout.get_width (), text_layout.get_height (), handling);
+
+        batch_vertices.clear ();
+
+        const opengles::Texture_2D * opengl_es_texture = Text_Prefab::build_vertices (text_layout, origin[0], origin[1], batch_vertices);
+
+        if (opengl_es_texture && !batch_vertices.empty ())
+        {
+            opengl_es_texture->use ();
+            shader_program_t ->use ();
+
+            const GLsizei stride = GLsizei(Text_Prefab::floats_per_vertex * sizeof(float));
+
+            glEnableVertexAttribArray (  vertex_position_location_t);
+            glEnableVertexAttribArray (vertex_texture_uv_location_t);
+            glVertexAttribPointer     (  vertex_position_location_t, 2, GL_FLOAT, GL_FALSE, stride, batch_vertices.data ()    );
+            glVertexAttribPointer     (vertex_texture_uv_location_t, 2, GL_FLOAT, GL_FALSE, stride, batch_vertices.data () + 2);
+            glDrawArrays              (GL_TRIANGLES, 0, GLsizei(batch_vertices.size () / Text_Prefab::floats_per_vertex));
+        }
+    }
+
+    void Canvas_ES2::draw_text (const Point2f & where, const basics::Text_Prefab & text_prefab, int handling)
+    {
+        const opengles::Text_Prefab * opengl_es_prefab = dynamic_cast< const opengles::Text_Prefab * >(&text_prefab);
+
+        if (!opengl_es_prefab || !opengl_es_prefab->is_usable ())
+        {
+            draw_text (where, text_prefab.get_layout (), handling);
+            return;
+        }
+
+        // Los vértices del prefab son relativos a la esquina superior izquierda del texto, por lo
+        // que basta con añadir una traslación a la transformación mientras se dibuja:
+
+        Point2f origin = text_origin (where, text_prefab.get_width (), text_prefab.get_height (), handling);
+
+        const Transformation2f matrix = transform * Affine2f::translation ({ origin[0], origin[1] });
+
+        opengl_es_prefab->get_texture ()->use ();
+        shader_program_t->use ();
+        shader_program_t->set_uniform_value (transform_t_id, matrix.matrix);
+
+        const GLsizei stride = GLsizei(Text_Prefab::floats_per_vertex * sizeof(float));
+
+        opengl_es_prefab->use ();
+
+        glEnableVertexAttribArray (  vertex_position_location_t);
+        glEnableVertexAttribArray (vertex_texture_uv_location_t);
+        glVertexAttribPointer     (  vertex_position_location_t, 2, GL_FLOAT, GL_FALSE, stride, reinterpret_cast< const void * >(0));
+        glVertexAttribPointer     (vertex_texture_uv_location_t, 2, GL_FLOAT, GL_FALSE, stride, reinterpret_cast< const void * >(2 * sizeof(float)));
+        glDrawArrays              (GL_TRIANGLES, 0, opengl_es_prefab->get_vertex_count ());
+
+        // Se desactiva el buffer para que el resto de métodos puedan seguir pasando punteros a
+        // memoria normal y se restaura la transformación:
+
+        Text_Prefab::unuse ();
+
+        shader_program_t->set_uniform_value (transform_t_id, Transformation2f(transform).matrix);
+    }
+
+    void Canvas_ES2::fill_rectangles
+    (
+        const basics::Texture_2D * texture,
+        const float              * lefts,
+        const float              * bottoms,
+        const float              * widths,
+        const float              * heights,
+        size_t                     count,
+        int                        handling
+    )
+    {
+        const opengles::Texture_2D * opengl_es_texture = dynamic_cast< const opengles::Texture_2D * >(texture);
+
+        if (opengl_es_texture && count > 0)
+        {
+            const Point2f * texture_uvs;
+
+            switch (handling & 0xF0)
+            {
+                case FLIP_HORIZONTAL:  texture_uvs = h_flip_texture_uvs; break;
+                case FLIP_VERTICAL:    texture_uvs = v_flip_texture_uvs; break;
+                case FLIP_HORIZONTAL | FLIP_VERTICAL:
+                                       texture_uvs = d_flip_texture_uvs; break;
+                default:               texture_uvs = normal_texture_uvs; break;
+            }
+
+            opengl_es_texture->use ();
+            shader_program_t ->use ();
+
+            glEnableVertexAttribArray (  vertex_position_location_t);
+            glEnableVertexAttribArray (vertex_texture_uv_location_t);
+
+            // Cada rectángulo se convierte en dos triángulos con la posición y las coordenadas de
+            // textura intercaladas, y se dibujan todos con una sola llamada a glDrawArrays() por
+            // cada bloque de rectángulos:
+
+            static const size_t floats_per_vertex       = 4;
+            static const size_t vertices_per_rectangle  = 6;
+            static const size_t max_rectangles_per_draw = 1024;
+            static const int    corners[vertices_per_rectangle] = { 0, 1, 2, 2, 1, 3 };
+
+            for (size_t first = 0; first < count; first += max_rectangles_per_draw)
+            {
+                size_t batch_size = std::min (count - first, max_rectangles_per_draw);
+
+                batch_vertices.resize (batch_size * vertices_per_rectangle * floats_per_vertex);
+
+                float * vertex = batch_vertices.data ();
+
+                for (size_t index = first, end = first + batch_size; index < end; ++index)
+                {
+                    float left   = lefts  [index];
+                    float bottom = bottoms[index];
+                    float right  = left   + widths [index];
+                    float top    = bottom + heights[index];
+
+                    // Mismo orden de esquinas que en fill_rectangle(): inferior izquierda, superior
+                    // izquierda, inferior derecha y superior derecha:
+
+                    const float xs[] = { left,   left, right,  right };
+                    const float ys[] = { bottom, top,  bottom, top   };
+
+                    for (int corner : corners)
+                    {
+                        *vertex++ = xs[corner];
+                        *vertex++ = ys[corner];
+                        *vertex++ = texture_uvs[corner][0];
+                        *vertex++ = texture_uvs[corner][1];
+                    }
+                }
+
+                const GLsizei stride = GLsizei(floats_per_vertex * sizeof(float));
+
+                glVertexAttribPointer (  vertex_position_location_t, 2, GL_FLOAT, GL_FALSE, stride, batch_vertices.data ()    );
+                glVertexAttribPointer (vertex_texture_uv_location_t, 2, GL_FLOAT, GL_FALSE, stride, batch_vertices.data () + 2);
+                glDrawArrays          (GL_TRIANGLES, 0, GLsizei(batch_size * vertices_per_rectangle));
+            }
+        }
+    }
+
+    void Canvas_ES2::fill_particles
+    (
+        const basics::Texture_2D * texture,
+        const float              * xs,
+        const float              * ys,
+        const float              * sizes,
+        const float              * reds,
+        const float              * greens,
+        const float              * blues,
+        const float              * alphas,
+        size_t                     count
+    )
+    {
+        const opengles::Texture_2D * opengl_es_texture = dynamic_cast< const opengles::Texture_2D * >(texture);
+
+        if (!opengl_es_texture || count == 0)
+        {
+            return;
+        }
+
+        // Todas las partículas se envían en una única llamada a glDrawArrays(), con dos triángulos
+        // por partícula y el color empaquetado en 4 bytes por vértice:
+
+        static const int corners[] = { 0, 1, 2, 2, 1, 3 };
+
+        particle_vertices.resize (count * 6);
+
+        Particle_Vertex * vertex = particle_vertices.data ();
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            float half_size = sizes[index] * .5f;
+            float left      = xs[index] - half_size;
+            float right     = xs[index] + half_size;
+            float bottom    = ys[index] - half_size;
+            float top       = ys[index] + half_size;
+
+            const float corner_xs[] = { left,   left, right,  right };
+            const float corner_ys[] = { bottom, top,  bottom, top   };
+
+            uint8_t r = uint8_t(std::min (std::max (reds  [index], 0.f), 1.f) * 255.f + .5f);
+            uint8_t g = uint8_t(std::min (std::max (greens[index], 0.f), 1.f) * 255.f + .5f);
+            uint8_t b = uint8_t(std::min (std::max (blues [index], 0.f), 1.f) * 255.f + .5f);
+            uint8_t a = uint8_t(std::min (std::max (alphas[index], 0.f), 1.f) * 255.f + .5f);
+
+            for (int corner : corners)
+            {
+                vertex->x = corner_xs[corner];
+                vertex->y = corner_ys[corner];
+                vertex->u = normal_texture_uvs[corner][0];
+                vertex->v = normal_texture_uvs[corner][1];
+                vertex->r = r;
+                vertex->g = g;
+                vertex->b = b;
+                vertex->a = a;
+
+                ++vertex;
+            }
+        }
+
+        opengl_es_texture->use ();
+        shader_program_c ->use ();
+
+        const GLsizei   stride = GLsizei(sizeof(Particle_Vertex));
+        const uint8_t * data   = reinterpret_cast< const uint8_t * >(particle_vertices.data ());
+
+        glEnableVertexAttribArray  (  vertex_position_location_c);
+        glEnableVertexAttribArray  (vertex_texture_uv_location_c);
+        glEnableVertexAttribArray  (     vertex_color_location_c);
+        glVertexAttribPointer      (  vertex_position_location_c, 2, GL_FLOAT,         GL_FALSE, stride, data + offsetof(Particle_Vertex, x));
+        glVertexAttribPointer      (vertex_texture_uv_location_c, 2, GL_FLOAT,         GL_FALSE, stride, data + offsetof(Particle_Vertex, u));
+        glVertexAttribPointer      (     vertex_color_location_c, 4, GL_UNSIGNED_BYTE, GL_TRUE,  stride, data + offsetof(Particle_Vertex, r));
+        glDrawArrays               (GL_TRIANGLES, 0, GLsizei(count * 6));
+        glDisableVertexAttribArray (     vertex_color_location_c);
+    }
+
 }}
@@ -10,9 +10,101 @@
  * C1802030200
  */
 
+#include <basics/assert>
 #include <basics/opengles/Text_Prefab>
+#include <basics/opengles/Texture_2D>
 
-namespace basics
+namespace basics { namespace opengles
 {
 
-}
+    std::shared_ptr< basics::Text_Prefab > Text_Prefab::create (const Text_Layout & layout)
+    {
+        return std::shared_ptr< Text_Prefab >(new Text_Prefab(layout));
+    }
+
+    const Texture_2D * Text_Prefab::build_vertices (const Text_Layout & layout, float left, float top, std::vector< float > & vertices)
+    {
+        const Text_Layout::Glyph_List & glyphs = layout.get_glyphs ();
+
+        if (glyphs.empty () || !glyphs.front ().slice || !glyphs.front ().slice->atlas)
+        {
+            return nullptr;
+        }
+
+        const Atlas      * atlas   = glyphs.front ().slice->atlas;
+        const Texture_2D * texture = dynamic_cast< const Texture_2D * >(atlas->get_texture ().get ());
+
+        if (!texture)
+        {
+            return nullptr;
+        }
+
+        float horizontal_ratio = 1.f / texture->get_width  ();
+        float   vertical_ratio = 1.f / texture->get_height ();
+
+        // Mismo orden de esquinas y de coordenadas de textura que en Canvas_ES2::fill_rectangle()
+        // con un Atlas::Slice: inferior izquierda, superior izquierda, inferior derecha y superior
+        // derecha:
+
+        static const int corners[vertices_per_glyph] = { 0, 1, 2, 2, 1, 3 };
+
+        vertices.reserve (vertices.size () + glyphs.size () * vertices_per_glyph * floats_per_vertex);
+
+        for (auto & glyph : glyphs)
+        {
+            if (!glyph.slice || glyph.slice->atlas != atlas) continue;
+
+            float glyph_left   = left + glyph.position[0];
+            float glyph_top    = top  + glyph.position[1];
+            float glyph_right  = glyph_left + glyph.size.width;
+            float glyph_bottom = glyph_top  - glyph.size.height;
+
+            float u_left   = glyph.slice->left   * horizontal_ratio;
+            float u_right  = glyph.slice->right  * horizontal_ratio;
+            float v_top    = glyph.slice->top    *   vertical_ratio;
+            float v_bottom = glyph.slice->bottom *   vertical_ratio;
+
+            const float xs[] = { glyph_left,   glyph_left, glyph_right,  glyph_right };
+            const float ys[] = { glyph_bottom, glyph_top,  glyph_bottom, glyph_top   };
+            const float us[] = { u_left,       u_left,     u_right,      u_right     };
+            const float vs[] = { v_top,        v_bottom,   v_top,        v_bottom    };
+
+            for (int corner : corners)
+            {
+                vertices.push_back (xs[corner]);
+                vertices.push_back (ys[corner]);
+                vertices.push_back (us[corner]);
+                vertices.push_back (vs[corner]);
+            }
+        }
+
+        return texture;
+    }
+
+    bool Text_Prefab::initialize ()
+    {
+        if (!initialized)
+        {
+            std::vector< float > vertices;
+
+            texture = build_vertices (layout, 0.f, 0.f, vertices);
+
+            if (texture && !vertices.empty ())
+            {
+                vertex_count = GLsizei(vertices.size () / floats_per_vertex);
+
+                glGenBuffers (1, &vertex_buffer_id);
+                glBindBuffer (GL_ARRAY_BUFFER, vertex_buffer_id);
+                glBufferData (GL_ARRAY_BUFFER, GLsizeiptr(vertices.size () * sizeof(float)), vertices.data (), GL_STATIC_DRAW);
+                glBindBuffer (GL_ARRAY_BUFFER, 0);
+
+                assert(glGetError () == GL_NO_ERROR);
+
+                initialized = true;
+            }
+        }
+
+        return initialized;
+    }
+
+}}
@@ -13,6 +13,7 @@
 #include <basics/enable>
 #include <basics/opengles/Canvas_ES2>
 #include <basics/opengles/OpenGL_ES2>
+#include <basics/opengles/Text_Prefab>
 #include <basics/opengles/Texture_2D>
 
 namespace basics
@@ -22,6 +23,7 @@ namespace basics
     bool enable< OpenGL_ES2 > ()
     {
         opengles::Canvas_ES2::enable ();
+        opengles::Text_Prefab::enable ();
         opengles::Texture_2D::enable ();
 
         return true;
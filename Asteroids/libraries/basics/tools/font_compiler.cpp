@@ -0,0 +1,199 @@
+/*
+ * FONT COMPILER
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610181995
+ */
+
+// Herramienta para el ordenador de desarrollo que convierte una fuente de BMFont en formato XML
+// (.fnt) al formato binario de basics::Raster_Font (.bfnt, ver Raster_Font_Format). La textura no
+// se modifica y debe seguir estando junto a la fuente.
+//
+// Compilación:
+//
+//   c++ -std=c++11 -O2 -I../code/base/headers font_compiler.cpp -o font_compiler
+//
+// Uso:
+//
+//   font_compiler fuente.fnt fuente.bfnt
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <rapidxml.hpp>
+#include <basics/Raster_Font_Format>
+
+using namespace std;
+using namespace rapidxml;
+using namespace basics::raster_font_format;
+
+namespace
+{
+
+    int int_attribute (xml_node<> * node, const char * name, bool & found)
+    {
+        xml_attribute<> * attribute = node->first_attribute (name);
+
+        if (!attribute)
+        {
+            found = false;
+            return 0;
+        }
+
+        return atoi (attribute->value ());
+    }
+
+    bool compile (vector< char > & font_data, vector< char > & output)
+    {
+        font_data.push_back (0);
+
+        xml_document<> xml;
+
+        xml.parse< 0 > (font_data.data ());
+
+        xml_node<> *   font_tag = xml.first_node ("font");
+        xml_node<> *   info_tag = font_tag ? font_tag->first_node ("info"  ) : nullptr;
+        xml_node<> * common_tag = font_tag ? font_tag->first_node ("common") : nullptr;
+        xml_node<> *  pages_tag = font_tag ? font_tag->first_node ("pages" ) : nullptr;
+        xml_node<> *  chars_tag = font_tag ? font_tag->first_node ("chars" ) : nullptr;
+        xml_node<> *   page_tag = pages_tag ? pages_tag->first_node ("page") : nullptr;
+
+        if (!info_tag || !common_tag || !chars_tag || !page_tag)
+        {
+            fprintf (stderr, "error: missing info, common, pages or chars tag.\n");
+            return false;
+        }
+
+        xml_attribute<> * face_attribute = info_tag->first_attribute ("face");
+        xml_attribute<> * file_attribute = page_tag->first_attribute ("file");
+
+        if (!face_attribute || !file_attribute)
+        {
+            fprintf (stderr, "error: missing face or page file.\n");
+            return false;
+        }
+
+        bool found = true;
+
+        Header header = { };
+
+        header.magic       = magic;
+        header.version     = version;
+        header.line_height = int_attribute (common_tag, "lineHeight", found);
+        header.base        = int_attribute (common_tag, "base",       found);
+
+        xml_attribute<> * pages_attribute = common_tag->first_attribute ("pages");
+
+        if (!found || (pages_attribute && atoi (pages_attribute->value ()) != 1))
+        {
+            fprintf (stderr, "error: lineHeight and base are required and only fonts with one page are supported.\n");
+            return false;
+        }
+
+        vector< Character_Record > records;
+
+        for (xml_node<> * char_tag = chars_tag->first_node ("char"); char_tag; char_tag = char_tag->next_sibling ("char"))
+        {
+            Character_Record record = { };
+
+            record.code     = uint32_t(int_attribute (char_tag, "id",       found));
+            record.x        = uint16_t(int_attribute (char_tag, "x",        found));
+            record.y        = uint16_t(int_attribute (char_tag, "y",        found));
+            record.width    = uint16_t(int_attribute (char_tag, "width",    found));
+            record.height   = uint16_t(int_attribute (char_tag, "height",   found));
+            record.x_offset =  int16_t(int_attribute (char_tag, "xoffset",  found));
+            record.y_offset =  int16_t(int_attribute (char_tag, "yoffset",  found));
+            record.advance  =  int16_t(int_attribute (char_tag, "xadvance", found));
+
+            if (!found)
+            {
+                fprintf (stderr, "error: incomplete char tag.\n");
+                return false;
+            }
+
+            records.push_back (record);
+        }
+
+        // Se ordenan por código para que Raster_Font pueda construir su tabla de búsqueda sin
+        // reordenar nada:
+
+        sort (records.begin (), records.end (), [] (const Character_Record & a, const Character_Record & b) { return a.code < b.code; });
+
+        for (size_t index = 1; index < records.size (); ++index)
+        {
+            if (records[index].code == records[index - 1].code)
+            {
+                fprintf (stderr, "error: character %u is defined twice.\n", unsigned(records[index].code));
+                return false;
+            }
+        }
+
+        if (records.empty ())
+        {
+            fprintf (stderr, "error: the font has no characters.\n");
+            return false;
+        }
+
+        string texture_name = file_attribute->value ();
+        string face_name    = face_attribute->value ();
+
+        header.character_count     = uint32_t(records.size ());
+        header.texture_name_length = uint32_t(texture_name.size ());
+        header.face_name_length    = uint32_t(face_name.size ());
+
+        const char * header_bytes  = reinterpret_cast< const char * >(&header);
+        const char * records_bytes = reinterpret_cast< const char * >(records.data ());
+
+        output.insert (output.end (), header_bytes,  header_bytes  + sizeof(Header));
+        output.insert (output.end (), records_bytes, records_bytes + records.size () * sizeof(Character_Record));
+        output.insert (output.end (), texture_name.begin (), texture_name.end ());
+        output.insert (output.end (), face_name.begin (),    face_name.end ());
+
+        return true;
+    }
+
+}
+
+int main (int number_of_arguments, char * arguments[])
+{
+    if (number_of_arguments != 3)
+    {
+        fprintf (stderr, "usage: font_compiler input.fnt output.bfnt\n");
+        return EXIT_FAILURE;
+    }
+
+    ifstream input(arguments[1], ios::binary);
+
+    if (!input)
+    {
+        fprintf (stderr, "error: can't open %s.\n", arguments[1]);
+        return EXIT_FAILURE;
+    }
+
+    vector< char > font_data((istreambuf_iterator< char >(input)), istreambuf_iterator< char >());
+    vector< char > output;
+
+    if (!compile (font_data, output))
+    {
+        return EXIT_FAILURE;
+    }
+
+    ofstream output_file(arguments[2], ios::binary);
+
+    if (!output_file.write (output.data (), streamsize(output.size ())))
+    {
+        fprintf (stderr, "error: can't write %s.\n", arguments[2]);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+/*
+ * BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182060
+ */
+
+#ifndef HOST_BENCHMARK_HEADER
+#define HOST_BENCHMARK_HEADER
+
+    #include <chrono>
+    #include <cstdio>
+
+    namespace host
+    {
+
+        /**
+         * Registro mínimo de benchmarks. Cada uno recibe quick = true cuando debe usar tamaños
+         * reducidos (en CTest solo se comprueba que se ejecutan) e informa de sus medidas con report().
+         */
+        struct Benchmark
+        {
+            typedef void (* Function) (bool quick);
+
+            const char * name;
+            Function     function;
+            Benchmark  * next;
+
+            static Benchmark * first;
+
+            Benchmark(const char * name, Function function)
+            :
+                name(name), function(function), next(first)
+            {
+                first = this;
+            }
+        };
+
+        inline void report (const char * benchmark, const char * measure, double value, const char * unit)
+        {
+            std::printf ("%-22s %-36s %14.2f %s\n", benchmark, measure, value, unit);
+        }
+
+        /**
+         * Segundos transcurridos desde start.
+         */
+        inline double seconds_since (std::chrono::steady_clock::time_point start)
+        {
+            return std::chrono::duration< double >(std::chrono::steady_clock::now () - start).count ();
+        }
+
+        /**
+         * Impide que el compilador elimine un cálculo cuyo resultado no se usa.
+         */
+        template< typename TYPE >
+        inline void keep (const TYPE & value)
+        {
+            asm volatile ("" : : "g"(&value) : "memory");
+        }
+
+    }
+
+    #define BENCHMARK(NAME)                                                                         \
+        static void NAME##_benchmark (bool quick);                                                  \
+        static host::Benchmark NAME##_registration (#NAME, NAME##_benchmark);                       \
+        static void NAME##_benchmark (bool quick)
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * COLLISION WORLD BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182115
+ */
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include <basics/Collision_World>
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace host;
+using namespace std;
+
+    // Compara Collision_World::find_pairs() con la comprobación de todos los pares entre sí, con
+    // cuerpos de 16x16 que se mueven cada fotograma por un área que crece con su número (la
+    // densidad se mantiene constante). Ambos métodos deben encontrar los mismos pares:
+
+BENCHMARK(collision_world)
+{
+    const unsigned frames = quick ? 2 : 10;
+    const float    size   = 16.f;
+
+    for (unsigned count : { 100u, 1000u, 10000u, 30000u })
+    {
+        if (quick && count > 1000) break;
+
+        minstd_rand random(count);
+
+        float side = sqrt (float(count)) * 40.f;
+
+        vector< float > x(count), y(count), speed_x(count), speed_y(count);
+
+        Collision_World world(32.f);
+
+        for (unsigned index = 0; index < count; ++index)
+        {
+            x      [index] = float(random () % unsigned(side));
+            y      [index] = float(random () % unsigned(side));
+            speed_x[index] = float(int(random () % 5) - 2);
+            speed_y[index] = float(int(random () % 5) - 2);
+
+            world.add_body (1, 1, index);
+        }
+
+        const bool brute_force = count <= 10000;
+
+        double grid_seconds  = 0.0;
+        double brute_seconds = 0.0;
+        size_t grid_pairs    = 0;
+        size_t brute_pairs   = 0;
+
+        for (unsigned frame = 0; frame < frames; ++frame)
+        {
+            for (unsigned index = 0; index < count; ++index)
+            {
+                x[index] += speed_x[index];
+                y[index] += speed_y[index];
+
+                world.set_bounds (index, x[index], y[index], x[index] + size, y[index] + size);
+            }
+
+            auto start = chrono::steady_clock::now ();
+
+            grid_pairs    = world.find_pairs ().size ();
+            grid_seconds += seconds_since (start);
+
+            if (brute_force)
+            {
+                start       = chrono::steady_clock::now ();
+                brute_pairs = 0;
+
+                for (unsigned a = 0; a < count; ++a)
+                {
+                    for (unsigned b = a + 1; b < count; ++b)
+                    {
+                        if (!(x[b] >= x[a] + size || x[b] + size <= x[a] || y[b] >= y[a] + size || y[b] + size <= y[a])) ++brute_pairs;
+                    }
+                }
+
+                brute_seconds += seconds_since (start);
+            }
+        }
+
+        string name = "collision/" + to_string (count);
+
+        report (name.c_str (), "find_pairs() por fotograma", grid_seconds * 1e3 / frames, "ms");
+        report (name.c_str (), "pares",                      double(grid_pairs),           ""  );
+
+        if (brute_force)
+        {
+            report (name.c_str (), "todos contra todos por fotograma", brute_seconds * 1e3 / frames, "ms");
+            report (name.c_str (), "pares (todos contra todos)",       double(brute_pairs),          ""  );
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * FAST MATH BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182145
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include <basics/Fast_Math>
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace host;
+using namespace std;
+
+namespace
+{
+
+    template< typename FUNCTION >
+    void measure (const char * name, const char * measure, size_t count, FUNCTION function)
+    {
+        auto start = chrono::steady_clock::now ();
+
+        function ();
+
+        report (name, measure, seconds_since (start) * 1e9 / count, "ns");
+    }
+
+}
+
+    // Tiempo por valor de las funciones de libm, de las aproximaciones escalares y de las versiones
+    // para arrays, y del cálculo del ángulo de la nave antes (double, pow, sqrt y acos) y ahora:
+
+BENCHMARK(fast_math)
+{
+    const size_t count = quick ? 1 << 12 : 1 << 20;
+
+    vector< float > angles(count), xs(count), ys(count), cosines(count), out_a(count), out_b(count);
+
+    minstd_rand random(1);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        angles [index] = uniform_real_distribution< float >(-1000.f, 1000.f)(random);
+        xs     [index] = uniform_real_distribution< float >( -100.f,  100.f)(random);
+        ys     [index] = uniform_real_distribution< float >( -100.f,  100.f)(random);
+        cosines[index] = uniform_real_distribution< float >(   -1.f,    1.f)(random);
+    }
+
+    float sum = 0.f;
+
+    measure ("fast_math/sincos", "libm",     count, [&] { for (size_t i = 0; i < count; ++i) sum += sinf (angles[i]) + cosf (angles[i]); });
+    measure ("fast_math/sincos", "escalar",  count, [&] { for (size_t i = 0; i < count; ++i) { float s, c; fast::sincos (angles[i], s, c); sum += s + c; } });
+    measure ("fast_math/sincos", "array",    count, [&] { fast::sincos (angles.data (), out_a.data (), out_b.data (), count); });
+
+    measure ("fast_math/atan2",  "libm",     count, [&] { for (size_t i = 0; i < count; ++i) sum += atan2f (ys[i], xs[i]); });
+    measure ("fast_math/atan2",  "escalar",  count, [&] { for (size_t i = 0; i < count; ++i) sum += fast::atan2 (ys[i], xs[i]); });
+    measure ("fast_math/atan2",  "array",    count, [&] { fast::atan2 (ys.data (), xs.data (), out_a.data (), count); });
+
+    measure ("fast_math/acos",   "libm",     count, [&] { for (size_t i = 0; i < count; ++i) sum += acosf (cosines[i]); });
+    measure ("fast_math/acos",   "escalar",  count, [&] { for (size_t i = 0; i < count; ++i) sum += fast::acos (cosines[i]); });
+
+    measure ("fast_math/rsqrt",  "1/sqrtf",  count, [&] { for (size_t i = 0; i < count; ++i) sum += 1.f / sqrtf (fabsf (xs[i]) + 1.f); });
+    measure ("fast_math/rsqrt",  "escalar",  count, [&] { for (size_t i = 0; i < count; ++i) sum += fast::rsqrt (fabsf (xs[i]) + 1.f); });
+
+    measure
+    (
+        "fast_math/steer", "antes (double)", count, [&]
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                double x = xs[i], y = ys[i];
+                double a = fabs (sqrt (pow (x, 2.0) + pow (y, 2.0)));
+                double b = fabs (sqrt (pow (y, 2.0) + pow (x, 2.0)));
+
+                sum += float(acos ((x * y + y * x) / (a * b)));
+            }
+        }
+    );
+
+    measure
+    (
+        "fast_math/steer", "ahora (float)", count, [&]
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                float x = xs[i], y = ys[i];
+                float l = (x * x + y * y) * (y * y + x * x);
+
+                sum += fast::acos (l > 0.f ? (x * y + y * x) * fast::rsqrt (l) : 1.f);
+            }
+        }
+    );
+
+    keep (sum);
+    keep (out_a);
+    keep (out_b);
+}
@@ -0,0 +1,83 @@
+/*
+ * FRAGMENTS BENCHMARK
+ * Copyright © 2021+ Marcelo López de lErma
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * marcelolopezdelerma@gmail.com
+ */
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include <basics/Collision_World>
+#include <basics/Headless>
+#include <basics/Sprite_Pool>
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace host;
+using namespace std;
+
+    // Carga que generan los fragmentos de asteroides con muchas más piezas que las del juego: en
+    // cada fotograma se relanza una cuarta parte de ellas (como si se partieran cientos de
+    // asteroides por segundo) y todas pasan por Sprite_Pool::update(), Collision_World::find_pairs()
+    // (chocando entre sí) y Sprite_Pool::render():
+
+BENCHMARK(fragments)
+{
+    static headless::Texture_2D texture(24, 24);
+
+    const unsigned frames = quick ? 20 : 600;
+
+    for (unsigned count : { 256u, 1024u, 4096u })
+    {
+        if (quick && count > 256) break;
+
+        Sprite_Pool                        sprites(count);
+        Collision_World                    world;
+        vector< Sprite_Pool::Handle      > handles;
+        vector< Collision_World::Body_Id > bodies;
+        minstd_rand                        random(count);
+        headless::Canvas                   canvas;
+
+        for (unsigned index = 0; index < count; ++index)
+        {
+            handles.push_back (sprites.create (&texture));
+            bodies .push_back (world.add_body (8, 1 | 2 | 8 | 16));
+        }
+
+        size_t pairs = 0;
+
+        auto start = chrono::steady_clock::now ();
+
+        for (unsigned frame = 0; frame < frames; ++frame)
+        {
+            for (unsigned respawned = 0, index = frame * count / 4 % count; respawned < count / 4; ++respawned, index = (index + 1) % count)
+            {
+                float angle = float(random () % 6283) * 1e-3f;
+
+                handles[index]->set_position ({ float(random () % 1280), float(random () % 720) });
+                handles[index]->set_speed    ({ cos (angle) * 150.f, sin (angle) * 150.f });
+            }
+
+            sprites.update (1.f / 60.f);
+
+            for (unsigned index = 0; index < count; ++index)
+            {
+                world.set_bounds (bodies[index], handles[index]);
+            }
+
+            pairs += world.find_pairs ().size ();
+
+            sprites.render (canvas);
+        }
+
+        string name = "fragments/" + to_string (count);
+
+        report (name.c_str (), "tiempo por fotograma",  seconds_since (start) * 1e3 / frames, "ms");
+        report (name.c_str (), "pares por fotograma",   double(pairs) / frames,               ""  );
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * GAME SIMULATION BENCHMARK
+ * Copyright © 2021+ Marcelo López de lErma
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * marcelolopezdelerma@gmail.com
+ */
+
+#include <string>
+#include <basics/Thread_Pool>
+#include "Game_Simulation.hpp"
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace example;
+using namespace host;
+using namespace std;
+
+namespace
+{
+
+    void report_batch (const char * name, const Game_Simulation::Batch_Results & results)
+    {
+        report (name, "partidas",                 results.instances,                    ""   );
+        report (name, "hilos",                    results.threads,                      ""   );
+        report (name, "pasos por segundo",        results.frames_per_second,            "p/s");
+        report (name, "pasos por segundo e hilo", results.frames_per_second_per_thread, "p/s");
+        report (name, "escalabilidad",            results.scaling,                      "x"  );
+    }
+
+}
+
+    // Partidas headless con bots (Game_Simulation::run_batch()) en un pool con todos los núcleos y
+    // escalabilidad al repartirlas entre 1, 2, 4... hilos (Game_Simulation::measure_scaling()):
+
+BENCHMARK(game_simulation)
+{
+    const unsigned instances = quick ?   4 :   16;
+    const unsigned steps     = quick ? 300 : 6000;
+
+    {
+        Thread_Pool pool;
+
+        report_batch ("sim/batch", Game_Simulation::run_batch (instances, steps, pool, 1234u));
+    }
+
+    for (const Game_Simulation::Batch_Results & results : Game_Simulation::measure_scaling (instances, steps, 1234u, quick ? 2 : 0))
+    {
+        string name = "sim/" + to_string (results.threads) + "-threads";
+
+        report_batch (name.c_str (), results);
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * HEADLESS BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182070
+ */
+
+#include <basics/Director>
+#include <basics/Touch_Event>
+#include "Game_Scene.hpp"
+#include "Menu_Scene.hpp"
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace example;
+using namespace host;
+using namespace std;
+
+namespace
+{
+
+    void measure (const char * name, const shared_ptr< Scene > & scene, unsigned frames, const vector< Director::Scripted_Event > & script)
+    {
+        Director::Benchmark_Results results = director.run_headless (scene, frames, 1.f / 60.f, script);
+
+        report (name, "fotogramas",             results.frames,              ""  );
+        report (name, "update() por fotograma", results.update_ns_per_frame, "ns");
+        report (name, "render() por fotograma", results.render_ns_per_frame, "ns");
+    }
+
+}
+
+    // Tiempo de update() y render() de las escenas del juego sobre el backend nulo. En Game_Scene se
+    // simula un dedo que mantiene pulsada la pantalla y se desplaza de un lado a otro para que la
+    // nave dispare y se mueva mientras aparecen asteroides:
+
+BENCHMARK(headless)
+{
+    const unsigned frames = quick ? 300 : 6000;
+
+    vector< Director::Scripted_Event > script;
+
+    script.push_back ({ 60, Touch_Event{ ID(touch-started), 0, 640.f, 200.f, 0 }.to_event () });
+
+    for (unsigned frame = 64; frame < frames - 1; frame += 4)
+    {
+        float x = (frame / 4) % 2 ? 1040.f : 240.f;
+
+        script.push_back ({ frame, Touch_Event{ ID(touch-moved), 0, x, 200.f, 0 }.to_event () });
+    }
+
+    script.push_back ({ frames - 1, Touch_Event{ ID(touch-ended), 0, 640.f, 200.f, 0 }.to_event () });
+
+    measure ("headless/game", make_shared< Game_Scene > (), frames, script);
+    measure ("headless/menu", make_shared< Menu_Scene > (), frames / 4, {});
+}
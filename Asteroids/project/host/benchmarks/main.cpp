@@ -0,0 +1,67 @@
+/*
+ * BENCHMARKS MAIN
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182065
+ */
+
+#include <cstring>
+#include <basics/enable>
+#include <basics/Headless>
+#include "Benchmark.hpp"
+
+namespace host
+{
+
+    Benchmark * Benchmark::first = nullptr;
+
+}
+
+using namespace host;
+
+    // Uso: asteroids-benchmarks [--quick] [nombre...]
+    // Sin nombres se ejecutan todos los benchmarks. Conviene compilar en Release.
+
+int main (int argc, char * argv[])
+{
+    basics::enable< basics::Headless > ();
+
+    bool quick    = false;
+    int  selected = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp (argv[i], "--quick") == 0) quick = true; else ++selected;
+    }
+
+    int executed = 0;
+
+    for (Benchmark * benchmark = Benchmark::first; benchmark; benchmark = benchmark->next)
+    {
+        bool run = selected == 0;
+
+        for (int i = 1; i < argc && !run; ++i)
+        {
+            run = std::strcmp (argv[i], benchmark->name) == 0;
+        }
+
+        if (run)
+        {
+            benchmark->function (quick);
+            ++executed;
+        }
+    }
+
+    if (executed == 0)
+    {
+        std::fprintf (stderr, "no hay benchmarks que ejecutar\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * MATRIX BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182155
+ */
+
+#include <random>
+#include <basics/Matrix>
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace host;
+using namespace std;
+
+namespace
+{
+
+    // Matrix::operator * tal como era antes de Matrix_Product: accede a los elementos a través de
+    // los proxies Row que retorna operator [] y recorre filas y columnas hacia atrás:
+
+    template< unsigned D >
+    const Matrix< D, D, float > row_proxy_multiply (const Matrix< D, D, float > & a, const Matrix< D, D, float > & b)
+    {
+        Matrix< D, D, float > result;
+
+        for (unsigned r = D; r-- > 0; )
+        {
+            for (unsigned c = D; c-- > 0; )
+            {
+                float total = 0.f;
+
+                for (unsigned index = D; index-- > 0; )
+                {
+                    total += a[r][index] * b[index][c];
+                }
+
+                result[r][c] = total;
+            }
+        }
+
+        return result;
+    }
+
+    // Cadena de productos dependientes, como la que hace Canvas_ES2::apply_transform(). Con -O3
+    // las versiones SSE de 3x3 y 4x4 que tuvo Matrix_Product no mejoraban de forma clara a
+    // ninguno de los dos bucles, por lo que se retiraron:
+
+    template< unsigned D >
+    void measure (const char * name, bool quick)
+    {
+        typedef Matrix< D, D, float > Matrix;
+
+        minstd_rand random(1);
+        uniform_real_distribution< float > value(-1.f, 1.f);
+
+        Matrix a, b;
+
+        for (auto & element : a.values) element = value (random);
+        for (auto & element : b.values) element = value (random);
+
+        const int count = quick ? 100000 : 20000000;
+
+        Matrix accumulated = Matrix::identity;
+
+        auto start = chrono::steady_clock::now ();
+
+        for (int index = 0; index < count; ++index)
+        {
+            accumulated = (index & 1 ? a : b) * accumulated;
+
+            if ((index & 63) == 0) accumulated = Matrix::identity;
+        }
+
+        report (name, "operator *", seconds_since (start) * 1e9 / count, "ns");
+
+        keep (accumulated);
+
+        accumulated = Matrix::identity;
+        start       = chrono::steady_clock::now ();
+
+        for (int index = 0; index < count; ++index)
+        {
+            accumulated = row_proxy_multiply (index & 1 ? a : b, accumulated);
+
+            if ((index & 63) == 0) accumulated = Matrix::identity;
+        }
+
+        report (name, "operator * anterior (Row)", seconds_since (start) * 1e9 / count, "ns");
+
+        keep (accumulated);
+    }
+
+}
+
+BENCHMARK(matrix)
+{
+    measure< 3 > ("matrix/3x3", quick);
+    measure< 4 > ("matrix/4x4", quick);
+}
@@ -0,0 +1,91 @@
+/*
+ * PARTICLES BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182225
+ */
+
+#include <string>
+#include <basics/Headless>
+#include <basics/Particle_Emitter>
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace host;
+using namespace std;
+
+    // Coste por partícula de Particle_Emitter::update() con el emisor lleno (sin bajas), de
+    // update() cuando cada fotograma muere y se vuelve a emitir una parte de las partículas, y de
+    // render(). En el host render() usa el Canvas::fill_particles() genérico del canvas headless
+    // (una llamada a fill_rectangle() por partícula), no el de OpenGL ES.
+
+BENCHMARK(particles)
+{
+    static headless::Texture_2D texture(8, 8);
+
+    const unsigned frames = quick ? 10 : 200;
+
+    for (unsigned count : { 1000u, 20000u, 100000u })
+    {
+        if (quick && count > 20000) break;
+
+        Particle_Emitter::Settings settings;
+
+        settings.texture        = &texture;
+        settings.min_lifetime   = 1000.f;
+        settings.max_lifetime   = 1000.f;
+        settings.acceleration_y = -10.f;
+        settings.drag           = .1f;
+
+        Particle_Emitter emitter(count, settings);
+
+        emitter.emit ({ 640.f, 360.f }, count);
+
+        auto start = chrono::steady_clock::now ();
+
+        for (unsigned frame = 0; frame < frames; ++frame) emitter.update (1.f / 60.f);
+
+        double update_seconds = seconds_since (start);
+
+        headless::Canvas canvas;
+
+        start = chrono::steady_clock::now ();
+
+        for (unsigned frame = 0; frame < frames; ++frame) emitter.render (canvas);
+
+        double render_seconds = seconds_since (start);
+
+        // Vidas de entre 2 y 20 fotogramas: en cada fotograma muere alrededor de una décima parte
+        // de las partículas y se vuelve a llenar el emisor:
+
+        settings.min_lifetime = 2.f  / 60.f;
+        settings.max_lifetime = 20.f / 60.f;
+
+        emitter.set_settings (settings);
+        emitter.clear ();
+        emitter.emit ({ 640.f, 360.f }, count);
+
+        start = chrono::steady_clock::now ();
+
+        for (unsigned frame = 0; frame < frames; ++frame)
+        {
+            emitter.update (1.f / 60.f);
+            emitter.emit   ({ 640.f, 360.f }, count);
+        }
+
+        double churn_seconds = seconds_since (start);
+
+        keep (emitter.size ());
+
+        string name = "particles/" + to_string (count);
+
+        report (name.c_str (), "update() por particula",            update_seconds * 1e9 / frames / count, "ns");
+        report (name.c_str (), "update() + emit() con bajas",       churn_seconds  * 1e9 / frames / count, "ns");
+        report (name.c_str (), "render() por particula (headless)", render_seconds * 1e9 / frames / count, "ns");
+    }
+}
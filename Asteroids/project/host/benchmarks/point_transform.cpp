@@ -0,0 +1,87 @@
+/*
+ * POINT TRANSFORM BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182165
+ */
+
+#include <random>
+#include <vector>
+#include <basics/Affine>
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace host;
+using namespace std;
+
+namespace
+{
+
+    template< typename FUNCTION >
+    void measure (const char * measure, size_t point_count, int repetitions, FUNCTION function)
+    {
+        auto start = chrono::steady_clock::now ();
+
+        for (int repetition = 0; repetition < repetitions; ++repetition) function ();
+
+        report ("point_transform", measure, double(point_count) * repetitions / seconds_since (start) / 1e6, "Mpts/s");
+    }
+
+}
+
+    // Millones de puntos transformados por segundo punto a punto (Affine2f::transform (Point2f)),
+    // en lote con los puntos intercalados (Point2f[]) y en lote con las coordenadas separadas:
+
+BENCHMARK(point_transform)
+{
+    const size_t count       = quick ? 1024 : 4096;
+    const int    repetitions = quick ?   20 : 20000;
+
+    minstd_rand random(1);
+    uniform_real_distribution< float > value(-1000.f, 1000.f);
+
+    vector< Point2f > points(count), output(count);
+    vector< float   > xs(count), ys(count), out_xs(count), out_ys(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        points[index] = { value (random), value (random) };
+        xs    [index] = points[index][0];
+        ys    [index] = points[index][1];
+    }
+
+    Affine2f transform = Affine2f::scale_rotate_then_translate (2.f, 3.f, .5f, { 10.f, 20.f });
+
+    measure
+    (
+        "por punto", count, repetitions, [&]
+        {
+            for (size_t index = 0; index < count; ++index) output[index] = transform.transform (points[index]);
+            keep (output);
+        }
+    );
+
+    measure
+    (
+        "lote intercalado", count, repetitions, [&]
+        {
+            transform.transform (points.data (), output.data (), count);
+            keep (output);
+        }
+    );
+
+    measure
+    (
+        "lote separado", count, repetitions, [&]
+        {
+            transform.transform (xs.data (), ys.data (), out_xs.data (), out_ys.data (), count);
+            keep (out_xs);
+            keep (out_ys);
+        }
+    );
+}
@@ -0,0 +1,98 @@
+/*
+ * RANDOM BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182180
+ */
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <basics/Particle_Emitter>
+#include <basics/Random>
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace host;
+using namespace std;
+
+namespace
+{
+
+    template< typename FUNCTION >
+    void measure_scalar (const char * measure, int count, FUNCTION function)
+    {
+        uint32_t total = 0;
+
+        auto start = chrono::steady_clock::now ();
+
+        for (int index = 0; index < count; ++index) total += function ();
+
+        report ("random/valor", measure, seconds_since (start) * 1e9 / count, "ns");
+
+        keep (total);
+    }
+
+    template< typename FUNCTION >
+    void measure_bulk (const char * measure, size_t value_count, int repetitions, FUNCTION function)
+    {
+        auto start = chrono::steady_clock::now ();
+
+        for (int repetition = 0; repetition < repetitions; ++repetition) function ();
+
+        report ("random/lote", measure, seconds_since (start) * 1e9 / (double(value_count) * repetitions), "ns/valor");
+    }
+
+}
+
+    // Coste por valor de rand(), de los generadores de <random> que usaba el juego y de Random, y
+    // coste por valor de los llenados de Random_Batch y de Particle_Emitter::emit():
+
+BENCHMARK(random)
+{
+    const int count = quick ? 100000 : 50000000;
+
+    srand (1);
+
+    minstd_rand                        minstd(1);
+    mt19937                            mersenne(1);
+    Random                             random(1);
+    uniform_int_distribution< int >    integers(0, 1279);
+    uniform_real_distribution< float > reals(0.f, 1.f);
+
+    measure_scalar ("rand() % 1280",              count, [&] { return uint32_t(rand () % 1280);          });
+    measure_scalar ("minstd_rand + uniform_int",  count, [&] { return uint32_t(integers (minstd));       });
+    measure_scalar ("mt19937 + uniform_int",      count, [&] { return uint32_t(integers (mersenne));     });
+    measure_scalar ("Random::below (1280)",       count, [&] { return random.below (1280);               });
+    measure_scalar ("Random::next",               count, [&] { return random.next ();                    });
+    measure_scalar ("mt19937 + uniform_real",     count, [&] { return uint32_t(reals (mersenne) * 1000); });
+    measure_scalar ("Random::unit",               count, [&] { return uint32_t(random.unit () * 1000);   });
+
+    const size_t size        = 4096;
+    const int    repetitions = quick ? 20 : 20000;
+
+    Random_Batch       batch(1);
+    vector< uint32_t > integers_out(size);
+    vector< float    > xs(size), ys(size);
+
+    measure_bulk ("Random_Batch::fill (uint32)",  size, repetitions, [&] { batch.fill (integers_out.data (), size); keep (integers_out); });
+    measure_bulk ("Random_Batch::fill (float)",   size, repetitions, [&] { batch.fill (xs.data (), size, 0.f, 1280.f); keep (xs); });
+    measure_bulk ("Random_Batch::unit_vectors",   size, repetitions, [&] { batch.fill_unit_vectors (xs.data (), ys.data (), size); keep (xs); keep (ys); });
+    measure_bulk ("bucle de Random::between",     size, repetitions, [&] { for (auto & x : xs) x = random.between (0.f, 1280.f); keep (xs); });
+
+    Particle_Emitter emitter(size);
+
+    measure_bulk
+    (
+        "Particle_Emitter::emit", size, repetitions, [&]
+        {
+            emitter.clear ();
+            emitter.emit ({ 640.f, 360.f }, unsigned(size));
+        }
+    );
+}
@@ -0,0 +1,78 @@
+/*
+ * RASTER FONT BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182200
+ */
+
+#include <string>
+#include <basics/Headless>
+#include <basics/Raster_Font>
+#include <basics/Text_Layout>
+#include <basics/Texture_2D>
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace host;
+using namespace std;
+
+namespace
+{
+
+    template< typename FUNCTION >
+    double measure (int count, FUNCTION function)
+    {
+        float total = 0.f;
+
+        auto start = chrono::steady_clock::now ();
+
+        for (int index = 0; index < count; ++index) total += function (index);
+
+        keep (total);
+
+        return seconds_since (start) * 1e9 / count;
+    }
+
+}
+
+    // Carga de la fuente de prueba (211 glifos) desde XML y desde el formato binario, búsqueda de
+    // glifos por debajo de 256 (array directo) y por encima (búsqueda binaria), y maquetación:
+
+BENCHMARK(raster_font)
+{
+    const int loads   = quick ?   20 :    2000;
+    const int lookups = quick ? 1000 : 50000000;
+    const int layouts = quick ? 1000 :  2000000;
+
+    auto window  = headless::Window::create ({ 1280, 720 });
+    auto context = window->lock_graphics_context ();
+
+    for (const char * path : { HOST_DATA_PATH "/fonts/test.fnt", HOST_DATA_PATH "/fonts/test.bfnt" })
+    {
+        double ns = measure (loads, [&] (int) { return float(Raster_Font(path, context).good ()); });
+
+        report ("raster_font/carga", string(path).substr (string(path).rfind ('/') + 1).c_str (), ns / 1000, "us");
+    }
+
+    // Las dos cargas incluyen la del atlas, que se mide aparte para poder descontarla:
+
+    double atlas_ns = measure (loads, [&] (int) { return float(bool(Texture_2D::create (0, context, HOST_DATA_PATH "/fonts/test.png"))); });
+
+    report ("raster_font/carga", "test.png (solo el atlas)", atlas_ns / 1000, "us");
+
+    Raster_Font font(HOST_DATA_PATH "/fonts/test.bfnt", context);
+
+    const wstring ascii = L"SCORE 0001234567  LIVES 3  LEVEL 12  HI 99999";
+    const wstring latin = L"Puntuación: 1234 — Niveles: señor € «Ñandú»";
+
+    report ("raster_font/glifo", "codigo < 256",  measure (lookups, [&] (int index) { return float(font.get_character (ascii[index % ascii.size ()]) != nullptr); }), "ns");
+    report ("raster_font/glifo", "codigo > 255",  measure (lookups, [&] (int index) { return float(font.get_character (0x2000 + (index & 31)) != nullptr); }), "ns");
+
+    report ("raster_font/texto", "ascii (45 caracteres)", measure (layouts, [&] (int) { return Text_Layout(font, ascii).get_width (); }), "ns");
+    report ("raster_font/texto", "latin (43 caracteres)", measure (layouts, [&] (int) { return Text_Layout(font, latin).get_width (); }), "ns");
+}
@@ -0,0 +1,113 @@
+/*
+ * SHAPES BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182130
+ */
+
+#include <random>
+#include <string>
+#include <vector>
+#include <basics/Shape_Batch>
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace host;
+using namespace std;
+
+namespace
+{
+
+    minstd_rand random_engine(3);
+
+    float random_float (float min, float max)
+    {
+        return uniform_real_distribution< float >(min, max)(random_engine);
+    }
+
+    Circle2f random_circle () { return Circle2f({ random_float (0.f, 1000.f), random_float (0.f, 1000.f) }, random_float (5.f, 60.f)); }
+    Aabb2f   random_aabb   () { return Aabb2f::from_center ({ random_float (0.f, 1000.f), random_float (0.f, 1000.f) }, random_float (5.f, 60.f), random_float (5.f, 60.f)); }
+    Obb2f    random_obb    () { return Obb2f({ random_float (0.f, 1000.f), random_float (0.f, 1000.f) }, random_float (5.f, 60.f), random_float (5.f, 60.f), random_float (0.f, 6.28f)); }
+
+    // Compara query() sobre un lote con la llamada a intersects() para cada forma:
+
+    template< typename QUERY, typename BATCH, typename SHAPE >
+    void measure (const char * name, const QUERY & shape, const BATCH & batch, const vector< SHAPE > & shapes, unsigned repetitions)
+    {
+        vector< uint32_t > output;
+
+        auto start = chrono::steady_clock::now ();
+
+        for (unsigned repetition = 0; repetition < repetitions; ++repetition)
+        {
+            output.clear ();
+
+            query (shape, batch, output);
+
+            keep (output);
+        }
+
+        double batch_seconds = seconds_since (start);
+        size_t hits          = 0;
+
+        start = chrono::steady_clock::now ();
+
+        for (unsigned repetition = 0; repetition < repetitions; ++repetition)
+        {
+            for (const SHAPE & other : shapes) hits += intersects (shape, other);
+
+            keep (hits);
+        }
+
+        double scalar_seconds = seconds_since (start);
+        double tests          = double(shapes.size ()) * repetitions;
+
+        string label = string("shapes/") + name;
+
+        report (label.c_str (), "query() por lote",       tests / batch_seconds  * 1e-6, "M/s");
+        report (label.c_str (), "intersects() una a una", tests / scalar_seconds * 1e-6, "M/s");
+    }
+
+}
+
+    // Pruebas de intersección de una forma contra 4099 (no múltiplo de 4, para incluir la cola
+    // escalar de los kernels SIMD) de cada tipo:
+
+BENCHMARK(shapes)
+{
+    const unsigned count       = 4099;
+    const unsigned repetitions = quick ? 10 : 2000;
+
+    Circle_Batch       circle_batch;
+    Aabb_Batch         aabb_batch;
+    Obb_Batch          obb_batch;
+    vector< Circle2f > circles;
+    vector< Aabb2f   > aabbs;
+    vector< Obb2f    > obbs;
+
+    for (unsigned index = 0; index < count; ++index)
+    {
+        circles.push_back (random_circle ()); circle_batch.push_back (circles.back ());
+        aabbs  .push_back (random_aabb   ()); aabb_batch  .push_back (aabbs  .back ());
+        obbs   .push_back (random_obb    ()); obb_batch   .push_back (obbs   .back ());
+    }
+
+    Circle2f circle({ 500.f, 500.f }, 200.f);
+    Aabb2f   aabb = Aabb2f::from_center ({ 500.f, 500.f }, 150.f, 100.f);
+    Obb2f    obb  ({ 500.f, 500.f }, 150.f, 100.f, 0.6f);
+
+    measure ("circle/circle", circle, circle_batch, circles, repetitions);
+    measure ("circle/aabb",   circle, aabb_batch,   aabbs,   repetitions);
+    measure ("circle/obb",    circle, obb_batch,    obbs,    repetitions);
+    measure ("aabb/circle",   aabb,   circle_batch, circles, repetitions);
+    measure ("aabb/aabb",     aabb,   aabb_batch,   aabbs,   repetitions);
+    measure ("aabb/obb",      aabb,   obb_batch,    obbs,    repetitions);
+    measure ("obb/circle",    obb,    circle_batch, circles, repetitions);
+    measure ("obb/aabb",      obb,    aabb_batch,   aabbs,   repetitions);
+    measure ("obb/obb",       obb,    obb_batch,    obbs,    repetitions);
+}
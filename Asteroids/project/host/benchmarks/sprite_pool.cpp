@@ -0,0 +1,67 @@
+/*
+ * SPRITE POOL BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182105
+ */
+
+#include <string>
+#include <vector>
+#include <basics/Headless>
+#include <basics/Sprite_Pool>
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace host;
+using namespace std;
+
+    // Coste de Sprite_Pool::update() (kernel SIMD sobre los arrays) y de render() (agrupando los
+    // sprites por textura) con un tercio de los sprites ocultos:
+
+BENCHMARK(sprite_pool)
+{
+    static headless::Texture_2D textures[] = { { 8, 8 }, { 16, 16 } };
+
+    const unsigned frames = quick ? 10 : 200;
+
+    for (unsigned count : { 10u, 100u, 1000u, 10000u, 100000u })
+    {
+        if (quick && count > 1000) break;
+
+        Sprite_Pool pool(count);
+
+        for (unsigned index = 0; index < count; ++index)
+        {
+            Sprite_Pool::Handle sprite = pool.create (&textures[index / 64 % 2]);
+
+            sprite->set_position ({ float(index % 1280), float(index % 720) });
+            sprite->set_speed    ({ 1.f, 2.f });
+
+            if (index % 3 == 0) sprite->hide ();
+        }
+
+        headless::Canvas canvas;
+
+        auto start = chrono::steady_clock::now ();
+
+        for (unsigned frame = 0; frame < frames; ++frame) pool.update (1.f / 60.f);
+
+        double update_seconds = seconds_since (start);
+
+        start = chrono::steady_clock::now ();
+
+        for (unsigned frame = 0; frame < frames; ++frame) pool.render (canvas);
+
+        double render_seconds = seconds_since (start);
+
+        string name = "sprite_pool/" + to_string (count);
+
+        report (name.c_str (), "update() por sprite", update_seconds * 1e9 / frames / count, "ns");
+        report (name.c_str (), "render() por sprite", render_seconds * 1e9 / frames / count, "ns");
+    }
+}
@@ -0,0 +1,134 @@
+/*
+ * SPSC CONTENTION BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182085
+ */
+
+#include <thread>
+#include <basics/Event_Queue>
+#include <basics/Spsc_Queue>
+#include <basics/Touch_Event>
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace host;
+using namespace std;
+
+namespace
+{
+
+    typedef Spsc_Queue< Touch_Event, 512 > Touch_Queue;
+
+    // Un hilo produce eventos táctiles (un touch-started y un touch-ended cada 16) mientras el hilo
+    // actual los consume por lotes, como hacen el hilo de entrada y el Director:
+
+    Touch_Event make_touch (unsigned index)
+    {
+        Id id = index % 16 == 0 ? ID(touch-started) : index % 16 == 15 ? ID(touch-ended) : ID(touch-moved);
+
+        return Touch_Event{ id, int32_t(index % 10), float(index), float(index), int64_t(index) };
+    }
+
+    void measure_spsc (const char * name, unsigned count, Touch_Queue::Overflow_Policy policy, unsigned consumer_pause)
+    {
+        Touch_Queue queue(policy);
+        unsigned    edges_sent     = 0;
+        unsigned    edges_received = 0;
+        unsigned    received       = 0;
+
+        auto start = chrono::steady_clock::now ();
+
+        thread producer
+        (
+            [&] ()
+            {
+                for (unsigned index = 0; index < count; ++index)
+                {
+                    Touch_Event touch = make_touch (index);
+                    bool        edge  = touch.id != ID(touch-moved);
+
+                    // Como en Director::handle(): los toques que empiezan o terminan esperan:
+
+                    queue.push (std::move (touch), edge ? Touch_Queue::WAIT : policy);
+
+                    if (edge) ++edges_sent;
+                }
+            }
+        );
+
+        Touch_Event batch[32];
+
+        while (received + queue.get_dropped_count () < count)
+        {
+            size_t batch_count = queue.poll (batch, 32);
+
+            for (size_t index = 0; index < batch_count; ++index)
+            {
+                if (batch[index].id != ID(touch-moved)) ++edges_received;
+            }
+
+            received += unsigned(batch_count);
+
+            // El consumidor no acapara el procesador mientras no hay eventos (el Director tampoco):
+
+            if (batch_count == 0) this_thread::yield ();
+
+            for (unsigned pause = 0; pause < consumer_pause; ++pause) keep (pause);
+        }
+
+        producer.join ();
+
+        double seconds = seconds_since (start);
+
+        report (name, "eventos por segundo",         count / seconds,                   "ev/s");
+        report (name, "movimientos descartados",     double(queue.get_dropped_count ()), ""    );
+        report (name, "inicios y finales perdidos",  double(edges_sent - edges_received), ""    );
+    }
+
+    void measure_mutex (const char * name, unsigned count)
+    {
+        Event_Queue queue;
+        unsigned    received = 0;
+
+        auto start = chrono::steady_clock::now ();
+
+        thread producer
+        (
+            [&] ()
+            {
+                for (unsigned index = 0; index < count; ++index)
+                {
+                    queue.push (make_touch (index).to_event ());
+                }
+            }
+        );
+
+        Event event;
+
+        while (received < count)
+        {
+            if (queue.poll (event)) ++received; else this_thread::yield ();
+        }
+
+        producer.join ();
+
+        report (name, "eventos por segundo", count / seconds_since (start), "ev/s");
+    }
+
+}
+
+BENCHMARK(spsc_contention)
+{
+    const unsigned count = quick ? 20000 : 2000000;
+
+    measure_spsc  ("spsc/wait",         count, Touch_Queue::WAIT,    0);
+    measure_spsc  ("spsc/discard",      count, Touch_Queue::DISCARD, 0);
+    measure_spsc  ("spsc/discard-slow", count, Touch_Queue::DISCARD, 200);
+    measure_mutex ("event_queue/mutex", count);
+}
@@ -0,0 +1,69 @@
+/*
+ * TEXT BENCHMARK
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182190
+ */
+
+#include <string>
+#include <vector>
+#include <basics/Headless>
+#include <basics/Raster_Font>
+#include <basics/Text_Layout_Cache>
+#include "Benchmark.hpp"
+
+using namespace basics;
+using namespace host;
+using namespace std;
+
+namespace
+{
+
+    template< typename FUNCTION >
+    void measure (const char * measure, int count, FUNCTION function)
+    {
+        float total = 0.f;
+
+        auto start = chrono::steady_clock::now ();
+
+        for (int index = 0; index < count; ++index) total += function (index);
+
+        report ("text", measure, seconds_since (start) * 1e9 / count, "ns");
+
+        keep (total);
+    }
+
+}
+
+    // Coste en la CPU de maquetar un texto del HUD en cada fotograma frente a sacarlo de un
+    // Text_Layout_Cache cuando se repite, cuando la caché es pequeña para los textos que rotan y
+    // cuando el texto cambia en cada fotograma (siempre falla, por lo que esos textos no deben
+    // pasar por la caché):
+
+BENCHMARK(text)
+{
+    const int count = quick ? 10000 : 2000000;
+
+    auto window  = headless::Window::create ({ 1280, 720 });
+    auto context = window->lock_graphics_context ();
+
+    Raster_Font font(HOST_DATA_PATH "/fonts/test.fnt", context);
+
+    vector< wstring > texts, counters;
+
+    for (int index = 0; index <    8; ++index) texts   .push_back (L"SCORE " + to_wstring (123450 + index * 7) + L"  LIVES 3");
+    for (int index = 0; index < 4096; ++index) counters.push_back (L"SCORE " + to_wstring (index));
+
+    Text_Layout_Cache cache(16), small_cache(4);
+
+    measure ("maquetar cada fotograma",   count, [&] (int index) { return Text_Layout(font, texts[index & 7]).get_width (); });
+    measure ("cache (acierto)",           count, [&] (int index) { return cache      .get (font, texts[index & 7]).get_width (); });
+    measure ("cache de 4 con 8 textos",   count, [&] (int index) { return small_cache.get (font, texts[index & 7]).get_width (); });
+    measure ("texto cambiante con cache", count, [&] (int index) { return cache      .get (font, counters[index & 4095]).get_width (); });
+    measure ("texto cambiante sin cache", count, [&] (int index) { return Text_Layout(font, counters[index & 4095]).get_width (); });
+}
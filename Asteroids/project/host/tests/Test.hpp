@@ -0,0 +1,77 @@
+/*
+ * TEST
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182050
+ */
+
+#ifndef HOST_TEST_HEADER
+#define HOST_TEST_HEADER
+
+    #include <cstdio>
+
+    namespace host
+    {
+
+        /**
+         * Registro mínimo de pruebas. Cada prueba pertenece a un grupo, que coincide con el nombre del
+         * archivo de tests/ que la define y con el nombre con el que se registra en CTest.
+         */
+        struct Test
+        {
+            typedef void (* Function) ();
+
+            const char * group;
+            const char * name;
+            Function     function;
+            Test       * next;
+
+            static Test * first;
+            static int    failures;
+
+            Test(const char * group, const char * name, Function function)
+            :
+                group(group), name(name), function(function), next(first)
+            {
+                first = this;
+            }
+
+            static void fail (const char * file, int line, const char * expression)
+            {
+                std::fprintf (stderr, "%s:%d: falla: %s\n", file, line, expression);
+                ++failures;
+            }
+        };
+
+    }
+
+    #define HOST_TEST_CONCAT_(A, B) A##B
+    #define HOST_TEST_CONCAT(A, B)  HOST_TEST_CONCAT_(A, B)
+
+    /**
+     * Define una prueba: TEST(grupo, nombre) { ... }
+     */
+    #define TEST(GROUP, NAME)                                                                       \
+        static void HOST_TEST_CONCAT(GROUP##_, NAME) ();                                            \
+        static host::Test HOST_TEST_CONCAT(GROUP##_##NAME, _test)                                   \
+            (#GROUP, #NAME, HOST_TEST_CONCAT(GROUP##_, NAME));                                      \
+        static void HOST_TEST_CONCAT(GROUP##_, NAME) ()
+
+    /**
+     * Comprueba una condición. Si no se cumple, informa y la prueba sigue (la falla se cuenta).
+     */
+    #define CHECK(EXPRESSION)                                                                       \
+        do { if (!(EXPRESSION)) host::Test::fail (__FILE__, __LINE__, #EXPRESSION); } while (false)
+
+    /**
+     * Comprueba una condición y, si no se cumple, termina la prueba actual.
+     */
+    #define REQUIRE(EXPRESSION)                                                                     \
+        do { if (!(EXPRESSION)) { host::Test::fail (__FILE__, __LINE__, #EXPRESSION); return; } } while (false)
+
+#endif
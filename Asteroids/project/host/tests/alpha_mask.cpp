@@ -0,0 +1,220 @@
+/*
+ * ALPHA MASK TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182215
+ */
+
+#include <cmath>
+#include <basics/Alpha_Mask>
+#include <basics/Random>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    typedef Color_Buffer< Rgba8888 > Image;
+
+    // La fila 0 de la imagen es la de arriba. El alfa es el cuarto byte de cada píxel:
+
+    void set_alpha (Image & image, unsigned x, unsigned y, uint8_t alpha)
+    {
+        reinterpret_cast< uint8_t * >(image.buffer.data ())[(size_t(y) * image.get_width () + x) * 4 + 3] = alpha;
+    }
+
+    Image random_image (Random & random, unsigned width, unsigned height, float density)
+    {
+        Image image(width, height);
+
+        for (unsigned y = 0; y < height; ++y)
+            for (unsigned x = 0; x < width; ++x)
+                set_alpha (image, x, y, random.chance (density) ? 255 : 0);
+
+        return image;
+    }
+
+    Image solid_image (unsigned width, unsigned height)
+    {
+        Image image(width, height);
+
+        for (unsigned y = 0; y < height; ++y)
+            for (unsigned x = 0; x < width; ++x)
+                set_alpha (image, x, y, 255);
+
+        return image;
+    }
+
+    // Recorre uno a uno los bits de a y muestrea b en el centro de cada uno:
+
+    unsigned brute_force_count
+    (
+        const Alpha_Mask & a, float a_left, float a_bottom, float a_width, float a_height,
+        const Alpha_Mask & b, float b_left, float b_bottom, float b_width, float b_height
+    )
+    {
+        float a_cell_width  = a_width  * a.get_reduction () / a.get_image_width  ();
+        float a_cell_height = a_height * a.get_reduction () / a.get_image_height ();
+        float b_cell_width  = b_width  * b.get_reduction () / b.get_image_width  ();
+        float b_cell_height = b_height * b.get_reduction () / b.get_image_height ();
+
+        unsigned total = 0;
+
+        for (unsigned row = 0; row < a.get_height (); ++row)
+        {
+            for (unsigned column = 0; column < a.get_width (); ++column)
+            {
+                if (!a.test (column, row)) continue;
+
+                int b_column = int(floor ((a_left   + (column + .5f) * a_cell_width  - b_left  ) / b_cell_width ));
+                int b_row    = int(floor ((a_bottom + (row    + .5f) * a_cell_height - b_bottom) / b_cell_height));
+
+                if (b_column >= 0 && b_row >= 0 && b.test (unsigned(b_column), unsigned(b_row))) ++total;
+            }
+        }
+
+        return total;
+    }
+
+    // Compara overlap_count() con la fuerza bruta colocando b en varias posiciones alrededor de a.
+    // Los desplazamientos son múltiplos enteros de la celda de a para que los centros nunca caigan
+    // justo en el borde de un bit de b.
+
+    bool matches_brute_force (const Alpha_Mask & a, float a_scale, const Alpha_Mask & b, float b_scale, int step)
+    {
+        float a_width  = a.get_image_width  () * a_scale, a_height = a.get_image_height () * a_scale;
+        float b_width  = b.get_image_width  () * b_scale, b_height = b.get_image_height () * b_scale;
+        bool  matches  = true;
+        int   hits     = 0;
+
+        for (int dy = -int(b_height) - 2; dy <= int(a_height) + 2; dy += 3)
+        {
+            for (int dx = -int(b_width) - 2; dx <= int(a_width) + 2; dx += step)
+            {
+                float x = dx * a_scale, y = dy * a_scale;
+
+                unsigned expected = brute_force_count (a, 0, 0, a_width, a_height, b, x, y, b_width, b_height);
+                unsigned actual   = Alpha_Mask::overlap_count (a, 0, 0, a_width, a_height, b, x, y, b_width, b_height);
+                bool     touch    = Alpha_Mask::overlap       (a, 0, 0, a_width, a_height, b, x, y, b_width, b_height);
+
+                matches = matches && actual == expected && touch == (expected > 0);
+
+                if (expected) ++hits;
+            }
+        }
+
+        return matches && hits > 0;
+    }
+
+}
+
+TEST(alpha_mask, rows_start_at_the_bottom_of_the_image)
+{
+    Image image(3, 2);
+
+    set_alpha (image, 0, 0, 255);                               // Arriba a la izquierda.
+    set_alpha (image, 2, 1, 128);                               // Abajo a la derecha, justo en el umbral.
+    set_alpha (image, 1, 1, 127);                               // Por debajo del umbral.
+
+    Alpha_Mask mask(image);
+
+    CHECK(mask.get_width () == 3 && mask.get_height () == 2);
+    CHECK(mask.test (0, 1));
+    CHECK(mask.test (2, 0));
+    CHECK(!mask.test (1, 0));
+    CHECK(!mask.test (0, 0));
+    CHECK(!mask.test (3, 0) && !mask.test (0, 2));              // Fuera de la máscara.
+    CHECK(mask.count () == 2);
+
+    CHECK(Alpha_Mask(image, 1, 127).count () == 3);
+}
+
+TEST(alpha_mask, reduction_marks_a_block_if_any_pixel_is_solid)
+{
+    Image image(5, 5);
+
+    set_alpha (image, 4, 4, 255);                               // Abajo a la derecha: bloque incompleto.
+    set_alpha (image, 1, 0, 255);                               // Arriba.
+    set_alpha (image, 2, 2, 255);
+
+    Alpha_Mask mask(image, 2);
+
+    CHECK(mask.get_reduction () == 2);
+    CHECK(mask.get_width () == 3 && mask.get_height () == 3);
+    CHECK(mask.get_image_width () == 5 && mask.get_image_height () == 5);
+    CHECK(mask.test (2, 0));
+    CHECK(mask.test (0, 2));
+    CHECK(mask.test (1, 1));
+    CHECK(mask.count () == 3);
+
+    Alpha_Mask wide(solid_image (130, 1), 3);                   // Varias palabras por fila.
+
+    CHECK(wide.get_width () == 44);
+    CHECK(wide.count () == 44);
+    CHECK(!wide.test (44, 0));
+
+    CHECK(Alpha_Mask(solid_image (4, 4), 0).get_reduction () == 1);
+}
+
+TEST(alpha_mask, empty_masks_never_overlap)
+{
+    Alpha_Mask empty;
+    Alpha_Mask solid(solid_image (8, 8));
+
+    CHECK(empty.empty () && empty.count () == 0);
+    CHECK(Alpha_Mask(Image()).empty ());
+    CHECK(Alpha_Mask::overlap_count (empty, 0, 0, 8, 8, solid, 0, 0, 8, 8) == 0);
+    CHECK(Alpha_Mask::overlap_count (solid, 0, 0, 8, 8, empty, 0, 0, 8, 8) == 0);
+    CHECK(Alpha_Mask::overlap_count (solid, 0, 0, 8, 8, solid, 8, 0, 8, 8) == 0);   // Solo se tocan los bordes.
+}
+
+TEST(alpha_mask, solid_masks_count_the_intersection)
+{
+    Alpha_Mask a(solid_image (100, 10));
+    Alpha_Mask b(solid_image (100, 10));
+
+    CHECK(Alpha_Mask::overlap_count (a, 0, 0, 100, 10, b,  70,  3, 100, 10) == 30 * 7);
+    CHECK(Alpha_Mask::overlap_count (a, 0, 0, 100, 10, b, -70, -3, 100, 10) == 30 * 7);
+    CHECK(Alpha_Mask::overlap_count (a, 0, 0, 100, 10, b,  10,  0,  50, 10) == 50 * 10);
+    CHECK(Alpha_Mask::overlap_count (a, 0, 0, 100, 10, b,  10,  0, 100, 10, true) == 1);
+}
+
+TEST(alpha_mask, equal_cells_match_brute_force)
+{
+    Random random(41);
+
+    Alpha_Mask a(random_image (random, 150, 12, .4f));          // Tres palabras por fila.
+    Alpha_Mask b(random_image (random,  90,  9, .4f));
+
+    // Desplazamientos negativos, que cruzan palabras y que dejan la intersección a mitad de palabra:
+
+    CHECK(matches_brute_force (a, 1.f, b, 1.f, 1));
+    CHECK(matches_brute_force (b, 1.f, a, 1.f, 1));
+    CHECK(matches_brute_force (a, 2.f, b, 2.f, 1));             // Ambos estirados por igual.
+
+    Alpha_Mask reduced_a(random_image (random, 300, 24, .2f), 2);
+    Alpha_Mask reduced_b(random_image (random, 180, 18, .2f), 2);
+
+    CHECK(matches_brute_force (reduced_a, 1.f, reduced_b, 1.f, 2));
+}
+
+TEST(alpha_mask, unequal_cells_match_brute_force)
+{
+    Random random(43);
+
+    Alpha_Mask a(random_image (random, 150, 12, .4f));
+    Alpha_Mask b(random_image (random,  45,  6, .5f));
+    Alpha_Mask reduced(random_image (random, 120, 16, .3f), 4);
+
+    CHECK(matches_brute_force (a, 1.f, b, 2.f,  1));            // b se dibuja al doble de su tamaño.
+    CHECK(matches_brute_force (b, 2.f, a, 1.f,  1));
+    CHECK(matches_brute_force (a, 1.f, reduced, 1.f, 1));       // Misma escala pero distinta reducción.
+    CHECK(matches_brute_force (reduced, 1.f, a, 1.f, 1));
+}
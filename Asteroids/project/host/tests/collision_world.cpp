@@ -0,0 +1,139 @@
+/*
+ * COLLISION WORLD TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182120
+ */
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+#include <basics/Collision_World>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    typedef set< pair< Collision_World::Body_Id, Collision_World::Body_Id > > Pair_Set;
+
+    Pair_Set collect (Collision_World & world)
+    {
+        Pair_Set pairs;
+
+        world.for_each_pair
+        (
+            [&] (Collision_World::Body_Id a, Collision_World::Body_Id b)
+            {
+                pairs.insert (make_pair (min (a, b), max (a, b)));
+            }
+        );
+
+        return pairs;
+    }
+
+}
+
+TEST(collision_world, matches_brute_force_while_bodies_move)
+{
+    const unsigned count = 400;
+    const float    size  = 16.f;
+
+    minstd_rand random(7);
+
+    vector< float > x(count), y(count), widths(count);
+
+    Collision_World world(32.f);
+
+    for (unsigned index = 0; index < count; ++index)
+    {
+        x     [index] = float(random () % 800);
+        y     [index] = float(random () % 800);
+        widths[index] = index % 10 == 0 ? 100.f : size;            // Algunos ocupan varias celdas.
+
+        world.add_body (1, 1, index);
+    }
+
+    bool   same_pairs  = true;
+    size_t total_pairs = 0;
+
+    for (unsigned frame = 0; frame < 20; ++frame)
+    {
+        for (unsigned index = 0; index < count; ++index)
+        {
+            x[index] += float(int(random () % 21) - 10);
+            y[index] += float(int(random () % 21) - 10);
+
+            world.set_bounds (index, x[index], y[index], x[index] + widths[index], y[index] + size);
+        }
+
+        Pair_Set expected;
+
+        for (unsigned a = 0; a < count; ++a)
+        {
+            for (unsigned b = a + 1; b < count; ++b)
+            {
+                if (!(x[b] >= x[a] + widths[a] || x[b] + widths[b] <= x[a] || y[b] >= y[a] + size || y[b] + size <= y[a]))
+                {
+                    expected.insert (make_pair (a, b));
+                }
+            }
+        }
+
+        Pair_Set found = collect (world);
+
+        same_pairs  &= found == expected;
+        total_pairs += found.size ();
+    }
+
+    CHECK(same_pairs);
+    CHECK(total_pairs > 0);
+    CHECK(world.find_pairs ().size () == collect (world).size ());     // Sin pares repetidos.
+}
+
+TEST(collision_world, filters_by_layer_and_mask)
+{
+    Collision_World world;
+
+    Collision_World::Body_Id ship     = world.add_body (1, 2);
+    Collision_World::Body_Id asteroid = world.add_body (2, 1 | 2);
+    Collision_World::Body_Id ghost    = world.add_body (4, 1);          // Su capa no está en la máscara de ship.
+
+    for (Collision_World::Body_Id body : { ship, asteroid, ghost }) world.set_bounds (body, 0.f, 0.f, 10.f, 10.f);
+
+    Pair_Set pairs = collect (world);
+
+    CHECK(pairs.size () == 1);
+    CHECK(pairs.count (make_pair (min (ship, asteroid), max (ship, asteroid))) == 1);
+}
+
+TEST(collision_world, disabled_bodies_do_not_collide)
+{
+    Collision_World world;
+
+    Collision_World::Body_Id a = world.add_body (1, 1);
+    Collision_World::Body_Id b = world.add_body (1, 1);
+
+    world.set_bounds (a, 0.f, 0.f, 10.f, 10.f);
+    world.set_bounds (b, 5.f, 5.f, 15.f, 15.f);
+
+    CHECK(world.find_pairs ().size () == 1);
+
+    world.set_enabled (b, false);
+
+    CHECK(world.find_pairs ().empty ());
+
+    vector< Collision_World::Body_Id > found;
+
+    CHECK(world.query (0.f, 0.f, 20.f, 20.f, 1, found) == 1);
+    CHECK(found.size () == 1 && found[0] == a);
+}
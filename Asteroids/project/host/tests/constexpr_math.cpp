@@ -0,0 +1,92 @@
+/*
+ * CONSTEXPR MATH TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182170
+ */
+
+#include <basics/Affine>
+#include <basics/Matrix>
+#include <basics/Transformation>
+#include "Test.hpp"
+
+using namespace basics;
+
+namespace
+{
+
+    // Si alguna de estas expresiones dejase de ser constexpr el archivo no compilaría:
+
+    constexpr Point2f   point  { 3.f, 4.f };
+    constexpr Vector2f  vector { 1.f, 2.f };
+    constexpr Affine2f  affine = Affine2f::scale_then_translate (2.f, { 10.f, 20.f }) * Affine2f::translation ({ 1.f, 1.f });
+    constexpr Point2f   transformed_point  = affine.transform (point);
+    constexpr Vector2f  transformed_vector = affine.transform (vector);
+
+    static_assert(point[0] == 3.f && point[1] == 4.f,                     "constexpr Point2f");
+    static_assert(vector[0] == 1.f && vector[1] == 2.f,                   "constexpr Vector2f");
+    static_assert(affine.values[2] == 12.f && affine.values[5] == 22.f,   "constexpr Affine2f composition");
+    static_assert(affine.determinant () == 4.f,                           "constexpr Affine2f::determinant");
+    static_assert(transformed_point [0] == 18.f,                          "constexpr Affine2f::transform (Point2f)");
+    static_assert(transformed_vector[1] ==  4.f,                          "constexpr Affine2f::transform (Vector2f)");
+
+    template< unsigned M, unsigned N >
+    bool is_identity (const Matrix< M, N, float > & matrix)
+    {
+        for (unsigned row = 0; row < M; ++row)
+        {
+            for (unsigned column = 0; column < N; ++column)
+            {
+                if (matrix.values[row * N + column] != (row == column ? 1.f : 0.f)) return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Estas copias se hacen durante la inicialización dinámica de este archivo. Como Matrix::identity
+    // se inicializa en la fase constante (antes que cualquier inicialización dinámica), ya tiene su
+    // valor aunque su definición se instancie en este mismo archivo sin orden garantizado:
+
+    Matrix33f copy_of_identity_33 (const Matrix33f & matrix) { return matrix; }
+    Matrix44f copy_of_identity_44 (const Matrix44f & matrix) { return matrix; }
+
+    const Matrix33f early_identity_33 = copy_of_identity_33 (Matrix33f::identity);
+    const Matrix44f early_identity_44 = copy_of_identity_44 (Matrix44f::identity);
+
+}
+
+TEST(constexpr_math, identity_has_its_value_during_dynamic_initialization)
+{
+    CHECK(is_identity (early_identity_33));
+    CHECK(is_identity (early_identity_44));
+}
+
+TEST(constexpr_math, identity_values)
+{
+    CHECK(is_identity (Matrix22f::identity));
+    CHECK(is_identity (Matrix33f::identity));
+    CHECK(is_identity (Matrix44f::identity));
+    CHECK(is_identity (Transformation2f().matrix));
+}
+
+TEST(constexpr_math, runtime_results_match_compile_time_results)
+{
+    volatile float scale = 2.f;
+
+    Affine2f runtime = Affine2f::scale_then_translate (scale, { 10.f, 20.f }) * Affine2f::translation ({ 1.f, 1.f });
+
+    bool same = true;
+
+    for (unsigned index = 0; index < 6; ++index)
+    {
+        same = same && runtime.values[index] == affine.values[index];
+    }
+
+    CHECK(same);
+}
@@ -0,0 +1,232 @@
+/*
+ * DIRECTOR TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182080
+ */
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <basics/Director>
+#include <basics/Scene>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    struct Empty_Scene : public Scene
+    {
+        Size2u get_view_size () override
+        {
+            return { 64, 64 };
+        }
+    };
+
+    // Escena que guarda los toques recibidos en cada fotograma y, en update(), las muestras de la
+    // trayectoria de los dedos 0 y 1:
+
+    struct Touch_Recorder : public Scene
+    {
+        vector< vector< Touch_Event > >              touches { 1 };
+        vector< vector< Director::Touch_Sample > >   samples [2];
+
+        Size2u get_view_size () override
+        {
+            return { 64, 64 };
+        }
+
+        void handle_touch (Touch_Event & touch) override
+        {
+            touches.back ().push_back (touch);
+        }
+
+        void update (float ) override
+        {
+            for (int32_t pointer = 0; pointer < 2; ++pointer)
+            {
+                const Director::Touch_Sample * first = nullptr;
+                unsigned                       count = director.get_touch_samples (pointer, first);
+
+                samples[pointer].emplace_back (first, first + count);
+            }
+
+            touches.emplace_back ();
+        }
+
+        // Toques del dedo indicado entregados en un fotograma, en orden de llegada:
+
+        vector< Touch_Event > touches_of (unsigned frame, int32_t pointer) const
+        {
+            vector< Touch_Event > result;
+
+            for (auto & touch : touches[frame]) if (touch.pointer == pointer) result.push_back (touch);
+
+            return result;
+        }
+    };
+
+    // Las marcas de tiempo son recientes (del mismo reloj que usa el Director) para no registrar
+    // latencias absurdas:
+
+    const int64_t base_time = chrono::duration_cast< chrono::nanoseconds > (chrono::steady_clock::now ().time_since_epoch ()).count ();
+
+    Director::Scripted_Event touch_at (unsigned frame, Id id, int32_t pointer, float x, int64_t time)
+    {
+        return Director::Scripted_Event{ frame, Touch_Event{ id, pointer, x, x, base_time + time }.to_event () };
+    }
+
+    // Ejecuta otra escena unos fotogramas cada vez hasta que la escena indicada queda precargada:
+
+    void run_until_preloaded (const shared_ptr< Scene > & scene)
+    {
+        for (unsigned attempt = 0; attempt < 1000 && !scene->is_preloaded (); ++attempt)
+        {
+            director.run_headless (make_shared< Empty_Scene > (), 2);
+
+            this_thread::sleep_for (chrono::milliseconds(1));
+        }
+    }
+
+}
+
+TEST(director, releases_preloads_of_scenes_that_never_run)
+{
+    shared_ptr< Scene > unused = make_shared< Empty_Scene > ();
+
+    director.preload_scene (unused);
+
+    run_until_preloaded (unused);
+
+    CHECK(unused->is_preloaded ());
+    CHECK(unused.use_count () == 1);
+}
+
+TEST(director, releases_preloads_of_evicted_scenes)
+{
+    shared_ptr< Scene > cached = make_shared< Empty_Scene > ();
+
+    director.cache_scene   (ID(cached), cached);
+    director.preload_scene (cached);
+    director.evict_scene   (ID(cached));
+
+    run_until_preloaded (cached);
+
+    CHECK(cached->is_preloaded ());
+    CHECK(cached.use_count () == 1);
+}
+
+TEST(director, coalesces_moves_into_one_per_pointer_and_frame)
+{
+    shared_ptr< Touch_Recorder > scene = make_shared< Touch_Recorder > ();
+
+    director.run_headless
+    (
+        scene, 3, 1.f / 60.f,
+        {
+            touch_at (0, ID(touch-started), 0, 0.f, 0),
+            touch_at (0, ID(touch-started), 1, 0.f, 1),
+            touch_at (1, ID(touch-moved  ), 0, 1.f, 2),
+            touch_at (1, ID(touch-moved  ), 1, 5.f, 3),
+            touch_at (1, ID(touch-moved  ), 0, 2.f, 4),
+            touch_at (1, ID(touch-moved  ), 0, 3.f, 5),
+            touch_at (1, ID(touch-moved  ), 1, 6.f, 6),
+        }
+    );
+
+    REQUIRE(scene->touches.size () >= 3);
+
+    vector< Touch_Event > first  = scene->touches_of (1, 0);
+    vector< Touch_Event > second = scene->touches_of (1, 1);
+
+    REQUIRE(first.size () == 1 && second.size () == 1);
+
+    CHECK(first [0].id == ID(touch-moved) && first [0].x == 3.f && first [0].timestamp == base_time + 5);
+    CHECK(second[0].id == ID(touch-moved) && second[0].x == 6.f && second[0].timestamp == base_time + 6);
+    CHECK(scene->touches[1].size () == 2);
+    CHECK(scene->touches[2].empty ());
+}
+
+TEST(director, touch_samples_keep_the_latest_ones_in_time_order)
+{
+    shared_ptr< Touch_Recorder > scene = make_shared< Touch_Recorder > ();
+    vector< Director::Scripted_Event > script;
+
+    for (int index = 0; index < 20; ++index)
+    {
+        script.push_back (touch_at (0, ID(touch-moved), 0, float(index), index));
+    }
+
+    director.run_headless (scene, 2, 1.f / 60.f, script);
+
+    REQUIRE(scene->samples[0].size () == 2);
+
+    const vector< Director::Touch_Sample > & samples = scene->samples[0][0];
+
+    CHECK(samples.size () == Director::max_touch_samples);
+
+    bool ordered = true;
+
+    for (size_t index = 0; index < samples.size (); ++index)
+    {
+        int64_t expected = int64_t(20 - Director::max_touch_samples + index);
+
+        ordered = ordered && samples[index].time == base_time + expected && samples[index].x == float(expected);
+    }
+
+    CHECK(ordered);
+    CHECK(scene->samples[1][0].empty ());                       // El dedo 1 no se ha movido.
+    CHECK(scene->samples[0][1].empty ());                       // Solo se conservan las del último fotograma.
+    CHECK(scene->touches_of (0, 0).size () == 1);
+}
+
+TEST(director, pending_moves_are_delivered_before_other_touches_of_the_pointer)
+{
+    shared_ptr< Touch_Recorder > scene = make_shared< Touch_Recorder > ();
+
+    director.run_headless
+    (
+        scene, 2, 1.f / 60.f,
+        {
+            touch_at (0, ID(touch-moved  ), 0, 1.f, 0),
+            touch_at (0, ID(touch-started), 1, 5.f, 1),
+            touch_at (0, ID(touch-moved  ), 0, 2.f, 2),
+            touch_at (0, ID(touch-moved  ), 1, 6.f, 3),
+            touch_at (0, ID(touch-ended  ), 0, 2.f, 4),
+            touch_at (0, ID(touch-moved  ), 1, 7.f, 5),
+        }
+    );
+
+    vector< Touch_Event > first  = scene->touches_of (0, 0);
+    vector< Touch_Event > second = scene->touches_of (0, 1);
+
+    // El movimiento pendiente del dedo 0 se entrega justo antes de su touch-ended, y el del dedo 1
+    // (que no termina) después de su touch-started, al final del fotograma:
+
+    REQUIRE(first.size () == 2 && second.size () == 2);
+
+    CHECK(first [0].id == ID(touch-moved  ) && first [0].x == 2.f);
+    CHECK(first [1].id == ID(touch-ended  ));
+    CHECK(second[0].id == ID(touch-started) && second[0].x == 5.f);
+    CHECK(second[1].id == ID(touch-moved  ) && second[1].x == 7.f);
+
+    // Las muestras incluyen todos los toques del dedo, no solo los movimientos:
+
+    REQUIRE(scene->samples[0].size () == 2);
+
+    const vector< Director::Touch_Sample > & samples_0 = scene->samples[0][0];
+    const vector< Director::Touch_Sample > & samples_1 = scene->samples[1][0];
+
+    REQUIRE(samples_0.size () == 3 && samples_1.size () == 3);
+
+    CHECK(samples_0[0].time == base_time + 0 && samples_0[1].time == base_time + 2 && samples_0[2].time == base_time + 4);
+    CHECK(samples_1[0].time == base_time + 1 && samples_1[1].time == base_time + 3 && samples_1[2].time == base_time + 5);
+}
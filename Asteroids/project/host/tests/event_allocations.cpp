@@ -0,0 +1,130 @@
+/*
+ * EVENT ALLOCATIONS TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182210
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <basics/Director>
+#include <basics/Event_Queue>
+#include <basics/Scene>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+    // Se sustituye el operator new global de todo el ejecutable de pruebas para contar las
+    // reservas de memoria dinámica. Solo se cuenta: la memoria se sigue pidiendo a malloc().
+
+namespace
+{
+
+    atomic< size_t > allocation_count(0);
+
+}
+
+void * operator new (size_t size)
+{
+    ++allocation_count;
+
+    if (void * memory = malloc (size ? size : 1)) return memory;
+
+    throw bad_alloc ();
+}
+
+void operator delete (void * memory) noexcept
+{
+    free (memory);
+}
+
+namespace
+{
+
+    struct Empty_Scene : public Scene
+    {
+        Size2u get_view_size () override
+        {
+            return { 64, 64 };
+        }
+    };
+
+    Event make_touch (Id id, int32_t pointer, float x, float y)
+    {
+        Event event(id);
+
+        event[ID(id)  ] = pointer;
+        event[ID(x)   ] = x;
+        event[ID(y)   ] = y;
+        event[ID(time)] = int64_t(1000 * pointer);
+
+        return event;
+    }
+
+}
+
+TEST(event_allocations, counter_sees_heap_allocations)
+{
+    size_t before = allocation_count;
+
+    unique_ptr< int > value(new int(7));
+
+    CHECK(allocation_count == before + 1);
+}
+
+TEST(event_allocations, event_queue_does_not_allocate_per_touch_event)
+{
+    Event_Queue queue;
+    Event       event;
+
+    // Calentamiento: la cola crece hasta su tamaño de trabajo.
+
+    for (int index = 0; index < 64; ++index) queue.push (make_touch (ID(touch-moved), 0, 1.f, 2.f));
+    while (queue.poll (event)) { }
+
+    size_t before = allocation_count;
+
+    for (int burst = 0; burst < 3000; ++burst)
+    {
+        for (int index = 0; index < 32; ++index)
+        {
+            queue.push (make_touch (ID(touch-moved), index, float(burst), float(index)));
+        }
+
+        while (queue.poll (event)) { }
+    }
+
+    CHECK(allocation_count == before);
+    CHECK(event.find (ID(y)) != nullptr);
+}
+
+TEST(event_allocations, director_handle_does_not_allocate_per_touch_event)
+{
+    // Una primera ejecución deja preparado al Director (colas, ventana headless...):
+
+    director.run_headless (make_shared< Empty_Scene > (), 2);
+
+    size_t before = allocation_count;
+
+    for (int pointer = 0; pointer < 100; ++pointer)
+    {
+        director.handle (make_touch (ID(touch-started), pointer, 1.f, 1.f));
+        director.handle (make_touch (ID(touch-moved  ), pointer, 2.f, 2.f));
+        director.handle (make_touch (ID(touch-moved  ), pointer, 3.f, 3.f));
+        director.handle (make_touch (ID(touch-ended  ), pointer, 3.f, 3.f));
+    }
+
+    size_t allocations = allocation_count - before;
+
+    director.run_headless (make_shared< Empty_Scene > (), 1);   // Vacía la cola.
+
+    CHECK(allocations == 0);
+}
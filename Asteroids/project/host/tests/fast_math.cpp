@@ -0,0 +1,125 @@
+/*
+ * FAST MATH TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182140
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <basics/Fast_Math>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    const size_t sample_count = 1 << 16;
+
+    struct Inputs
+    {
+        vector< float > angles, xs, ys, cosines;
+
+        Inputs() : angles(sample_count), xs(sample_count), ys(sample_count), cosines(sample_count)
+        {
+            minstd_rand random(1);
+
+            uniform_real_distribution< float > angle (-1000.f, 1000.f);
+            uniform_real_distribution< float > coordinate (-100.f, 100.f);
+            uniform_real_distribution< float > cosine(-1.f, 1.f);
+
+            for (size_t index = 0; index < sample_count; ++index)
+            {
+                angles [index] = angle      (random);
+                xs     [index] = coordinate (random);
+                ys     [index] = coordinate (random);
+                cosines[index] = cosine     (random);
+            }
+        }
+    };
+
+    const Inputs & inputs ()
+    {
+        static const Inputs inputs;
+        return inputs;
+    }
+
+}
+
+    // Los límites son los que documenta Fast_Math.hpp:
+
+TEST(fast_math, scalar_errors_stay_within_documented_bounds)
+{
+    double sine_error = 0, cosine_error = 0, atan2_error = 0, acos_error = 0, rsqrt_error = 0;
+
+    for (size_t index = 0; index < sample_count; ++index)
+    {
+        double angle = inputs ().angles[index];
+        float  sine, cosine;
+
+        fast::sincos (inputs ().angles[index], sine, cosine);
+
+        sine_error   = max (sine_error,   fabs (sine   - std::sin (angle)));
+        cosine_error = max (cosine_error, fabs (cosine - std::cos (angle)));
+
+        float  x = inputs ().xs[index];
+        float  y = inputs ().ys[index];
+        double c = inputs ().cosines[index];
+
+        atan2_error = max (atan2_error, fabs (fast::atan2 (y, x) - std::atan2 (double(y), double(x))));
+        acos_error  = max (acos_error,  fabs (fast::acos  (float(c)) - std::acos (c)));
+
+        double value = fabs (x) + 1e-3;
+
+        rsqrt_error = max (rsqrt_error, fabs (fast::rsqrt (float(value)) * std::sqrt (double(float(value))) - 1.0));
+    }
+
+    CHECK(sine_error   <= 4e-7);
+    CHECK(cosine_error <= 4e-7);
+    CHECK(atan2_error  <= 2e-6);
+    CHECK(acos_error   <= 5e-7);
+    CHECK(rsqrt_error  <  5e-6);
+}
+
+TEST(fast_math, array_versions_match_scalar_ones)
+{
+    const size_t tail_count = sample_count - 3;         // Incluye la cola escalar.
+
+    vector< float > sines(tail_count), cosines(tail_count), angles(tail_count);
+
+    fast::sincos (inputs ().angles.data (), sines.data (), cosines.data (), tail_count);
+    fast::atan2  (inputs ().ys.data (), inputs ().xs.data (), angles.data (), tail_count);
+
+    double sincos_difference = 0, atan2_difference = 0;
+
+    for (size_t index = 0; index < tail_count; ++index)
+    {
+        float sine, cosine;
+
+        fast::sincos (inputs ().angles[index], sine, cosine);
+
+        sincos_difference = max (sincos_difference, double(max (fabs (sine - sines[index]), fabs (cosine - cosines[index]))));
+        atan2_difference  = max (atan2_difference,  double(fabs (fast::atan2 (inputs ().ys[index], inputs ().xs[index]) - angles[index])));
+    }
+
+    CHECK(sincos_difference <= 1e-6);
+    CHECK(atan2_difference  <= 1e-6);
+}
+
+TEST(fast_math, edge_cases)
+{
+    CHECK(fast::atan2 (0.f, 0.f) == 0.f);
+    CHECK(fabs (fast::acos ( 1.f)) <= 5e-7f);
+    CHECK(fabs (fast::acos (-1.f) - 3.14159265f) <= 5e-7f);
+    CHECK(fast::acos ( 1.5f) == fast::acos ( 1.f));
+    CHECK(fast::acos (-1.5f) == fast::acos (-1.f));
+}
@@ -0,0 +1,52 @@
+/*
+ * GAME SIMULATION TESTS
+ * Copyright © 2021+ Marcelo López de lErma
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * marcelolopezdelerma@gmail.com
+ */
+
+#include <basics/Sprite_Pool>
+#include "Game_Simulation.hpp"
+#include "Test.hpp"
+
+using namespace basics;
+using namespace example;
+
+    // La nave gira sin parar disparando, de modo que acaba acertando a los asteroides:
+
+TEST(game_simulation, bullets_split_asteroids_into_fragments)
+{
+    Sprite_Pool     sprites;
+    Game_Simulation simulation(sprites, 1280.f, 720.f);
+
+    simulation.create  (Game_Simulation::Assets::headless ());
+    simulation.seed    (1234u);
+    simulation.restart ();
+    simulation.start   ();
+
+    Game_Simulation::Controls controls;
+
+    controls.touching  = true;
+    controls.fire      = true;
+    controls.turn_left = true;
+
+    unsigned splits    = 0;
+    unsigned destroyed = 0;
+
+    for (unsigned step = 0; step < 6000 && !simulation.is_game_over (); ++step)
+    {
+        simulation.step (1.f / 60.f, controls);
+
+        for (const Game_Simulation::Explosion & explosion : simulation.get_explosions ())
+        {
+            if (explosion.kind == Game_Simulation::ASTEROID_SPLIT    ) ++splits;
+            if (explosion.kind == Game_Simulation::FRAGMENT_DESTROYED) ++destroyed;
+        }
+    }
+
+    CHECK(splits    > 0);
+    CHECK(destroyed > 0);
+}
@@ -0,0 +1,185 @@
+/*
+ * HANDLE POOL TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182230
+ */
+
+#include <basics/Handle_Pool>
+#include "Test.hpp"
+
+using namespace basics;
+
+namespace
+{
+
+    // Objeto que cuenta cuántas veces se construye y se destruye:
+
+    struct Tracked
+    {
+        static int constructed;
+        static int destroyed;
+
+        int value;
+
+        Tracked(int value) : value(value) { ++constructed; }
+       ~Tracked()                         { ++destroyed;   }
+    };
+
+    int Tracked::constructed = 0;
+    int Tracked::destroyed   = 0;
+
+    void reset_tracking ()
+    {
+        Tracked::constructed = Tracked::destroyed = 0;
+    }
+
+    typedef Handle_Pool< Tracked, 4 > Pool;
+
+}
+
+TEST(handle_pool, stale_handles_are_rejected_after_slot_reuse)
+{
+    Pool pool;
+
+    Pool::Handle first = pool.allocate (1);
+
+    REQUIRE(pool.is_valid (first));
+    CHECK(pool.get (first)->value == 1);
+    CHECK(pool.release (first));
+    CHECK(!pool.is_valid (first));
+    CHECK(!pool.release (first));
+
+    Pool::Handle second = pool.allocate (2);                    // Reutiliza el mismo hueco.
+
+    CHECK(second.index == first.index);
+    CHECK(second != first);
+    CHECK(pool.get (first ) == nullptr);
+    CHECK(pool.get (second)->value == 2);
+    CHECK(pool.at  (second.index)->value == 2);
+    CHECK(pool.get_handle (second.index) == second);
+
+    CHECK(!pool.is_valid (Pool::Handle()));
+    CHECK(!pool.is_valid (Pool::Handle(Pool::capacity, 1)));
+    CHECK(pool.get_handle (3) == Pool::Handle());
+    CHECK(pool.at (3) == nullptr);
+}
+
+TEST(handle_pool, allocate_on_a_full_pool_fails)
+{
+    Pool pool;
+
+    for (int index = 0; index < 4; ++index) CHECK(pool.is_valid (pool.allocate (index)));
+
+    CHECK(pool.full ());
+    CHECK(pool.get_occupancy () == 1.f);
+
+    Pool::Handle overflow = pool.allocate (4);
+
+    CHECK(!pool.is_valid (overflow));
+    CHECK(overflow == Pool::Handle());
+    CHECK(pool.get_failed_allocation_count () == 1);
+
+    pool.allocate (5);
+
+    CHECK(pool.get_failed_allocation_count () == 2);
+    CHECK(pool.size () == 4);
+}
+
+TEST(handle_pool, for_each_can_release_the_visited_item)
+{
+    Pool pool;
+
+    for (int index = 0; index < 4; ++index) pool.allocate (index);
+
+    int visited = 0;
+
+    pool.for_each
+    (
+        [&pool, &visited] (const Pool::Handle & handle, Tracked & item)
+        {
+            ++visited;
+
+            if (item.value % 2 == 0) pool.release (handle);
+        }
+    );
+
+    CHECK(visited == 4);
+    CHECK(pool.size () == 2);
+
+    int sum = 0;
+
+    pool.for_each ([&sum] (const Pool::Handle & , Tracked & item) { sum += item.value; });
+
+    CHECK(sum == 1 + 3);
+}
+
+TEST(handle_pool, high_water_mark_and_reset_statistics)
+{
+    Pool pool;
+
+    Pool::Handle a = pool.allocate (0);
+    Pool::Handle b = pool.allocate (1);
+
+    pool.allocate (2);
+
+    CHECK(pool.get_high_water_mark () == 3);
+
+    pool.release (a);
+    pool.release (b);
+
+    CHECK(pool.size () == 1);
+    CHECK(pool.get_high_water_mark () == 3);                    // No baja al liberar.
+
+    for (int index = 0; index < 4; ++index) pool.allocate (index);
+
+    CHECK(pool.get_high_water_mark () == 4);
+    CHECK(pool.get_failed_allocation_count () == 1);
+
+    pool.clear ();
+    pool.reset_statistics ();
+
+    CHECK(pool.get_high_water_mark () == 0);
+    CHECK(pool.get_failed_allocation_count () == 0);
+
+    pool.allocate (0);
+
+    CHECK(pool.get_high_water_mark () == 1);
+}
+
+TEST(handle_pool, items_are_destroyed_exactly_once)
+{
+    reset_tracking ();
+
+    {
+        Pool pool;
+
+        Pool::Handle released = pool.allocate (0);
+
+        pool.allocate (1);
+        pool.allocate (2);
+        pool.release  (released);
+
+        CHECK(Tracked::constructed == 3 && Tracked::destroyed == 1);
+
+        pool.clear ();
+
+        CHECK(Tracked::destroyed == 3);
+        CHECK(pool.empty ());
+
+        pool.clear ();                                          // Un segundo clear() no hace nada.
+
+        CHECK(Tracked::destroyed == 3);
+
+        pool.allocate (3);
+        pool.allocate (4);
+    }
+
+    CHECK(Tracked::constructed == 5);                           // El destructor libera los vivos.
+    CHECK(Tracked::destroyed   == 5);
+}
@@ -0,0 +1,28 @@
+/*
+ * HEADLESS TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182075
+ */
+
+#include <basics/Director>
+#include "Game_Scene.hpp"
+#include "Test.hpp"
+
+using namespace basics;
+using namespace example;
+using namespace std;
+
+TEST(headless, runs_the_requested_frames)
+{
+    Director::Benchmark_Results results = director.run_headless (make_shared< Game_Scene > (), 120);
+
+    CHECK(results.frames == 120);
+    CHECK(results.update_ns_per_frame > 0.0);
+    CHECK(results.render_ns_per_frame > 0.0);
+}
@@ -0,0 +1,114 @@
+/*
+ * LATENCY TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182100
+ */
+
+#include <chrono>
+#include <basics/Director>
+#include <basics/Scene>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    struct Touch_Sink : public Scene
+    {
+        unsigned touches = 0;
+
+        Size2u get_view_size () override
+        {
+            return { 64, 64 };
+        }
+
+        void handle_touch (Touch_Event & ) override
+        {
+            ++touches;
+        }
+    };
+
+    int64_t now_ns ()
+    {
+        return chrono::duration_cast< chrono::nanoseconds > (chrono::steady_clock::now ().time_since_epoch ()).count ();
+    }
+
+    Director::Scripted_Event touch_at (unsigned frame, Id id, int64_t timestamp)
+    {
+        return Director::Scripted_Event{ frame, Touch_Event{ id, 0, 8.f, 8.f, timestamp }.to_event () };
+    }
+
+}
+
+    // Los toques sintéticos llevan marcas de tiempo de hace al menos 5 ms (en el mismo reloj que usa
+    // el Director), así que toda latencia registrada debe ser como mínimo esa:
+
+TEST(latency, records_every_timestamped_touch)
+{
+    const int64_t age       = 5000000;
+    const int64_t timestamp = now_ns () - age;
+
+    vector< Director::Scripted_Event > script
+    {
+        touch_at (2, ID(touch-started), timestamp),
+        touch_at (3, ID(touch-moved  ), timestamp),
+        touch_at (3, ID(touch-moved  ), 0        ),         // Sin marca de tiempo: no cuenta.
+        touch_at (4, ID(touch-ended  ), timestamp),
+    };
+
+    director.set_latency_log_period   (0.f);
+    director.reset_latency_statistics ();
+
+    shared_ptr< Touch_Sink > scene = make_shared< Touch_Sink > ();
+
+    director.run_headless (scene, 8, 1.f / 60.f, script);
+
+    const Latency_Histogram & input   = director.get_input_latency   ();
+    const Latency_Histogram & display = director.get_display_latency ();
+
+    CHECK(scene->touches >= 3);
+    CHECK(input  .get_count () == 3);
+    CHECK(display.get_count () == 3);
+    CHECK(input  .get_min_ms () >= age * 1e-6f);
+    CHECK(display.get_min_ms () >= input.get_min_ms  ());
+    CHECK(display.get_max_ms () >= input.get_max_ms  ());
+    CHECK(display.get_mean_ms() >= input.get_mean_ms ());
+    CHECK(input  .get_percentile_ms (0.5f) >= age * 1e-6f);
+}
+
+TEST(latency, ignores_touches_without_timestamp)
+{
+    director.set_latency_log_period   (0.f);
+    director.reset_latency_statistics ();
+
+    director.run_headless
+    (
+        make_shared< Touch_Sink > (), 4, 1.f / 60.f,
+        { touch_at (1, ID(touch-started), 0), touch_at (2, ID(touch-ended), 0) }
+    );
+
+    CHECK(director.get_input_latency   ().get_count () == 0);
+    CHECK(director.get_display_latency ().get_count () == 0);
+}
+
+TEST(latency, reset_clears_the_histograms)
+{
+    director.set_latency_log_period (0.f);
+
+    director.run_headless (make_shared< Touch_Sink > (), 3, 1.f / 60.f, { touch_at (1, ID(touch-started), now_ns ()) });
+
+    CHECK(director.get_input_latency ().get_count () > 0);
+
+    director.reset_latency_statistics ();
+
+    CHECK(director.get_input_latency   ().get_count () == 0);
+    CHECK(director.get_display_latency ().get_count () == 0);
+}
@@ -0,0 +1,66 @@
+/*
+ * TESTS MAIN
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182055
+ */
+
+#include <cstring>
+#include <basics/enable>
+#include <basics/Headless>
+#include "Test.hpp"
+
+namespace host
+{
+
+    Test * Test::first    = nullptr;
+    int    Test::failures = 0;
+
+}
+
+using namespace host;
+
+    // Uso: asteroids-tests [grupo...]
+    // Sin argumentos se ejecutan todas las pruebas. El código de salida es distinto de cero si alguna
+    // falla o si no se encuentra ninguna prueba de los grupos indicados.
+
+int main (int argc, char * argv[])
+{
+    basics::enable< basics::Headless > ();
+
+    int executed = 0;
+
+    for (Test * test = Test::first; test; test = test->next)
+    {
+        bool selected = argc < 2;
+
+        for (int i = 1; i < argc && !selected; ++i)
+        {
+            selected = std::strcmp (argv[i], test->group) == 0;
+        }
+
+        if (selected)
+        {
+            int failures_before = Test::failures;
+
+            test->function ();
+
+            std::printf ("%s %s.%s\n", Test::failures == failures_before ? "ok   " : "FALLA", test->group, test->name);
+
+            ++executed;
+        }
+    }
+
+    if (executed == 0)
+    {
+        std::fprintf (stderr, "no hay pruebas que ejecutar\n");
+        return 1;
+    }
+
+    return Test::failures == 0 ? 0 : 1;
+}
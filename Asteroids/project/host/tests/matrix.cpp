@@ -0,0 +1,121 @@
+/*
+ * MATRIX TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182150
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <basics/Matrix>
+#include <basics/Vector>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    template< unsigned D >
+    Matrix< D, D, float > random_matrix (minstd_rand & random)
+    {
+        uniform_real_distribution< float > value(-1.f, 1.f);
+
+        Matrix< D, D, float > matrix;
+
+        for (auto & element : matrix.values) element = value (random);
+
+        return matrix;
+    }
+
+    // Error máximo del producto en float respecto al mismo producto calculado en double:
+
+    template< unsigned D >
+    double product_error ()
+    {
+        minstd_rand random(1);
+
+        double error = 0;
+
+        for (int test = 0; test < 1000; ++test)
+        {
+            auto a = random_matrix< D > (random);
+            auto b = random_matrix< D > (random);
+
+            Matrix< D, D, double > a_double, b_double, expected;
+
+            for (unsigned index = 0; index < D * D; ++index)
+            {
+                a_double.values[index] = a.values[index];
+                b_double.values[index] = b.values[index];
+            }
+
+            internal::Matrix_Product< D, D, D, double >::multiply (a_double.values, b_double.values, expected.values);
+
+            auto product = a * b;
+
+            for (unsigned index = 0; index < D * D; ++index)
+            {
+                error = max (error, fabs (product.values[index] - expected.values[index]));
+            }
+        }
+
+        return error;
+    }
+
+    template< unsigned D >
+    bool identity_is_neutral ()
+    {
+        minstd_rand random(2);
+
+        auto matrix = random_matrix< D > (random);
+        auto left   = Matrix< D, D, float >::identity * matrix;
+        auto right  = matrix * Matrix< D, D, float >::identity;
+
+        return equal (begin (left .values), end (left .values), begin (matrix.values))
+            && equal (begin (right.values), end (right.values), begin (matrix.values));
+    }
+
+}
+
+TEST(matrix, float_3x3_product_matches_double_product)
+{
+    CHECK(product_error< 3 > () < 1e-6);
+}
+
+TEST(matrix, float_4x4_product_matches_double_product)
+{
+    CHECK(product_error< 4 > () < 1e-6);
+}
+
+TEST(matrix, identity_is_neutral)
+{
+    CHECK(identity_is_neutral< 3 > ());
+    CHECK(identity_is_neutral< 4 > ());
+}
+
+TEST(matrix, vector_subtraction_and_negation)
+{
+    Vector2f v(1.f, 2.f);
+    Vector2f w(3.f, 5.f);
+
+    Vector2f difference = w - v;
+    Vector2f negated    = -v;
+
+    CHECK(difference[0] ==  2.f && difference[1] ==  3.f);
+    CHECK(negated   [0] == -1.f && negated   [1] == -2.f);
+}
+
+TEST(matrix, four_value_coordinates)
+{
+    Vector4f q(1.f, 2.f, 3.f, 4.f);
+
+    CHECK(q[0] == 1.f && q[1] == 2.f && q[2] == 3.f && q[3] == 4.f);
+}
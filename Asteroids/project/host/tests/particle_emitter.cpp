@@ -0,0 +1,200 @@
+/*
+ * PARTICLE EMITTER TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182220
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <basics/Headless>
+#include <basics/Particle_Emitter>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    // Canvas que guarda una copia de lo que recibe fill_particles() y los modos de mezcla usados:
+
+    struct Recording_Canvas : public headless::Canvas
+    {
+        vector< float    > xs, ys, sizes, alphas;
+        vector< Blending > blendings;
+        unsigned           batches = 0;
+
+        void set_blending (Blending blending) override
+        {
+            blendings.push_back (blending);
+        }
+
+        void fill_particles
+        (
+            const Texture_2D * ,
+            const float      * x,
+            const float      * y,
+            const float      * size,
+            const float      * ,
+            const float      * ,
+            const float      * ,
+            const float      * alpha,
+            size_t             count
+        )
+        override
+        {
+            ++batches;
+            xs    .assign (x,     x     + count);
+            ys    .assign (y,     y     + count);
+            sizes .assign (size,  size  + count);
+            alphas.assign (alpha, alpha + count);
+        }
+    };
+
+    headless::Texture_2D texture(8, 8);
+
+    // Partículas quietas con una vida exacta para que las comprobaciones no dependan del azar:
+
+    Particle_Emitter::Settings still_settings (float lifetime)
+    {
+        Particle_Emitter::Settings settings;
+
+        settings.texture      = &texture;
+        settings.min_lifetime = settings.max_lifetime = lifetime;
+        settings.min_speed    = settings.max_speed    = 0.f;
+
+        return settings;
+    }
+
+    bool close (float a, float b)
+    {
+        return fabs (a - b) <= 1e-4f;
+    }
+
+}
+
+TEST(particle_emitter, emit_is_clamped_to_the_capacity)
+{
+    Particle_Emitter emitter(10, still_settings (5.f));
+
+    emitter.emit ({ 0.f, 0.f }, 7);
+
+    CHECK(emitter.size () == 7);
+
+    emitter.emit ({ 0.f, 0.f }, 7);
+
+    CHECK(emitter.size () == 10);
+    CHECK(emitter.get_capacity () == 10);
+
+    emitter.emit ({ 0.f, 0.f }, 1);
+    emitter.update (.1f);
+
+    CHECK(emitter.size () == 10);
+
+    // La emisión automática tampoco pasa de la capacidad:
+
+    Particle_Emitter automatic(6, still_settings (5.f));
+
+    automatic.get_settings ().rate = 100.f;
+    automatic.set_emitting (true);
+    automatic.update (1.f);
+
+    CHECK(automatic.size () == 6);
+
+    automatic.clear ();
+
+    CHECK(automatic.size () == 0);
+
+    Particle_Emitter empty(0);
+
+    empty.emit ({ 0.f, 0.f }, 5);
+
+    CHECK(empty.size () == 0);
+}
+
+TEST(particle_emitter, particles_expire_at_the_end_of_their_lifetime)
+{
+    Particle_Emitter emitter(16, still_settings (1.f));
+
+    emitter.emit ({ 0.f, 0.f }, 5);
+    emitter.update (.5f);
+
+    CHECK(emitter.size () == 5);
+
+    emitter.update (.25f);
+
+    CHECK(emitter.size () == 5);
+
+    emitter.update (.25f);                                      // La edad llega justo a la vida.
+
+    CHECK(emitter.size () == 0);
+}
+
+TEST(particle_emitter, dead_particles_are_replaced_by_the_last_one)
+{
+    Particle_Emitter emitter(16);
+
+    // Se intercalan partículas de vida corta y larga, cada una en una x distinta:
+
+    for (unsigned index = 0; index < 9; ++index)
+    {
+        bool longer = index % 3 == 1;
+
+        emitter.set_settings (still_settings (longer ? 4.f : 1.f));
+        emitter.emit ({ float(index), 0.f }, 1);
+    }
+
+    emitter.update (2.f);
+
+    CHECK(emitter.size () == 3);
+
+    Recording_Canvas canvas;
+
+    emitter.render (canvas);
+
+    REQUIRE(canvas.batches == 1 && canvas.xs.size () == 3);
+
+    vector< float > xs = canvas.xs;
+
+    sort (xs.begin (), xs.end ());
+
+    CHECK(xs == vector< float >({ 1.f, 4.f, 7.f }));
+
+    // Los valores derivados de la edad se han movido con su partícula (mitad de la vida):
+
+    bool halfway = true;
+
+    for (size_t index = 0; index < 3; ++index)
+    {
+        halfway = halfway && close (canvas.sizes[index], 10.f) && close (canvas.alphas[index], .5f) && canvas.ys[index] == 0.f;
+    }
+
+    CHECK(halfway);
+}
+
+TEST(particle_emitter, render_uses_the_configured_blending_once)
+{
+    Particle_Emitter::Settings settings = still_settings (1.f);
+
+    settings.blending = Canvas::MULTIPLY;
+
+    Particle_Emitter emitter(8, settings);
+    Recording_Canvas canvas;
+
+    emitter.render (canvas);                                    // Sin partículas no se dibuja nada.
+
+    CHECK(canvas.batches == 0 && canvas.blendings.empty ());
+
+    emitter.emit ({ 0.f, 0.f }, 8);
+    emitter.render (canvas);
+
+    CHECK(canvas.batches == 1);
+    CHECK(canvas.blendings == vector< Canvas::Blending >({ Canvas::MULTIPLY, Canvas::TRANSPARENCY }));
+}
@@ -0,0 +1,152 @@
+/*
+ * POINT TRANSFORM TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182160
+ */
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+#include <basics/Affine>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    // El lote y el punto a punto pueden diferir en el redondeo si el compilador fusiona
+    // multiplicaciones y sumas (FMA) en uno de los dos caminos y no en el otro. Se admiten unos
+    // pocos ulp del mayor de los términos que se suman:
+
+    bool close (const Affine2f & transform, const Point2f & point, unsigned row, float value, float expected)
+    {
+        const float * m = transform.values + row * 3;
+
+        float magnitude = fabs (m[0] * point[0]) + fabs (m[1] * point[1]) + fabs (m[2]);
+
+        return fabs (value - expected) <= magnitude * 4.f * numeric_limits< float >::epsilon ();
+    }
+
+    bool close (const Affine2f & transform, const Point2f & point, const Point2f & value, const Point2f & expected)
+    {
+        return close (transform, point, 0, value[0], expected[0]) && close (transform, point, 1, value[1], expected[1]);
+    }
+
+    struct Fixture
+    {
+        minstd_rand random;
+
+        float value (float minimum, float maximum)
+        {
+            return uniform_real_distribution< float >(minimum, maximum)(random);
+        }
+
+        Affine2f transform ()
+        {
+            return Affine2f::scale_rotate_then_translate
+            (
+                value (.1f, 4.f), value (.1f, 4.f), value (-3.2f, 3.2f), { value (-500.f, 500.f), value (-500.f, 500.f) }
+            );
+        }
+
+        vector< Point2f > points (size_t count)
+        {
+            vector< Point2f > points;
+
+            for (size_t index = 0; index < count; ++index)
+            {
+                points.push_back ({ value (-1000.f, 1000.f), value (-1000.f, 1000.f) });
+            }
+
+            return points;
+        }
+    };
+
+}
+
+    // Las transformaciones en lote (que el compilador vectoriza) deben dar lo mismo que
+    // Affine2f::transform (Point2f) punto a punto, con cualquier número de puntos:
+
+TEST(point_transform, interleaved_batch_matches_per_point)
+{
+    Fixture fixture;
+
+    for (size_t count = 0; count < 70; ++count)
+    {
+        Affine2f          transform = fixture.transform ();
+        vector< Point2f > input     = fixture.points (count);
+        vector< Point2f > output (count);
+        vector< Point2f > in_place  = input;
+
+        transform.transform (input.data (), output.data (), count);
+        transform.transform (in_place.data (), in_place.data (), count);
+
+        bool same = true;
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            Point2f expected = transform.transform (input[index]);
+
+            same = same && close (transform, input[index], output  [index], expected);
+            same = same && close (transform, input[index], in_place[index], expected);
+        }
+
+        CHECK(same);
+    }
+}
+
+TEST(point_transform, separate_arrays_batch_matches_per_point)
+{
+    Fixture fixture;
+
+    for (size_t count = 0; count < 70; ++count)
+    {
+        Affine2f          transform = fixture.transform ();
+        vector< Point2f > points    = fixture.points (count);
+        vector< float   > xs(count), ys(count), out_xs(count), out_ys(count);
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            xs[index] = points[index][0];
+            ys[index] = points[index][1];
+        }
+
+        transform.transform (xs.data (), ys.data (), out_xs.data (), out_ys.data (), count);
+
+        bool same = true;
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            Point2f expected = transform.transform (points[index]);
+
+            same = same && close (transform, points[index], { out_xs[index], out_ys[index] }, expected);
+        }
+
+        CHECK(same);
+    }
+}
+
+TEST(point_transform, transformation_uses_its_top_two_rows)
+{
+    Fixture fixture;
+
+    Affine2f          affine         = fixture.transform ();
+    Transformation2f  transformation = affine;
+    vector< Point2f > input          = fixture.points (13);
+    vector< Point2f > from_affine (13), from_transformation (13);
+
+    transform_points (affine,         input.data (), from_affine        .data (), input.size ());
+    transform_points (transformation, input.data (), from_transformation.data (), input.size ());
+
+    CHECK(memcmp (from_affine.data (), from_transformation.data (), input.size () * sizeof(Point2f)) == 0);
+}
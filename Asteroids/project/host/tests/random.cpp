@@ -0,0 +1,270 @@
+/*
+ * RANDOM TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182175
+ */
+
+#include <climits>
+#include <cmath>
+#include <vector>
+#include <basics/Random>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    // Implementación de referencia de xoshiro128** tal y como la publican sus autores:
+
+    struct Reference
+    {
+        uint32_t s[4];
+
+        static uint32_t rotl (const uint32_t x, int k)
+        {
+            return (x << k) | (x >> (32 - k));
+        }
+
+        uint32_t next ()
+        {
+            const uint32_t result = rotl (s[1] * 5, 7) * 9;
+            const uint32_t t      = s[1] << 9;
+
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3]  = rotl (s[3], 11);
+
+            return result;
+        }
+
+        void jump ()
+        {
+            static const uint32_t JUMP[] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+
+            uint32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+
+            for (int i = 0; i < 4; i++)
+            {
+                for (int b = 0; b < 32; b++)
+                {
+                    if (JUMP[i] & UINT32_C(1) << b)
+                    {
+                        s0 ^= s[0]; s1 ^= s[1]; s2 ^= s[2]; s3 ^= s[3];
+                    }
+
+                    next ();
+                }
+            }
+
+            s[0] = s0; s[1] = s1; s[2] = s2; s[3] = s3;
+        }
+    };
+
+    // Los cuatro generadores de Random_Batch(base): base, base + 1 salto, base + 2 saltos...
+
+    void make_lanes (const Random & base, Random (& lanes)[Random_Batch::lane_count])
+    {
+        for (unsigned lane = 0; lane < Random_Batch::lane_count; ++lane)
+        {
+            lanes[lane] = base;
+
+            for (unsigned jump = 0; jump < lane; ++jump) lanes[lane].jump ();
+        }
+    }
+
+    const size_t batch_counts[] = { 0, 1, 3, 4, 5, 17, 1000 };
+
+}
+
+TEST(random, matches_reference_xoshiro128)
+{
+    Random    random(42);
+    Reference reference;
+
+    copy_n (random.get_state (), 4, reference.s);
+
+    bool same = true;
+
+    for (int index = 0; index < 100000; ++index) same = same && random.next () == reference.next ();
+
+    random.jump ();
+    reference.jump ();
+
+    for (int index = 0; index < 1000; ++index) same = same && random.next () == reference.next ();
+
+    CHECK(same);
+}
+
+TEST(random, same_seed_gives_same_sequence)
+{
+    Random a(1234), b(1234), c(1235);
+
+    bool same = true, different = false;
+
+    for (int index = 0; index < 1000; ++index)
+    {
+        uint32_t value = a.next ();
+
+        same      = same      && value == b.next ();
+        different = different || value != c.next ();
+    }
+
+    CHECK(same);
+    CHECK(different);
+
+    a.seed (99);
+    b.seed (99);
+
+    CHECK(a.next () == b.next ());
+}
+
+TEST(random, values_stay_within_their_ranges)
+{
+    Random random(1);
+
+    bool below_in_range = true, ints_in_range = true, floats_in_range = true, units_in_range = true;
+    bool saw_min = false, saw_max = false;
+
+    for (int index = 0; index < 100000; ++index)
+    {
+        below_in_range = below_in_range && random.below (1280) < 1280;
+
+        int32_t value = random.between (-5, 5);
+
+        ints_in_range = ints_in_range && value >= -5 && value <= 5;
+        saw_min       = saw_min || value == -5;
+        saw_max       = saw_max || value ==  5;
+
+        float real = random.between (-3.f, 5.f);
+        float unit = random.unit ();
+
+        floats_in_range = floats_in_range && real >= -3.f && real < 5.f;
+        units_in_range  = units_in_range  && unit >=  0.f && unit < 1.f;
+    }
+
+    CHECK(below_in_range);
+    CHECK(ints_in_range);
+    CHECK(saw_min && saw_max);
+    CHECK(floats_in_range);
+    CHECK(units_in_range);
+    CHECK(random.below (1) == 0);
+
+    random.between (INT32_MIN, INT32_MAX);                  // El rango completo no debe dividir por 0.
+}
+
+TEST(random, below_is_not_biased)
+{
+    Random random(1);
+
+    long counts[6] = { 0, 0, 0, 0, 0, 0 };
+
+    for (int index = 0; index < 600000; ++index) counts[random.below (6)]++;
+
+    bool uniform = true;
+
+    for (long count : counts) uniform = uniform && labs (count - 100000) < 1500;
+
+    CHECK(uniform);
+}
+
+TEST(random, unit_vectors_have_unit_length)
+{
+    Random random(3);
+
+    double error = 0;
+
+    for (int index = 0; index < 10000; ++index)
+    {
+        Vector2f vector = random.unit_vector ();
+
+        error = max (error, fabs (sqrt (double(vector[0]) * vector[0] + double(vector[1]) * vector[1]) - 1.0));
+    }
+
+    CHECK(error < 1e-6);
+}
+
+    // Random_Batch reparte los valores entre sus cuatro generadores en orden, tanto en la parte
+    // SIMD como en el resto escalar:
+
+TEST(random, batch_fill_matches_scalar_sequences)
+{
+    bool same = true;
+
+    for (size_t count : batch_counts)
+    {
+        Random base(7), lanes[Random_Batch::lane_count];
+
+        make_lanes (base, lanes);
+
+        Random_Batch batch(base);
+        vector< uint32_t > values(count);
+
+        batch.fill (values.data (), count);
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            same = same && values[index] == lanes[index % Random_Batch::lane_count].next ();
+        }
+    }
+
+    CHECK(same);
+}
+
+TEST(random, batch_float_fill_matches_scalar_conversion)
+{
+    bool same = true, in_range = true;
+
+    for (size_t count : batch_counts)
+    {
+        Random base(11), lanes[Random_Batch::lane_count];
+
+        make_lanes (base, lanes);
+
+        Random_Batch batch(base);
+        vector< float > values(count);
+
+        batch.fill (values.data (), count, -3.f, 5.f);
+
+        const float step = 8.f * (1.f / 16777216.f);
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            float expected = -3.f + float(lanes[index % Random_Batch::lane_count].next () >> 8) * step;
+
+            same     = same     && values[index] == expected;
+            in_range = in_range && values[index] >= -3.f && values[index] < 5.f;
+        }
+    }
+
+    CHECK(same);
+    CHECK(in_range);
+}
+
+TEST(random, batch_unit_vectors_have_unit_length)
+{
+    Random_Batch batch(5);
+
+    vector< float > xs(1001), ys(1001);
+
+    batch.fill_unit_vectors (xs.data (), ys.data (), xs.size ());
+
+    double error = 0;
+
+    for (size_t index = 0; index < xs.size (); ++index)
+    {
+        error = max (error, fabs (sqrt (double(xs[index]) * xs[index] + double(ys[index]) * ys[index]) - 1.0));
+    }
+
+    CHECK(error < 1e-6);
+}
@@ -0,0 +1,177 @@
+/*
+ * RASTER FONT TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182195
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <basics/Headless>
+#include <basics/Raster_Font>
+#include <basics/Raster_Font_Format>
+#include <basics/Text_Layout>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    const char * const xml_path    = HOST_DATA_PATH "/fonts/test.fnt";
+    const char * const binary_path = HOST_DATA_PATH "/fonts/test.bfnt";
+
+    struct Fixture
+    {
+        shared_ptr< basics::Window > window  = headless::Window::create ({ 1280, 720 });
+        Graphics_Context::Accessor   context = window->lock_graphics_context ();
+    };
+
+    bool same_character (const Raster_Font::Character * a, const Raster_Font::Character * b)
+    {
+        if (!a || !b) return a == b;
+
+        if (a->offset != b->offset || a->advance != b->advance || !a->slice != !b->slice) return false;
+
+        return !a->slice ||
+        (
+            a->slice->left   == b->slice->left   && a->slice->right  == b->slice->right  &&
+            a->slice->bottom == b->slice->bottom && a->slice->top    == b->slice->top    &&
+            a->slice->width  == b->slice->width  && a->slice->height == b->slice->height
+        );
+    }
+
+    // Copia los primeros bytes de la fuente binaria a un archivo temporal, sustituyendo
+    // opcionalmente un campo de 32 bits de la cabecera:
+
+    string write_truncated_copy (size_t size, size_t patch_offset = 0, uint32_t patch_value = 0)
+    {
+        vector< char > data(size);
+
+        FILE * input = fopen (binary_path, "rb");
+        size_t read  = input ? fread (data.data (), 1, size, input) : 0;
+
+        if (input) fclose (input);
+
+        if (patch_offset && patch_offset + sizeof(patch_value) <= read)
+        {
+            memcpy (data.data () + patch_offset, &patch_value, sizeof(patch_value));
+        }
+
+        string path = string(P_tmpdir) + "/asteroids-truncated.bfnt";
+
+        FILE * output = fopen (path.c_str (), "wb");
+
+        if (output)
+        {
+            fwrite (data.data (), 1, read, output);
+            fclose (output);
+        }
+
+        return path;
+    }
+
+}
+
+TEST(raster_font, binary_font_loads_the_same_glyphs_as_xml)
+{
+    Fixture     fixture;
+    Raster_Font xml   (xml_path,    fixture.context);
+    Raster_Font binary(binary_path, fixture.context);
+
+    REQUIRE(xml.good () && binary.good ());
+
+    CHECK(xml.get_name () == binary.get_name ());
+    CHECK(xml.get_metrics ().line_height == binary.get_metrics ().line_height);
+    CHECK(xml.get_metrics ().base_height == binary.get_metrics ().base_height);
+
+    bool same = true;
+    int  found = 0, found_above_255 = 0;
+
+    for (uint32_t code = 0; code < 0x2200; ++code)
+    {
+        const Raster_Font::Character * character = xml.get_character (code);
+
+        same = same && same_character (character, binary.get_character (code));
+
+        if (character)
+        {
+            ++found;
+            if (code > 255) ++found_above_255;
+        }
+    }
+
+    CHECK(same);
+    CHECK(found == 211);
+    CHECK(found_above_255 > 0);                                 // Cubre también la búsqueda binaria.
+}
+
+TEST(raster_font, characters_without_image_only_advance)
+{
+    Fixture fixture;
+
+    for (const char * path : { xml_path, binary_path })
+    {
+        Raster_Font font(path, fixture.context);
+
+        REQUIRE(font.good ());
+
+        const Raster_Font::Character * space = font.get_character (' ');
+
+        REQUIRE(space != nullptr);
+
+        CHECK(space->slice == nullptr);
+        CHECK(space->advance > 0.f);
+
+        Text_Layout with_space   (font, L"A B");
+        Text_Layout without_space(font, L"AB");
+
+        CHECK(with_space.get_glyphs ().size () == 2);
+        CHECK(with_space.get_width () > without_space.get_width ());
+    }
+}
+
+TEST(raster_font, missing_or_truncated_fonts_are_not_good)
+{
+    Fixture fixture;
+
+    CHECK(!Raster_Font(HOST_DATA_PATH "/fonts/missing.fnt", fixture.context).good ());
+
+    for (size_t size : { size_t(4), size_t(31), size_t(200) })
+    {
+        string path = write_truncated_copy (size);
+
+        CHECK(!Raster_Font(path, fixture.context).good ());
+
+        remove (path.c_str ());
+    }
+
+    // Cabeceras corruptas cuyas longitudes desbordarían el cálculo del tamaño con size_t de 32
+    // bits (0x0CCCCCCD * 20 da 4 en aritmética de 32 bits):
+
+    using raster_font_format::Header;
+
+    const size_t patches[][2] =
+    {
+        { offsetof(Header, character_count    ), 0x0CCCCCCDu },
+        { offsetof(Header, texture_name_length), 0xFFFFFFF0u },
+        { offsetof(Header, face_name_length   ), 0xFFFFFFF0u },
+    };
+
+    for (auto & patch : patches)
+    {
+        string path = write_truncated_copy (100000, patch[0], uint32_t(patch[1]));
+
+        CHECK(!Raster_Font(path, fixture.context).good ());
+
+        remove (path.c_str ());
+    }
+}
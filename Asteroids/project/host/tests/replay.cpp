@@ -0,0 +1,140 @@
+/*
+ * REPLAY TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182125
+ */
+
+#include <vector>
+#include <basics/Director>
+#include <basics/Scene>
+#include <basics/Touch_Surface>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    // Escena que, como Game_Scene, deriva sus controles de Director::get_touch_state() en cada paso
+    // y los anota. Si se le pide, en ciertos pasos hace lo mismo que el hilo de entrada en Android:
+    // encola el toque en el Director (que lo entrega en el paso siguiente) y lo registra en
+    // touch_surface, pero lo publica un paso más tarde, como ocurre cuando el fotograma empieza
+    // entre ambas cosas:
+
+    struct Controls_Scene : public Scene
+    {
+        struct Controls
+        {
+            int   touches;
+            float x;
+            bool  down;
+            bool  up;
+
+            bool operator == (const Controls & other) const
+            {
+                return touches == other.touches && x == other.x && down == other.down && up == other.up;
+            }
+        };
+
+        bool               inject;
+        unsigned           step = 0;
+        vector< Controls > history;
+
+        Controls_Scene(bool inject) : inject(inject)
+        {
+        }
+
+        Size2u get_view_size () override
+        {
+            return { 64, 64 };
+        }
+
+        bool publish_pending = false;
+
+        void send (Id id, float x)
+        {
+            Touch_Event touch{ id, 1, x, 32.f, 0 };
+
+            director.handle (touch);
+
+            touch_surface->record (touch);
+
+            publish_pending = true;
+        }
+
+        void update (float ) override
+        {
+            const Touch_Surface::State & state = director.get_touch_state ();
+
+            Controls controls{ state.touch_count (), 0.f, false, false };
+
+            if (controls.touches > 0)
+            {
+                controls.x    = state.get_touch (0).x;
+                controls.down = state.get_touch (0).down;
+                controls.up   = state.get_touch (0).up;
+            }
+
+            history.push_back (controls);
+
+            if (publish_pending)
+            {
+                touch_surface->publish ();
+
+                publish_pending = false;
+            }
+
+            if (inject)
+            {
+                switch (step)
+                {
+                    case  5: send (ID(touch-started), 10.f); break;
+                    case 12: send (ID(touch-moved  ), 20.f); break;
+                    case 20: send (ID(touch-ended  ), 30.f); break;
+                }
+            }
+
+            ++step;
+        }
+    };
+
+}
+
+TEST(replay, reproduces_the_touch_state_of_every_step)
+{
+    director.set_deterministic (42u);
+    director.start_recording   ();
+
+    shared_ptr< Controls_Scene > recorded = make_shared< Controls_Scene > (true);
+
+    director.run_headless (recorded, 30);
+    director.stop_recording ();
+
+    shared_ptr< Controls_Scene > replayed = make_shared< Controls_Scene > (false);
+
+    director.replay (replayed, director.get_input_log ());
+    director.disable_deterministic ();
+
+    REQUIRE(recorded->history.size () == 30);
+    REQUIRE(replayed->history.size () == 30);
+
+    bool     same_controls = true;
+    unsigned touched_steps = 0;
+
+    for (size_t index = 0; index < 30; ++index)
+    {
+        same_controls &= recorded->history[index] == replayed->history[index];
+        touched_steps += recorded->history[index].touches > 0;
+    }
+
+    CHECK(same_controls);
+    CHECK(touched_steps > 0);
+    CHECK(director.get_input_log ().get_records ().size () == 3);
+}
@@ -0,0 +1,117 @@
+/*
+ * SHAPES TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182135
+ */
+
+#include <random>
+#include <vector>
+#include <basics/Shape_Batch>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    minstd_rand random_engine(3);
+
+    float random_float (float min, float max)
+    {
+        return uniform_real_distribution< float >(min, max)(random_engine);
+    }
+
+    Circle2f random_circle () { return Circle2f({ random_float (0.f, 1000.f), random_float (0.f, 1000.f) }, random_float (5.f, 60.f)); }
+    Aabb2f   random_aabb   () { return Aabb2f::from_center ({ random_float (0.f, 1000.f), random_float (0.f, 1000.f) }, random_float (5.f, 60.f), random_float (5.f, 60.f)); }
+    Obb2f    random_obb    () { return Obb2f({ random_float (0.f, 1000.f), random_float (0.f, 1000.f) }, random_float (5.f, 60.f), random_float (5.f, 60.f), random_float (0.f, 6.28f)); }
+
+    // Retorna true si query() encuentra exactamente las formas para las que intersects() es true:
+
+    template< typename QUERY, typename BATCH, typename SHAPE >
+    bool query_matches_intersects (const QUERY & shape, const BATCH & batch, const vector< SHAPE > & shapes, unsigned & hits)
+    {
+        vector< uint32_t > output;
+
+        query (shape, batch, output);
+
+        vector< bool > found(shapes.size (), false);
+
+        for (uint32_t index : output) found[index] = true;
+
+        bool matches = true;
+
+        for (size_t index = 0; index < shapes.size (); ++index)
+        {
+            bool expected = intersects (shape, shapes[index]);
+
+            matches &= found[index] == expected;
+            hits    += expected;
+        }
+
+        return matches && output.size () <= shapes.size ();
+    }
+
+}
+
+    // Lotes de 1027 formas (no múltiplo de 4, para incluir la cola escalar de los kernels SIMD):
+
+TEST(shapes, batch_queries_match_scalar_intersects)
+{
+    const unsigned count = 1027;
+
+    Circle_Batch       circle_batch;
+    Aabb_Batch         aabb_batch;
+    Obb_Batch          obb_batch;
+    vector< Circle2f > circles;
+    vector< Aabb2f   > aabbs;
+    vector< Obb2f    > obbs;
+
+    for (unsigned index = 0; index < count; ++index)
+    {
+        circles.push_back (random_circle ()); circle_batch.push_back (circles.back ());
+        aabbs  .push_back (random_aabb   ()); aabb_batch  .push_back (aabbs  .back ());
+        obbs   .push_back (random_obb    ()); obb_batch   .push_back (obbs   .back ());
+    }
+
+    bool     matches = true;
+    unsigned hits    = 0;
+
+    for (unsigned round = 0; round < 8; ++round)
+    {
+        Circle2f circle({ random_float (200.f, 800.f), random_float (200.f, 800.f) }, 200.f);
+        Aabb2f   aabb = Aabb2f::from_center ({ random_float (200.f, 800.f), random_float (200.f, 800.f) }, 150.f, 100.f);
+        Obb2f    obb  ({ random_float (200.f, 800.f), random_float (200.f, 800.f) }, 150.f, 100.f, random_float (0.f, 6.28f));
+
+        matches &= query_matches_intersects (circle, circle_batch, circles, hits);
+        matches &= query_matches_intersects (circle, aabb_batch,   aabbs,   hits);
+        matches &= query_matches_intersects (circle, obb_batch,    obbs,    hits);
+        matches &= query_matches_intersects (aabb,   circle_batch, circles, hits);
+        matches &= query_matches_intersects (aabb,   aabb_batch,   aabbs,   hits);
+        matches &= query_matches_intersects (aabb,   obb_batch,    obbs,    hits);
+        matches &= query_matches_intersects (obb,    circle_batch, circles, hits);
+        matches &= query_matches_intersects (obb,    aabb_batch,   aabbs,   hits);
+        matches &= query_matches_intersects (obb,    obb_batch,    obbs,    hits);
+    }
+
+    CHECK(matches);
+    CHECK(hits > 0);
+}
+
+TEST(shapes, convex_polygons)
+{
+    Convex_Polygon2f a(Obb2f({  0.f,  0.f }, 10.f, 10.f, 0.3f));
+    Convex_Polygon2f b(Obb2f({ 15.f, 15.f }, 10.f, 10.f, 0.5f));
+    Convex_Polygon2f c(Obb2f({ 40.f, 40.f }, 10.f, 10.f, 0.5f));
+
+    CHECK( intersects (a, b));
+    CHECK(!intersects (a, c));
+    CHECK(!intersects (a, Circle2f({ 30.f, 0.f }, 5.f)));
+    CHECK( intersects (a, Circle2f({ 14.f, 0.f }, 5.f)));
+}
@@ -0,0 +1,78 @@
+/*
+ * SPRITE POOL TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182110
+ */
+
+#include <basics/Headless>
+#include <basics/Sprite_Pool>
+#include "Test.hpp"
+
+using namespace basics;
+
+namespace
+{
+
+    // Canvas que cuenta las llamadas a fill_rectangles() y los rectángulos recibidos:
+
+    struct Counting_Canvas : public headless::Canvas
+    {
+        unsigned batches    = 0;
+        unsigned rectangles = 0;
+
+        void fill_rectangles (const Texture_2D * , const float * , const float * , const float * , const float * , size_t count, int ) override
+        {
+            ++batches;
+            rectangles += unsigned(count);
+        }
+    };
+
+    headless::Texture_2D texture_a(8, 8);
+    headless::Texture_2D texture_b(8, 8);
+
+}
+
+TEST(sprite_pool, update_moves_only_visible_sprites)
+{
+    Sprite_Pool pool;
+
+    Sprite_Pool::Handle visible = pool.create (&texture_a);
+    Sprite_Pool::Handle hidden  = pool.create (&texture_a);
+
+    for (unsigned index = 0; index < 9; ++index) pool.create (&texture_a)->set_speed ({ 1.f, 1.f });
+
+    visible->set_position ({ 10.f, 20.f });
+    visible->set_speed    ({  2.f, -4.f });
+    hidden ->set_position ({ 10.f, 20.f });
+    hidden ->set_speed    ({  2.f, -4.f });
+    hidden ->hide ();
+
+    pool.update (0.5f);
+
+    CHECK(visible->get_position_x () == 11.f);
+    CHECK(visible->get_position_y () == 18.f);
+    CHECK(hidden ->get_position_x () == 10.f);
+    CHECK(hidden ->get_position_y () == 20.f);
+}
+
+TEST(sprite_pool, render_batches_consecutive_sprites_by_texture)
+{
+    Sprite_Pool pool;
+
+    for (unsigned index = 0; index < 6; ++index) pool.create (index < 4 ? &texture_a : &texture_b);
+
+    pool.create (&texture_b)->hide ();
+
+    Counting_Canvas canvas;
+
+    pool.render (canvas);
+
+    CHECK(canvas.batches    == 2);
+    CHECK(canvas.rectangles == 6);
+}
@@ -0,0 +1,120 @@
+/*
+ * SPSC QUEUE TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182090
+ */
+
+#include <thread>
+#include <basics/Director>
+#include <basics/Scene>
+#include <basics/Spsc_Queue>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    struct Touch_Counter : public Scene
+    {
+        unsigned started = 0;
+        unsigned moved   = 0;
+        unsigned ended   = 0;
+
+        Size2u get_view_size () override
+        {
+            return { 64, 64 };
+        }
+
+        void handle_touch (Touch_Event & touch) override
+        {
+            if (touch.id == ID(touch-started)) ++started; else
+            if (touch.id == ID(touch-moved  )) ++moved;   else
+            if (touch.id == ID(touch-ended  )) ++ended;
+        }
+    };
+
+}
+
+TEST(spsc_queue, keeps_order_across_threads)
+{
+    Spsc_Queue< unsigned, 64 > queue(Spsc_Queue< unsigned, 64 >::WAIT);
+
+    const unsigned count = 100000;
+
+    thread producer ([&] () { for (unsigned index = 0; index < count; ++index) queue.push (unsigned(index)); });
+
+    unsigned expected = 0;
+    unsigned value;
+    bool     in_order = true;
+
+    while (expected < count)
+    {
+        if (queue.poll (value)) in_order &= value == expected++; else this_thread::yield ();
+    }
+
+    producer.join ();
+
+    CHECK(in_order);
+    CHECK(queue.get_dropped_count () == 0);
+}
+
+TEST(spsc_queue, waits_per_push_when_asked)
+{
+    typedef Spsc_Queue< int, 4 > Queue;
+
+    Queue queue(Queue::DISCARD);
+
+    for (int index = 0; index < 4; ++index) queue.push (int(index));
+
+    CHECK(!queue.push (4));
+    CHECK(queue.get_dropped_count () == 1);
+
+    thread producer ([&] () { queue.push (5, Queue::WAIT); });
+
+    int value;
+    int last = -1;
+
+    while (last != 5)
+    {
+        if (queue.poll (value)) last = value; else this_thread::yield ();
+    }
+
+    producer.join ();
+
+    CHECK(queue.get_dropped_count () == 1);
+}
+
+TEST(spsc_queue, director_never_drops_touch_edges)
+{
+    // Muchos más toques en un mismo fotograma de los que caben en la cola del Director:
+
+    vector< Director::Scripted_Event > script;
+
+    for (int32_t pointer = 0; pointer < 4; ++pointer)
+    {
+        script.push_back ({ 1, Touch_Event{ ID(touch-started), pointer, 10.f, 10.f, 0 }.to_event () });
+
+        for (unsigned index = 0; index < 1000; ++index)
+        {
+            script.push_back ({ 1, Touch_Event{ ID(touch-moved), pointer, float(index % 64), 10.f, 0 }.to_event () });
+        }
+
+        script.push_back ({ 1, Touch_Event{ ID(touch-ended), pointer, 20.f, 10.f, 0 }.to_event () });
+    }
+
+    shared_ptr< Touch_Counter > scene = make_shared< Touch_Counter > ();
+
+    director.run_headless (scene, 4, 1.f / 60.f, script);
+
+    CHECK(scene->started == 4);
+    CHECK(scene->ended   == 4);
+    CHECK(scene->moved   >  0);
+}
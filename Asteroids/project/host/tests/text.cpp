@@ -0,0 +1,158 @@
+/*
+ * TEXT TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182185
+ */
+
+#include <basics/Headless>
+#include <basics/Raster_Font>
+#include <basics/Text_Layout_Cache>
+#include <basics/Text_Prefab>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    // Canvas que cuenta los glifos que le llegan desde Canvas::draw_text():
+
+    struct Counting_Canvas : headless::Canvas
+    {
+        size_t glyphs = 0;
+
+        void fill_rectangle (const Point2f & , const Size2f & , const Atlas::Slice * , int ) override
+        {
+            ++glyphs;
+        }
+    };
+
+    struct Fixture
+    {
+        shared_ptr< basics::Window > window = headless::Window::create ({ 1280, 720 });
+        Graphics_Context::Accessor   context = window->lock_graphics_context ();
+        Raster_Font                  font { HOST_DATA_PATH "/fonts/test.fnt", context };
+    };
+
+    bool same_layout (const Text_Layout & a, const Text_Layout & b)
+    {
+        if (a.get_width () != b.get_width () || a.get_glyphs ().size () != b.get_glyphs ().size ()) return false;
+
+        for (size_t index = 0; index < a.get_glyphs ().size (); ++index)
+        {
+            const Text_Layout::Glyph & glyph_a = a.get_glyphs ()[index];
+            const Text_Layout::Glyph & glyph_b = b.get_glyphs ()[index];
+
+            if (glyph_a.slice != glyph_b.slice || glyph_a.position != glyph_b.position) return false;
+        }
+
+        return true;
+    }
+
+}
+
+TEST(text, cached_layout_equals_a_fresh_layout)
+{
+    Fixture fixture;
+
+    REQUIRE(fixture.font.good ());
+
+    Text_Layout_Cache cache(4);
+
+    const wstring text = L"SCORE 123450  LIVES 3";
+
+    const Text_Layout & cached = cache.get (fixture.font, text);
+
+    CHECK(same_layout (cached, Text_Layout(fixture.font, text)));
+    CHECK(&cache.get (fixture.font, text) == &cached);          // Un acierto no vuelve a maquetar.
+    CHECK(cache.size () == 1);
+}
+
+TEST(text, cache_evicts_the_least_recently_used_entry)
+{
+    Fixture fixture;
+
+    REQUIRE(fixture.font.good ());
+
+    Text_Layout_Cache cache(2);
+
+    const Text_Layout * a = &cache.get (fixture.font, L"A");
+    const Text_Layout * b = &cache.get (fixture.font, L"B");
+
+    cache.get (fixture.font, L"A");
+
+    const Text_Layout * c = &cache.get (fixture.font, L"C");    // Descarta B, que es la menos usada.
+
+    CHECK(c == b);
+    CHECK(&cache.get (fixture.font, L"A") == a);
+    CHECK(cache.size () == 2);
+    CHECK(same_layout (*c, Text_Layout(fixture.font, L"C")));
+}
+
+TEST(text, reused_entries_are_laid_out_from_scratch)
+{
+    Fixture fixture;
+
+    REQUIRE(fixture.font.good ());
+
+    Text_Layout_Cache cache(1);
+
+    cache.get (fixture.font, L"A LONGER TEXT\nON TWO LINES");
+
+    const Text_Layout & reused = cache.get (fixture.font, L"HI");
+
+    CHECK(same_layout (reused, Text_Layout(fixture.font, L"HI")));
+    CHECK(reused.get_height () == Text_Layout(fixture.font, L"HI").get_height ());
+
+    Text_Layout layout(fixture.font, L"SCORE 1\nLIVES 3");
+
+    layout.assign (fixture.font, L"");
+
+    CHECK(layout.get_glyphs ().empty () && layout.get_width () == 0.f && layout.get_height () == 0.f);
+}
+
+TEST(text, cache_distinguishes_fonts)
+{
+    Fixture     fixture;
+    Raster_Font other(HOST_DATA_PATH "/fonts/test.fnt", fixture.context);
+
+    REQUIRE(fixture.font.good () && other.good ());
+
+    Text_Layout_Cache cache(4);
+
+    const Text_Layout & first  = cache.get (fixture.font, L"HI 99999");
+    const Text_Layout & second = cache.get (other,        L"HI 99999");
+
+    CHECK(&first != &second);
+    CHECK(first.get_glyphs ()[0].slice != second.get_glyphs ()[0].slice);
+    CHECK(cache.size () == 2);
+}
+
+TEST(text, prefab_keeps_the_layout_and_draws_every_glyph)
+{
+    Fixture fixture;
+
+    REQUIRE(fixture.font.good ());
+
+    Text_Layout layout(fixture.font, L"LEVEL 12");
+
+    shared_ptr< Text_Prefab > prefab = Text_Prefab::create (fixture.context, layout);
+
+    REQUIRE(prefab != nullptr);
+
+    CHECK(prefab->get_width  () == layout.get_width  ());
+    CHECK(prefab->get_height () == layout.get_height ());
+
+    Counting_Canvas canvas;
+
+    canvas.draw_text ({ 100.f, 100.f }, *prefab);
+
+    CHECK(canvas.glyphs == layout.get_glyphs ().size ());
+}
@@ -0,0 +1,141 @@
+/*
+ * TINY MAP TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182205
+ */
+
+#include <string>
+#include <utility>
+#include <basics/Tiny_Map>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    typedef Tiny_Map< int, string, 4 > Map;
+
+    Map make_map (int count)
+    {
+        Map map;
+
+        for (int key = 0; key < count; ++key) map[key] = to_string (key * 10);
+
+        return map;
+    }
+
+    bool has (const Map & map, int key, const string & value)
+    {
+        auto item = map.find (key);
+
+        return item != map.end () && item->value == value;
+    }
+
+}
+
+TEST(tiny_map, inline_insert_and_find)
+{
+    Map map = make_map (4);
+
+    CHECK(map.size () == 4);
+    CHECK(!map.spilled ());
+    CHECK(has (map, 0, "0") && has (map, 3, "30"));
+    CHECK(map.count (2) == 1);
+    CHECK(map.count (7) == 0);
+    CHECK(map.find (7) == map.end ());
+
+    map[2] = "twenty";                                          // Una clave existente no se duplica.
+
+    CHECK(map.size () == 4);
+    CHECK(has (map, 2, "twenty"));
+}
+
+TEST(tiny_map, spills_past_the_inline_capacity)
+{
+    Map map = make_map (9);
+
+    CHECK(map.size () == 9);
+    CHECK(map.spilled ());
+
+    bool all = true;
+
+    for (int key = 0; key < 9; ++key) all = all && has (map, key, to_string (key * 10));
+
+    CHECK(all);
+
+    int expected = 0;                                           // Se conserva el orden de inserción.
+    bool ordered = true;
+
+    for (auto & item : map) ordered = ordered && item.key == expected++;
+
+    CHECK(ordered && expected == 9);
+}
+
+TEST(tiny_map, erase_moves_the_last_item_into_the_gap)
+{
+    Map map = make_map (6);
+
+    CHECK(map.erase (1));
+    CHECK(!map.erase (1));
+    CHECK(map.size () == 5);
+    CHECK(map.spilled ());
+    CHECK(map.find (1) == map.end ());
+    CHECK(has (map, 5, "50") && has (map, 0, "0") && has (map, 4, "40"));
+
+    CHECK(map.erase (5));                                       // El último no se mueve.
+    CHECK(map.erase (0));
+    CHECK(map.size () == 3);
+    CHECK(!map.spilled ());
+    CHECK(has (map, 2, "20") && has (map, 3, "30") && has (map, 4, "40"));
+
+    map.clear ();
+
+    CHECK(map.empty ());
+    CHECK(map.begin () == map.end ());
+}
+
+TEST(tiny_map, move_empties_the_source)
+{
+    for (int count : { 3, 7 })
+    {
+        Map source = make_map (count);
+        Map target(std::move (source));
+
+        CHECK(source.empty ());
+        CHECK(source.find (0) == source.end ());
+        CHECK(target.size () == size_t(count));
+        CHECK(has (target, count - 1, to_string ((count - 1) * 10)));
+
+        Map assigned = make_map (2);
+
+        assigned = std::move (target);
+
+        CHECK(target.empty ());
+        CHECK(assigned.size () == size_t(count));
+        CHECK(has (assigned, 0, "0") && !has (assigned, count, to_string (count * 10)));
+
+        source[42] = "reused";                                  // El origen sigue siendo utilizable.
+
+        CHECK(source.size () == 1 && has (source, 42, "reused"));
+    }
+}
+
+TEST(tiny_map, copy_keeps_both_maps)
+{
+    Map original = make_map (6);
+    Map copy     = original;
+
+    copy[0] = "changed";
+
+    CHECK(has (original, 0, "0"));
+    CHECK(has (copy, 0, "changed"));
+    CHECK(copy.size () == 6 && has (copy, 5, "50"));
+}
@@ -0,0 +1,57 @@
+/*
+ * TOUCH EVENT TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182095
+ */
+
+#include <basics/Touch_Event>
+#include "Test.hpp"
+
+using namespace basics;
+
+TEST(touch_event, round_trips_through_event)
+{
+    Touch_Event touch{ ID(touch-moved), 3, 12.5f, -4.f, 123456789 };
+    Touch_Event copy = Touch_Event::from (touch.to_event ());
+
+    CHECK(copy.id        == touch.id       );
+    CHECK(copy.pointer   == touch.pointer  );
+    CHECK(copy.x         == touch.x        );
+    CHECK(copy.y         == touch.y        );
+    CHECK(copy.timestamp == touch.timestamp);
+}
+
+TEST(touch_event, from_does_not_add_missing_properties)
+{
+    Event event(ID(touch-started));
+
+    event[ID(x)] = 5.f;
+
+    const Event & source = event;
+    Touch_Event   touch  = Touch_Event::from (source);
+
+    CHECK(event.properties.size () == 1);
+    CHECK(touch.pointer   == 0  );
+    CHECK(touch.x         == 5.f);
+    CHECK(touch.y         == 0.f);
+    CHECK(touch.timestamp == 0  );
+}
+
+TEST(touch_event, from_ignores_properties_of_another_type)
+{
+    Event event(ID(touch-ended));
+
+    event[ID(id)] = 2.f;
+    event[ID(y) ] = int32_t(7);
+
+    Touch_Event touch = Touch_Event::from (event);
+
+    CHECK(touch.pointer == 0  );
+    CHECK(touch.y       == 0.f);
+}
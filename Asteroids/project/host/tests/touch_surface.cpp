@@ -0,0 +1,200 @@
+/*
+ * TOUCH SURFACE TESTS
+ * Copyright © 2018+ Ángel Rodríguez Ballesteros
+ *
+ * Distributed under the Boost Software License, version  1.0
+ * See documents/LICENSE.TXT or www.boost.org/LICENSE_1_0.txt
+ *
+ * angel.rodriguez@esne.edu
+ *
+ * C2610182235
+ */
+
+#include <atomic>
+#include <thread>
+#include <basics/Touch_Surface>
+#include "Test.hpp"
+
+using namespace basics;
+using namespace std;
+
+namespace
+{
+
+    struct Test_Surface : public Touch_Surface
+    {
+    };
+
+    Touch_Event touch (Id id, int32_t pointer, float x = 0.f, float y = 0.f)
+    {
+        return Touch_Event{ id, pointer, x, y, 0 };
+    }
+
+}
+
+TEST(touch_surface, unpublished_records_are_invisible)
+{
+    Test_Surface        surface;
+    Touch_Surface::State state;
+
+    surface.record (touch (ID(touch-started), 7, 10.f, 20.f));
+    surface.read   (state);
+
+    CHECK(state.touch_count () == 0);
+
+    surface.publish ();
+    surface.read    (state);
+
+    REQUIRE(state.touch_count () == 1);
+
+    const Touch_Surface::Touch & first = state.get_touch (0);
+
+    CHECK(first.id == 7 && first.x == 10.f && first.y == 20.f);
+    CHECK(first.down && first.held && !first.up);
+
+    surface.record (touch (ID(touch-moved), 7, 30.f, 40.f));    // Sin publicar.
+    surface.read   (state);
+
+    REQUIRE(state.touch_count () == 1);
+
+    CHECK(state.get_touch (0).x == 10.f);
+    CHECK(!state.get_touch (0).down);                           // El flanco solo se ve una vez.
+
+    surface.record (touch (ID(touch-moved), 99, 1.f, 1.f));     // Dedo desconocido: se ignora.
+    surface.publish ();
+    surface.read    (state);
+
+    CHECK(state.touch_count () == 1 && state.get_touch (0).x == 30.f);
+    CHECK(state.find_touch (99) == nullptr);
+}
+
+TEST(touch_surface, publish_makes_all_pointers_visible_at_once)
+{
+    Test_Surface surface;
+
+    surface.record  (touch (ID(touch-started), 0));
+    surface.record  (touch (ID(touch-started), 1));
+    surface.publish ();
+
+    // El hilo de entrada mueve ambos dedos a la misma x antes de cada publish(). El lector nunca
+    // debe ver un dedo movido y el otro no:
+
+    const int      steps = 200000;
+    atomic< bool > done(false);
+
+    thread input
+    (
+        [&surface, &done]
+        {
+            for (int step = 1; step <= steps; ++step)
+            {
+                surface.record  (touch (ID(touch-moved), 0, float(step)));
+                surface.record  (touch (ID(touch-moved), 1, float(step)));
+                surface.publish ();
+            }
+
+            done = true;
+        }
+    );
+
+    Touch_Surface::State state;
+    bool  coherent = true;
+    float last     = 0.f;
+
+    while (!done || last < float(steps))
+    {
+        surface.read (state);
+
+        const Touch_Surface::Touch * first  = state.find_touch (0);
+        const Touch_Surface::Touch * second = state.find_touch (1);
+
+        if (state.touch_count () != 2 || !first || !second || first->x != second->x || first->x < last)
+        {
+            coherent = false;
+            break;
+        }
+
+        last = first->x;
+    }
+
+    input.join ();
+
+    CHECK(coherent);
+    CHECK(last == float(steps));
+}
+
+TEST(touch_surface, press_and_release_within_one_frame_are_edges)
+{
+    Test_Surface        surface;
+    Touch_Surface::State state;
+
+    surface.record  (touch (ID(touch-started), 3, 5.f, 6.f));
+    surface.record  (touch (ID(touch-ended  ), 3, 5.f, 6.f));
+    surface.publish ();
+    surface.read    (state);
+
+    REQUIRE(state.touch_count () == 1);
+
+    const Touch_Surface::Touch & tap = state.get_touch (0);
+
+    CHECK(tap.id == 3 && tap.down && tap.up && !tap.held);
+
+    surface.read (state);
+
+    CHECK(state.touch_count () == 0);                           // Ya no está apoyado ni hay flancos.
+
+    // Un segundo toque rápido del mismo dedo entre dos lecturas también se detecta:
+
+    surface.record  (touch (ID(touch-started), 3));
+    surface.record  (touch (ID(touch-ended  ), 3));
+    surface.publish ();
+    surface.read    (state);
+
+    REQUIRE(state.touch_count () == 1);
+
+    CHECK(state.get_touch (0).down && state.get_touch (0).up);
+}
+
+TEST(touch_surface, up_events_release_the_right_pointer)
+{
+    Test_Surface        surface;
+    Touch_Surface::State state;
+
+    for (int32_t pointer : { 10, 11, 12 }) surface.record (touch (ID(touch-started), pointer, float(pointer)));
+
+    surface.publish ();
+    surface.read    (state);
+
+    CHECK(state.touch_count () == 3);
+
+    surface.record  (touch (ID(touch-ended), 11));
+    surface.publish ();
+    surface.read    (state);
+
+    REQUIRE(state.find_touch (10) && state.find_touch (11) && state.find_touch (12));
+
+    CHECK(state.find_touch (11)->up && !state.find_touch (11)->held);
+    CHECK(state.find_touch (10)->held && !state.find_touch (10)->up && !state.find_touch (10)->down);
+    CHECK(state.find_touch (12)->held && !state.find_touch (12)->up && !state.find_touch (12)->down);
+
+    surface.read (state);
+
+    CHECK(state.touch_count () == 2 && state.find_touch (11) == nullptr);
+
+    // Un dedo nuevo ocupa el hueco liberado sin heredar sus flancos ni afectar a los demás:
+
+    surface.record  (touch (ID(touch-started), 13, 13.f));
+    surface.publish ();
+    surface.read    (state);
+
+    REQUIRE(state.touch_count () == 3 && state.find_touch (13));
+
+    CHECK(state.find_touch (13)->down && state.find_touch (13)->held && !state.find_touch (13)->up);
+    CHECK(state.find_touch (13)->x == 13.f);
+    CHECK(!state.find_touch (10)->down && !state.find_touch (12)->down);
+
+    surface.clear ();
+    surface.read  (state);
+
+    CHECK(state.touch_count () == 0);
+}